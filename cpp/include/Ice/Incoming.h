@@ -5,6 +5,7 @@
 #ifndef ICE_INCOMING_H
 #define ICE_INCOMING_H
 
+#include <IceUtil/Time.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ConnectionIF.h>
 #include <Ice/ServantLocatorF.h>
@@ -179,6 +180,39 @@ public:
 
     void invoke(const ServantManagerPtr&, Ice::InputStream*);
 
+    //
+    // Reply to the request with the given exception instead of
+    // dispatching it.
+    //
+    void reject(Ice::InputStream*, const Ice::LocalException&);
+
+    //
+    // The observer of a dispatch can be obtained before the dispatch,
+    // invoke() and reject() don't obtain a new observer in this case.
+    //
+    void setObserver(const Ice::Instrumentation::DispatchObserverPtr& observer)
+    {
+        _observer.attach(observer);
+    }
+
+    //
+    // The concurrency limit of the object adapter is reported to the
+    // dispatch observer if the adapter limits its dispatches.
+    //
+    void setConcurrencyLimit(Ice::Int limit)
+    {
+        _concurrencyLimit = limit;
+    }
+
+    //
+    // The deadline of a request is relative to the time the request
+    // is received, the request is received when it's read by default.
+    //
+    void setReceivedTime(const IceUtil::Time& receivedTime)
+    {
+        _receivedTime = receivedTime;
+    }
+
     // Inlined for speed optimization.
     void skipReadParams()
     {
@@ -210,8 +244,15 @@ private:
 
     friend class IncomingAsync;
 
+    void readCurrent(Ice::InputStream*);
+    void drop();
+
     Ice::InputStream* _is;
     Ice::Byte* _inParamPos;
+    Ice::Int _concurrencyLimit;
+    IceUtil::Time _receivedTime;
+    IceUtil::Time _deadline;
+    ResponseHandlerPtr _replyCacheHandler;
 
     IncomingAsyncPtr _inAsync;
 };
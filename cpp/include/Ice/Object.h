@@ -37,6 +37,16 @@ namespace Ice
 /** A default-initialized Current instance. */
 ICE_API extern const Current emptyCurrent;
 
+/**
+ * Obtains the remaining time before the deadline of a request. The deadline of a request is set by the invocation
+ * timeout of the caller, the requests are no longer dispatched once their deadline expired. The invocations made by
+ * the thread dispatching a request inherit its deadline.
+ * @param current The Current object of the request.
+ * @return The remaining time in milliseconds, 0 if the deadline expired, or -1 if the request has no deadline. If
+ * not called by the thread dispatching the request, returns the remaining time when the request was received.
+ */
+ICE_API Int getRemainingTime(const Current& current);
+
 #ifndef ICE_CPP11_MAPPING
 /**
  * Abstract callback class for an asynchronous dispatch interceptor.
@@ -231,9 +231,21 @@ protected:
     const Ice::ObjectPrxPtr _proxy;
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
+    int _invocationTimeout;
+    bool _replyCached;
 
 private:
 
+    Ice::OperationMode getRetryMode(const Ice::ConnectionIPtr&);
+
+    //
+    // The proxy used to send the request, it's the proxy of the
+    // invocation without the endpoints which rejected the request
+    // because the server is overloaded, or with only the endpoint
+    // which received the request if it has a request ID.
+    //
+    Ice::ObjectPrxPtr _retryProxy;
+    bool _replyCachePinned;
     int _cnt;
     bool _sent;
 };
@@ -247,9 +259,14 @@ public:
 
     OutgoingAsync(const Ice::ObjectPrxPtr&, bool);
 
-    void prepare(const std::string&, Ice::OperationMode, const Ice::Context&);
+    //
+    // The type ID is the type ID of the interface which defines the
+    // operation, it's empty for dynamic invocations.
+    //
+    void prepare(const std::string&, const std::string&, Ice::OperationMode, const Ice::Context&);
 
     virtual bool sent();
+    virtual bool exception(const Ice::Exception&);
     virtual bool response();
 
     virtual AsyncStatus invokeRemote(const Ice::ConnectionIPtr&, bool, bool);
@@ -258,7 +275,7 @@ public:
     void abort(const Ice::Exception&);
     void invoke(const std::string&);
 #ifdef ICE_CPP11_MAPPING
-    void invoke(const std::string&, Ice::OperationMode, Ice::FormatType, const Ice::Context&,
+    void invoke(const std::string&, const std::string&, Ice::OperationMode, Ice::FormatType, const Ice::Context&,
                 std::function<void(Ice::OutputStream*)>);
     void throwUserException();
 #endif
@@ -288,6 +305,12 @@ public:
         }
     }
 
+    //
+    // Called by the hedged request of this invocation.
+    //
+    bool startHedge(Ice::OutputStream*);
+    bool hedgeResponse(Ice::InputStream*);
+
 protected:
 
     const Ice::EncodingVersion _encoding;
@@ -297,6 +320,27 @@ protected:
 #endif
 
     bool _synchronous;
+
+private:
+
+    void scheduleHedge();
+    bool finishHedge();
+
+    void writeContext(const Ice::Context&, bool);
+    void updateDeadline(Ice::OutputStream&);
+
+    //
+    // The position of the _deadline context entry value in the request,
+    // rewritten with the remaining time each time the request is sent.
+    //
+    size_t _deadlinePos;
+    IceUtil::Time _deadlineStart;
+
+    std::string _hedgeOperation;
+    IceUtil::Time _hedgeStart;
+    IceUtil::Time _hedgeDelay;
+    ProxyOutgoingAsyncBasePtr _hedge;
+    unsigned char _hedgeState;
 };
 
 }
@@ -397,6 +441,7 @@ public:
 
     void
     invoke(const std::string& operation,
+           const std::string& typeId,
            Ice::OperationMode mode,
            Ice::FormatType format,
            const Ice::Context& ctx,
@@ -410,11 +455,12 @@ public:
             return v;
         };
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, typeId, mode, format, ctx, std::move(write));
     }
 
     void
     invoke(const std::string& operation,
+           const std::string& typeId,
            Ice::OperationMode mode,
            Ice::FormatType format,
            const Ice::Context& ctx,
@@ -424,7 +470,7 @@ public:
     {
         _read = std::move(read);
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, typeId, mode, format, ctx, std::move(write));
     }
 
 protected:
@@ -441,6 +487,7 @@ public:
 
     void
     invoke(const std::string& operation,
+           const std::string& typeId,
            Ice::OperationMode mode,
            Ice::FormatType format,
            const Ice::Context& ctx,
@@ -448,7 +495,7 @@ public:
            std::function<void(const Ice::UserException&)> userException)
     {
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, typeId, mode, format, ctx, std::move(write));
     }
 };
 
@@ -553,6 +600,7 @@ public:
 
     void
     invoke(const std::string& operation,
+           const std::string& typeId,
            Ice::OperationMode mode,
            Ice::FormatType format,
            const Ice::Context& ctx,
@@ -560,7 +608,7 @@ public:
            std::function<void(const Ice::UserException&)> userException)
     {
         _userException = std::move(userException);
-        OutgoingAsync::invoke(operation, mode, format, ctx, std::move(write));
+        OutgoingAsync::invoke(operation, typeId, mode, format, ctx, std::move(write));
     }
 };
 
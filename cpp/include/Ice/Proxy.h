@@ -143,7 +143,7 @@ public:
 
         try
         {
-            prepare(operation, mode, context);
+            prepare(operation, std::string(), mode, context);
             if(inParams.first == inParams.second)
             {
                 _os.writeEmptyEncapsulation(_encoding);
@@ -1098,6 +1098,7 @@ public:
     void _checkTwowayOnly(const ::std::string&) const;
 
     ::IceInternal::RequestHandlerPtr _getRequestHandler();
+    ::IceInternal::RequestHandlerPtr _getCachedRequestHandler() const;
     ::IceInternal::BatchRequestQueuePtr _getBatchRequestQueue();
     ::IceInternal::RequestHandlerPtr _setRequestHandler(const ::IceInternal::RequestHandlerPtr&);
     void _updateRequestHandler(const ::IceInternal::RequestHandlerPtr&, const ::IceInternal::RequestHandlerPtr&);
@@ -1134,11 +1135,11 @@ protected:
 
 private:
 
-    void setup(const ::IceInternal::ReferencePtr&);
+    void setup(const ::IceInternal::ReferencePtr&, const ::IceInternal::RequestHandlerPtr& = nullptr);
     friend class ::IceInternal::ProxyFactory;
 
     ::IceInternal::ReferencePtr _reference;
-    ::IceInternal::RequestHandlerPtr _requestHandler;
+    ::IceInternal::RequestHandlerPtr _requestHandler; // Accessed with the std::atomic_* shared_ptr functions.
     ::IceInternal::BatchRequestQueuePtr _batchRequestQueue;
     IceUtil::Mutex _mutex;
 };
@@ -2782,6 +2783,7 @@ public:
     void _end(const ::Ice::AsyncResultPtr&, const std::string&) const;
 
     ::IceInternal::RequestHandlerPtr _getRequestHandler();
+    ::IceInternal::RequestHandlerPtr _getCachedRequestHandler() const;
     ::IceInternal::BatchRequestQueuePtr _getBatchRequestQueue();
     ::IceInternal::RequestHandlerPtr _setRequestHandler(const ::IceInternal::RequestHandlerPtr&);
     void _updateRequestHandler(const ::IceInternal::RequestHandlerPtr&, const ::IceInternal::RequestHandlerPtr&);
@@ -2840,7 +2842,8 @@ private:
     ::Ice::AsyncResultPtr _iceI_begin_ice_flushBatchRequests(const ::IceInternal::CallbackBasePtr&,
                                                          const ::Ice::LocalObjectPtr&);
 
-    void setup(const ::IceInternal::ReferencePtr&);
+    void setup(const ::IceInternal::ReferencePtr&,
+               const ::IceInternal::RequestHandlerPtr& = ::IceInternal::RequestHandlerPtr());
     friend class ::IceInternal::ProxyFactory;
 
     ::IceInternal::ReferencePtr _reference;
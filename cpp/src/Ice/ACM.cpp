@@ -85,7 +85,7 @@ IceInternal::FactoryACMMonitor::~FactoryACMMonitor()
 {
     assert(!_instance);
     assert(_connections.empty());
-    assert(_changes.empty());
+    assert(_deadlines.empty());
     assert(_reapedConnections.empty());
 }
 
@@ -117,7 +117,6 @@ IceInternal::FactoryACMMonitor::destroy()
     }
 
     _instance = 0;
-    _changes.clear();
 
     //
     // Wait for the connection set to be cleared by the timer thread.
@@ -139,13 +138,10 @@ IceInternal::FactoryACMMonitor::add(const ConnectionIPtr& connection)
     Lock sync(*this);
     if(_connections.empty())
     {
-        _connections.insert(connection);
         _instance->timer()->scheduleRepeated(ICE_SHARED_FROM_THIS, _config.timeout / 2);
     }
-    else
-    {
-        _changes.push_back(make_pair(connection, true));
-    }
+    _connections.insert(make_pair(connection, IceUtil::Time()));
+    schedule(connection, IceUtil::Time::now(IceUtil::Time::Monotonic));
 }
 
 void
@@ -158,7 +154,19 @@ IceInternal::FactoryACMMonitor::remove(const ConnectionIPtr& connection)
 
     Lock sync(*this);
     assert(_instance);
-    _changes.push_back(make_pair(connection, false));
+    map<ConnectionIPtr, IceUtil::Time>::iterator p = _connections.find(connection);
+    if(p != _connections.end())
+    {
+        if(p->second != IceUtil::Time())
+        {
+            _deadlines.erase(make_pair(p->second, connection));
+        }
+        _connections.erase(p);
+        if(_connections.empty())
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+    }
 }
 
 void
@@ -168,6 +176,16 @@ IceInternal::FactoryACMMonitor::reap(const ConnectionIPtr& connection)
     _reapedConnections.push_back(connection);
 }
 
+void
+IceInternal::FactoryACMMonitor::activity(const ConnectionIPtr& connection)
+{
+    Lock sync(*this);
+    if(_instance)
+    {
+        schedule(connection, IceUtil::Time::now(IceUtil::Time::Monotonic));
+    }
+}
+
 ACMMonitorPtr
 IceInternal::FactoryACMMonitor::acm(const IceUtil::Optional<int>& timeout,
                                     const IceUtil::Optional<Ice::ACMClose>& close,
@@ -212,55 +230,103 @@ IceInternal::FactoryACMMonitor::swapReapedConnections(vector<ConnectionIPtr>& co
 void
 IceInternal::FactoryACMMonitor::runTimerTask()
 {
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<ConnectionIPtr> connections;
     {
         Lock sync(*this);
         if(!_instance)
         {
             _connections.clear();
+            _deadlines.clear();
             notifyAll();
             return;
         }
 
-        for(vector<pair<ConnectionIPtr, bool> >::const_iterator p = _changes.begin(); p != _changes.end(); ++p)
-        {
-            if(p->second)
-            {
-                _connections.insert(p->first);
-            }
-            else
-            {
-                _connections.erase(p->first);
-            }
-        }
-        _changes.clear();
-
         if(_connections.empty())
         {
             _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
             return;
         }
+
+        //
+        // Monitor the connections which are due before the middle of
+        // the next period, a connection is otherwise monitored one
+        // period late if the timer runs slightly early.
+        //
+        IceUtil::Time due = now + _config.timeout / 4;
+        while(!_deadlines.empty() && _deadlines.begin()->first <= due)
+        {
+            const ConnectionIPtr& connection = _deadlines.begin()->second;
+            _connections[connection] = IceUtil::Time();
+            connections.push_back(connection);
+            _deadlines.erase(_deadlines.begin());
+        }
     }
 
     //
     // Monitor connections outside the thread synchronization, so
     // that connections can be added or removed during monitoring.
     //
-    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-    for(set<ConnectionIPtr>::const_iterator p = _connections.begin(); p != _connections.end(); ++p)
+    vector<pair<ConnectionIPtr, IceUtil::Time> > next;
+    next.reserve(connections.size());
+    for(vector<ConnectionIPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
     {
         try
         {
-            (*p)->monitor(now, _config);
+            IceUtil::Time t = (*p)->monitor(now, _config);
+            if(t != IceUtil::Time())
+            {
+                next.push_back(make_pair(*p, t));
+            }
         }
         catch(const exception& ex)
         {
             handleException(ex);
+            next.push_back(make_pair(*p, now + _config.timeout / 2));
         }
         catch(...)
         {
             handleException();
+            next.push_back(make_pair(*p, now + _config.timeout / 2));
+        }
+    }
+
+    if(!next.empty())
+    {
+        Lock sync(*this);
+        if(_instance)
+        {
+            for(vector<pair<ConnectionIPtr, IceUtil::Time> >::const_iterator p = next.begin(); p != next.end(); ++p)
+            {
+                schedule(p->first, p->second);
+            }
+        }
+    }
+}
+
+void
+IceInternal::FactoryACMMonitor::schedule(const ConnectionIPtr& connection, const IceUtil::Time& time)
+{
+    //
+    // Called with the mutex locked. The connection is monitored at
+    // the given time unless it's already scheduled to be monitored
+    // sooner.
+    //
+    map<ConnectionIPtr, IceUtil::Time>::iterator p = _connections.find(connection);
+    if(p == _connections.end())
+    {
+        return; // The connection was removed.
+    }
+    if(p->second != IceUtil::Time())
+    {
+        if(p->second <= time)
+        {
+            return;
         }
+        _deadlines.erase(make_pair(p->second, connection));
     }
+    p->second = time;
+    _deadlines.insert(make_pair(time, connection));
 }
 
 void
@@ -334,6 +400,14 @@ IceInternal::ConnectionACMMonitor::reap(const ConnectionIPtr& connection)
     _parent->reap(connection);
 }
 
+void
+IceInternal::ConnectionACMMonitor::activity(const ConnectionIPtr&)
+{
+    //
+    // Nothing to do, the connection is monitored every period.
+    //
+}
+
 ACMMonitorPtr
 IceInternal::ConnectionACMMonitor::acm(const IceUtil::Optional<int>& timeout,
                                        const IceUtil::Optional<Ice::ACMClose>& close,
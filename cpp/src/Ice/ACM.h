@@ -38,6 +38,7 @@ public:
     virtual void add(const Ice::ConnectionIPtr&) = 0;
     virtual void remove(const Ice::ConnectionIPtr&) = 0;
     virtual void reap(const Ice::ConnectionIPtr&) = 0;
+    virtual void activity(const Ice::ConnectionIPtr&) = 0;
 
     virtual ACMMonitorPtr acm(const IceUtil::Optional<int>&,
                               const IceUtil::Optional<Ice::ACMClose>&,
@@ -45,6 +46,13 @@ public:
     virtual Ice::ACM getACM() = 0;
 };
 
+//
+// The factory monitor keeps the time at which each connection needs
+// to be monitored again and its timer task only monitors the due
+// connections. A connection which can't need a heartbeat or be closed
+// before its next activity isn't monitored until the connection
+// reports this activity with activity().
+//
 class FactoryACMMonitor : public ACMMonitor, public IceUtil::Monitor<IceUtil::Mutex>
 #ifdef ICE_CPP11_MAPPING
                         , public std::enable_shared_from_this<FactoryACMMonitor>
@@ -58,6 +66,7 @@ public:
     virtual void add(const Ice::ConnectionIPtr&);
     virtual void remove(const Ice::ConnectionIPtr&);
     virtual void reap(const Ice::ConnectionIPtr&);
+    virtual void activity(const Ice::ConnectionIPtr&);
 
     virtual ACMMonitorPtr acm(const IceUtil::Optional<int>&,
                               const IceUtil::Optional<Ice::ACMClose>&,
@@ -75,11 +84,13 @@ private:
 
     virtual void runTimerTask();
 
+    void schedule(const Ice::ConnectionIPtr&, const IceUtil::Time&);
+
     InstancePtr _instance;
     const ACMConfig _config;
 
-    std::vector<std::pair<Ice::ConnectionIPtr, bool> > _changes;
-    std::set<Ice::ConnectionIPtr> _connections;
+    std::map<Ice::ConnectionIPtr, IceUtil::Time> _connections;
+    std::set<std::pair<IceUtil::Time, Ice::ConnectionIPtr> > _deadlines;
     std::vector<Ice::ConnectionIPtr> _reapedConnections;
 };
 
@@ -97,6 +108,7 @@ public:
     virtual void add(const Ice::ConnectionIPtr&);
     virtual void remove(const Ice::ConnectionIPtr&);
     virtual void reap(const Ice::ConnectionIPtr&);
+    virtual void activity(const Ice::ConnectionIPtr&);
 
     virtual ACMMonitorPtr acm(const IceUtil::Optional<int>&,
                               const IceUtil::Optional<Ice::ACMClose>&,
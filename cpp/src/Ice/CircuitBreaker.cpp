@@ -0,0 +1,347 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/CircuitBreaker.h>
+#include <Ice/EndpointI.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(CircuitBreaker* p) { return p; }
+IceUtil::Shared* IceInternal::upCast(EndpointHealth* p) { return p; }
+
+namespace
+{
+
+//
+// The error rate of an endpoint is computed over its last 20
+// outcomes, it's only checked once there are at least 10 outcomes.
+//
+const size_t windowSize = 20;
+const size_t minOutcomes = 10;
+
+//
+// The healthy endpoints are discarded if there are too many
+// endpoints.
+//
+const size_t maxEndpoints = 1000;
+
+EndpointIPtr
+normalize(const EndpointIPtr& endpoint)
+{
+    //
+    // The health is shared by the endpoints which only differ by
+    // their connection ID, compression or timeout.
+    //
+    return endpoint->connectionId("")->compress(false)->timeout(-1);
+}
+
+}
+
+IceInternal::EndpointHealth::EndpointHealth(const string& description) :
+    _description(description),
+    _consecutiveFailures(0),
+    _next(0),
+    _failures(0),
+    _ejections(0)
+{
+}
+
+IceInternal::CircuitBreaker::CircuitBreaker(const PropertiesPtr& properties,
+                                            const LoggerPtr& logger,
+                                            const TraceLevelsPtr& traceLevels) :
+    _logger(logger),
+    _traceLevels(traceLevels)
+{
+    _maxFailures = properties->getPropertyAsIntWithDefault("Ice.CircuitBreaker.Failures", 0);
+    if(_maxFailures < 0)
+    {
+        _maxFailures = 0;
+        Warning out(logger);
+        out << "invalid value for Ice.CircuitBreaker.Failures `"
+            << properties->getProperty("Ice.CircuitBreaker.Failures") << "': defaulting to 0";
+    }
+
+    int errorRate = properties->getPropertyAsIntWithDefault("Ice.CircuitBreaker.ErrorRate", 0);
+    if(errorRate < 0 || errorRate > 100)
+    {
+        errorRate = 0;
+        Warning out(logger);
+        out << "invalid value for Ice.CircuitBreaker.ErrorRate `"
+            << properties->getProperty("Ice.CircuitBreaker.ErrorRate") << "': defaulting to 0";
+    }
+    _errorRate = static_cast<size_t>(errorRate);
+
+    int backoff = properties->getPropertyAsIntWithDefault("Ice.CircuitBreaker.Backoff", 5000);
+    if(backoff <= 0)
+    {
+        backoff = 5000;
+        Warning out(logger);
+        out << "invalid value for Ice.CircuitBreaker.Backoff `"
+            << properties->getProperty("Ice.CircuitBreaker.Backoff") << "': defaulting to 5000";
+    }
+    _backoff = IceUtil::Time::milliSeconds(backoff);
+
+    int maxBackoff = properties->getPropertyAsIntWithDefault("Ice.CircuitBreaker.MaxBackoff", max(backoff, 60000));
+    if(maxBackoff < backoff)
+    {
+        maxBackoff = backoff;
+        Warning out(logger);
+        out << "invalid value for Ice.CircuitBreaker.MaxBackoff `"
+            << properties->getProperty("Ice.CircuitBreaker.MaxBackoff") << "': defaulting to " << backoff;
+    }
+    _maxBackoff = IceUtil::Time::milliSeconds(maxBackoff);
+
+    _enabled = _maxFailures > 0 || _errorRate > 0;
+}
+
+EndpointHealthPtr
+IceInternal::CircuitBreaker::getEndpointHealth(const EndpointIPtr& endpoint)
+{
+    if(!_enabled)
+    {
+        return 0;
+    }
+
+    EndpointIPtr key = normalize(endpoint);
+
+    IceUtil::Mutex::Lock sync(_mutex);
+#ifdef ICE_CPP11_MAPPING
+    auto p = _endpoints.find(key);
+#else
+    map<EndpointIPtr, EndpointHealthPtr>::iterator p = _endpoints.find(key);
+#endif
+    if(p == _endpoints.end())
+    {
+        if(_endpoints.size() >= maxEndpoints)
+        {
+#ifdef ICE_CPP11_MAPPING
+            for(auto q = _endpoints.begin(); q != _endpoints.end();)
+#else
+            for(map<EndpointIPtr, EndpointHealthPtr>::iterator q = _endpoints.begin(); q != _endpoints.end();)
+#endif
+            {
+                IceUtil::Mutex::Lock syncHealth(q->second->_mutex);
+                if(q->second->_ejectedUntil == IceUtil::Time())
+                {
+                    _endpoints.erase(q++);
+                }
+                else
+                {
+                    ++q;
+                }
+            }
+        }
+        p = _endpoints.insert(make_pair(key, new EndpointHealth(key->toString()))).first;
+    }
+    return p->second;
+}
+
+bool
+IceInternal::CircuitBreaker::isEjected(const EndpointIPtr& endpoint)
+{
+    if(!_enabled)
+    {
+        return false;
+    }
+
+    EndpointHealthPtr health;
+    {
+        EndpointIPtr key = normalize(endpoint);
+
+        IceUtil::Mutex::Lock sync(_mutex);
+#ifdef ICE_CPP11_MAPPING
+        auto p = _endpoints.find(key);
+#else
+        map<EndpointIPtr, EndpointHealthPtr>::const_iterator p = _endpoints.find(key);
+#endif
+        if(p == _endpoints.end())
+        {
+            return false;
+        }
+        health = p->second;
+    }
+
+    IceUtil::Mutex::Lock sync(health->_mutex);
+    return health->_ejectedUntil != IceUtil::Time() &&
+        IceUtil::Time::now(IceUtil::Time::Monotonic) < health->_ejectedUntil;
+}
+
+void
+IceInternal::CircuitBreaker::sortEndpoints(vector<EndpointIPtr>& endpoints)
+{
+    if(!_enabled || endpoints.size() < 2)
+    {
+        return;
+    }
+
+    //
+    // The ejected endpoints are moved last, the endpoints keep their
+    // order otherwise.
+    //
+    vector<EndpointIPtr> healthy;
+    vector<EndpointIPtr> ejected;
+    healthy.reserve(endpoints.size());
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        if(isEjected(*p))
+        {
+            ejected.push_back(*p);
+        }
+        else
+        {
+            healthy.push_back(*p);
+        }
+    }
+
+    if(!ejected.empty())
+    {
+        healthy.insert(healthy.end(), ejected.begin(), ejected.end());
+        endpoints.swap(healthy);
+    }
+}
+
+void
+IceInternal::CircuitBreaker::success(const EndpointIPtr& endpoint)
+{
+    if(_enabled)
+    {
+        success(getEndpointHealth(endpoint));
+    }
+}
+
+void
+IceInternal::CircuitBreaker::success(const EndpointHealthPtr& health)
+{
+    if(!health)
+    {
+        return;
+    }
+
+    IceUtil::Mutex::Lock sync(health->_mutex);
+    if(health->_ejectedUntil != IceUtil::Time())
+    {
+        if(IceUtil::Time::now(IceUtil::Time::Monotonic) < health->_ejectedUntil)
+        {
+            return; // The outcomes are ignored while the endpoint is ejected.
+        }
+
+        //
+        // The endpoint is half-open, it's healthy again.
+        //
+        health->_ejectedUntil = IceUtil::Time();
+        health->_ejections = 0;
+        if(_traceLevels->network >= 1)
+        {
+            Trace out(_logger, _traceLevels->networkCat);
+            out << "endpoint `" << health->_description << "' is healthy again";
+        }
+    }
+
+    health->_consecutiveFailures = 0;
+    addOutcome(*health, false);
+}
+
+void
+IceInternal::CircuitBreaker::failure(const EndpointIPtr& endpoint)
+{
+    if(_enabled)
+    {
+        failure(getEndpointHealth(endpoint));
+    }
+}
+
+void
+IceInternal::CircuitBreaker::failure(const EndpointHealthPtr& health)
+{
+    if(!health)
+    {
+        return;
+    }
+
+    IceUtil::Mutex::Lock sync(health->_mutex);
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    const char* reason;
+    if(health->_ejectedUntil != IceUtil::Time())
+    {
+        if(now < health->_ejectedUntil)
+        {
+            return; // The outcomes are ignored while the endpoint is ejected.
+        }
+        reason = "half-open endpoint failed";
+    }
+    else
+    {
+        ++health->_consecutiveFailures;
+        addOutcome(*health, true);
+
+        if(_maxFailures > 0 && health->_consecutiveFailures >= _maxFailures)
+        {
+            reason = "too many consecutive failures";
+        }
+        else if(_errorRate > 0 && health->_outcomes.size() >= minOutcomes &&
+                static_cast<size_t>(health->_failures * 100) >= _errorRate * health->_outcomes.size())
+        {
+            reason = "error rate too high";
+        }
+        else
+        {
+            return;
+        }
+    }
+
+    //
+    // Eject the endpoint, the backoff doubles with each ejection of
+    // the endpoint until it's healthy again.
+    //
+    IceUtil::Time backoff = _backoff;
+    for(int i = 0; i < health->_ejections && backoff < _maxBackoff; ++i)
+    {
+        backoff = backoff * 2;
+    }
+    backoff = min(backoff, _maxBackoff);
+
+    health->_ejectedUntil = now + backoff;
+    ++health->_ejections;
+    health->_consecutiveFailures = 0;
+    health->_outcomes.clear();
+    health->_next = 0;
+    health->_failures = 0;
+
+    if(_traceLevels->network >= 1)
+    {
+        Trace out(_logger, _traceLevels->networkCat);
+        out << "ejecting endpoint `" << health->_description << "' for " << backoff.toMilliSeconds() << "ms ("
+            << reason << ")";
+    }
+}
+
+void
+IceInternal::CircuitBreaker::addOutcome(EndpointHealth& health, bool failed)
+{
+    // This must be called with the health mutex locked.
+
+    if(health._outcomes.size() < windowSize)
+    {
+        health._outcomes.push_back(failed);
+    }
+    else
+    {
+        if(health._outcomes[health._next])
+        {
+            --health._failures;
+        }
+        health._outcomes[health._next] = failed;
+        health._next = (health._next + 1) % windowSize;
+    }
+
+    if(failed)
+    {
+        ++health._failures;
+    }
+}
@@ -0,0 +1,105 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CIRCUIT_BREAKER_H
+#define ICE_CIRCUIT_BREAKER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/CircuitBreakerF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/TraceLevelsF.h>
+#include <Ice/PropertiesF.h>
+#include <Ice/LoggerF.h>
+#include <Ice/Comparable.h>
+
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The health of an endpoint: the outcomes of the recent connection
+// establishments and invocations, and the ejection deadline of the
+// endpoint if it's ejected. The outgoing connections keep the health
+// of their endpoint to report the outcomes of their invocations.
+//
+class EndpointHealth : public IceUtil::Shared
+{
+public:
+
+    EndpointHealth(const std::string&);
+
+private:
+
+    friend class CircuitBreaker;
+
+    const std::string _description;
+
+    IceUtil::Mutex _mutex;
+    int _consecutiveFailures;
+    std::vector<bool> _outcomes;
+    size_t _next;
+    int _failures;
+    IceUtil::Time _ejectedUntil;
+    int _ejections;
+};
+
+//
+// The circuit breaker keeps the health of the endpoints of the
+// communicator. An endpoint is ejected for Ice.CircuitBreaker.Backoff
+// milliseconds after Ice.CircuitBreaker.Failures consecutive failures
+// or once the failures reach Ice.CircuitBreaker.ErrorRate percent of
+// its recent outcomes. The failures are the connection establishment
+// failures, the connection failures and the invocation timeouts.
+//
+// The ejected endpoints are tried last by the proxies and their
+// connections aren't reused if another endpoint is healthy. Once
+// the backoff expires, the endpoint is half-open: it's used again
+// and a success closes the circuit while a failure ejects it again
+// for twice the previous backoff, up to Ice.CircuitBreaker.MaxBackoff.
+//
+class CircuitBreaker : public IceUtil::Shared
+{
+public:
+
+    CircuitBreaker(const Ice::PropertiesPtr&, const Ice::LoggerPtr&, const TraceLevelsPtr&);
+
+    bool enabled() const { return _enabled; }
+
+    EndpointHealthPtr getEndpointHealth(const EndpointIPtr&);
+
+    bool isEjected(const EndpointIPtr&);
+    void sortEndpoints(std::vector<EndpointIPtr>&);
+
+    void success(const EndpointIPtr&);
+    void success(const EndpointHealthPtr&);
+    void failure(const EndpointIPtr&);
+    void failure(const EndpointHealthPtr&);
+
+private:
+
+    void addOutcome(EndpointHealth&, bool);
+
+    const Ice::LoggerPtr _logger;
+    const TraceLevelsPtr _traceLevels;
+    int _maxFailures;
+    size_t _errorRate;
+    IceUtil::Time _backoff;
+    IceUtil::Time _maxBackoff;
+    bool _enabled;
+
+    IceUtil::Mutex _mutex;
+#ifdef ICE_CPP11_MAPPING
+    std::map<EndpointIPtr, EndpointHealthPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _endpoints;
+#else
+    std::map<EndpointIPtr, EndpointHealthPtr> _endpoints;
+#endif
+};
+
+}
+
+#endif
@@ -0,0 +1,23 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CIRCUIT_BREAKER_F_H
+#define ICE_CIRCUIT_BREAKER_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class CircuitBreaker;
+IceUtil::Shared* upCast(CircuitBreaker*);
+typedef Handle<CircuitBreaker> CircuitBreakerPtr;
+
+class EndpointHealth;
+IceUtil::Shared* upCast(EndpointHealth*);
+typedef Handle<EndpointHealth> EndpointHealthPtr;
+
+}
+
+#endif
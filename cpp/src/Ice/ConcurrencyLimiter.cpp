@@ -0,0 +1,173 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/ConcurrencyLimiter.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(ConcurrencyLimiter* p) { return p; }
+
+namespace
+{
+
+//
+// The limit is multiplied by this ratio when a dispatch is too slow.
+//
+const double decreaseRatio = 0.9;
+
+}
+
+IceInternal::ConcurrencyLimiter::ConcurrencyLimiter(const InstancePtr& instance, const string& name) :
+    _dispatches(0)
+{
+    PropertiesPtr properties = instance->initializationData().properties;
+    LoggerPtr logger = instance->initializationData().logger;
+
+    int limit = properties->getPropertyAsInt(name + ".ConcurrencyLimit");
+    assert(limit > 0);
+
+    _limitMin = properties->getPropertyAsIntWithDefault(name + ".ConcurrencyLimit.Min", 1);
+    if(_limitMin < 1 || _limitMin > limit)
+    {
+        _limitMin = 1;
+        Warning out(logger);
+        out << "invalid value for " << name << ".ConcurrencyLimit.Min `"
+            << properties->getProperty(name + ".ConcurrencyLimit.Min") << "': defaulting to 1";
+    }
+
+    _limitMax = properties->getPropertyAsIntWithDefault(name + ".ConcurrencyLimit.Max", max(limit, 1000));
+    if(_limitMax < limit)
+    {
+        _limitMax = limit;
+        Warning out(logger);
+        out << "invalid value for " << name << ".ConcurrencyLimit.Max `"
+            << properties->getProperty(name + ".ConcurrencyLimit.Max") << "': defaulting to " << limit;
+    }
+
+    int latency = properties->getPropertyAsIntWithDefault(name + ".ConcurrencyLimit.Latency", 100);
+    if(latency < 1)
+    {
+        latency = 100;
+        Warning out(logger);
+        out << "invalid value for " << name << ".ConcurrencyLimit.Latency `"
+            << properties->getProperty(name + ".ConcurrencyLimit.Latency") << "': defaulting to 100";
+    }
+    _latency = IceUtil::Time::milliSeconds(latency);
+
+    _limit = limit;
+}
+
+ResponseHandlerPtr
+IceInternal::ConcurrencyLimiter::acquire(const ResponseHandlerPtr& handler)
+{
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_dispatches >= static_cast<int>(_limit))
+        {
+            return ICE_NULLPTR;
+        }
+        ++_dispatches;
+    }
+    return ICE_MAKE_SHARED(ConcurrencyLimitResponseHandler, this, handler);
+}
+
+void
+IceInternal::ConcurrencyLimiter::release(const IceUtil::Time& start)
+{
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(now - start > _latency)
+    {
+        //
+        // The dispatches started before the last decrease don't
+        // decrease the limit again, the limit is decreased at most
+        // once per dispatch latency.
+        //
+        if(start >= _lastDecrease)
+        {
+            _limit = max(static_cast<double>(_limitMin), _limit * decreaseRatio);
+            _lastDecrease = now;
+        }
+    }
+    else if(_dispatches * 2 >= static_cast<int>(_limit))
+    {
+        _limit = min(static_cast<double>(_limitMax), _limit + 1.0 / _limit);
+    }
+    --_dispatches;
+}
+
+int
+IceInternal::ConcurrencyLimiter::getLimit()
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    return static_cast<int>(_limit);
+}
+
+IceInternal::ConcurrencyLimitResponseHandler::ConcurrencyLimitResponseHandler(const ConcurrencyLimiterPtr& limiter,
+                                                                              const ResponseHandlerPtr& handler) :
+    _limiter(limiter),
+    _handler(handler),
+    _start(IceUtil::Time::now(IceUtil::Time::Monotonic)),
+    _released(false)
+{
+}
+
+IceInternal::ConcurrencyLimitResponseHandler::~ConcurrencyLimitResponseHandler()
+{
+    release();
+}
+
+void
+IceInternal::ConcurrencyLimitResponseHandler::sendResponse(Int requestId, OutputStream* os, Byte compress, bool amd)
+{
+    release();
+    _handler->sendResponse(requestId, os, compress, amd);
+}
+
+void
+IceInternal::ConcurrencyLimitResponseHandler::sendNoResponse()
+{
+    release();
+    _handler->sendNoResponse();
+}
+
+bool
+IceInternal::ConcurrencyLimitResponseHandler::systemException(Int requestId, const SystemException& ex, bool amd)
+{
+    if(_handler->systemException(requestId, ex, amd))
+    {
+        release();
+        return true;
+    }
+    return false;
+}
+
+void
+IceInternal::ConcurrencyLimitResponseHandler::invokeException(Int requestId, const LocalException& ex, int invokeNum,
+                                                              bool amd)
+{
+    release();
+    _handler->invokeException(requestId, ex, invokeNum, amd);
+}
+
+void
+IceInternal::ConcurrencyLimitResponseHandler::release()
+{
+    //
+    // The dispatch is released once, when its response is sent or
+    // when it fails.
+    //
+    if(!_released)
+    {
+        _released = true;
+        _limiter->release(_start);
+    }
+}
@@ -0,0 +1,83 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CONCURRENCY_LIMITER_H
+#define ICE_CONCURRENCY_LIMITER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/ConcurrencyLimiterF.h>
+#include <Ice/ResponseHandler.h>
+#include <Ice/InstanceF.h>
+
+namespace IceInternal
+{
+
+//
+// The concurrency limiter of an object adapter limits the number of
+// requests dispatched concurrently by the adapter, the requests over
+// the limit are rejected with ServerOverloadedException before their
+// parameters are unmarshaled.
+//
+// The limit starts at the <adapter>.ConcurrencyLimit property value
+// and adapts to the dispatch latency: it's reduced by 10% when a
+// dispatch takes longer than <adapter>.ConcurrencyLimit.Latency and
+// it grows by one for each limit worth of dispatches completed in
+// time while the adapter is at least half busy. The limit stays
+// between <adapter>.ConcurrencyLimit.Min and .Max.
+//
+class ConcurrencyLimiter : public IceUtil::Shared
+{
+public:
+
+    ConcurrencyLimiter(const InstancePtr&, const std::string&);
+
+    //
+    // Returns the response handler of the dispatch, which releases
+    // the dispatch once it's completed, or null if the limit is
+    // reached.
+    //
+    ResponseHandlerPtr acquire(const ResponseHandlerPtr&);
+    void release(const IceUtil::Time&);
+
+    int getLimit();
+
+private:
+
+    int _limitMin;
+    int _limitMax;
+    IceUtil::Time _latency;
+
+    IceUtil::Mutex _mutex;
+    double _limit;
+    int _dispatches;
+    IceUtil::Time _lastDecrease;
+};
+
+class ConcurrencyLimitResponseHandler : public ResponseHandler
+{
+public:
+
+    ConcurrencyLimitResponseHandler(const ConcurrencyLimiterPtr&, const ResponseHandlerPtr&);
+    virtual ~ConcurrencyLimitResponseHandler();
+
+    virtual void sendResponse(Ice::Int, Ice::OutputStream*, Ice::Byte, bool);
+    virtual void sendNoResponse();
+    virtual bool systemException(Ice::Int, const Ice::SystemException&, bool);
+    virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool);
+
+private:
+
+    void release();
+
+    const ConcurrencyLimiterPtr _limiter;
+    const ResponseHandlerPtr _handler;
+    const IceUtil::Time _start;
+    bool _released;
+};
+
+}
+
+#endif
@@ -16,6 +16,7 @@
 #include <Ice/ObjectAdapterI.h> // For getThreadPool().
 #include <Ice/Reference.h>
 #include <Ice/EndpointI.h>
+#include <Ice/CircuitBreaker.h>
 #include <Ice/RouterInfo.h>
 #include <Ice/LocalException.h>
 #include <Ice/Functional.h>
@@ -48,6 +49,14 @@ IceUtil::Shared* IceInternal::upCast(IncomingConnectionFactory* p) { return p; }
 namespace
 {
 
+//
+// With Ice.ConnectStaggerDelay, the connectors which failed during
+// the last 30 seconds are tried last. The connect statistics are
+// discarded if there are too many connectors.
+//
+const IceUtil::Time connectFailureExpiry = IceUtil::Time::seconds(30);
+const size_t connectStatsMax = 1000;
+
 #ifdef ICE_CPP11_MAPPING
 template <typename Map> void
 remove(Map& m, const typename Map::key_type& k, const typename Map::mapped_type& v)
@@ -418,6 +427,8 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _connectStaggerDelay(
+        instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.ConnectStaggerDelay", -1)),
     _destroyed(false),
     _pendingConnectCount(0)
 {
@@ -461,8 +472,22 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
 
     DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
     assert(!endpoints.empty());
+
+    //
+    // The ejected endpoints are sorted last, the connections to the
+    // ejected endpoints are only reused if the first endpoint is also
+    // ejected. A connection to a healthy endpoint is established
+    // otherwise.
+    //
+    const CircuitBreakerPtr& circuitBreaker = _instance->circuitBreaker();
+    bool skipEjected = circuitBreaker->enabled() && !circuitBreaker->isEjected(endpoints.front());
     for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
     {
+        if(skipEjected && circuitBreaker->isEjected(*p))
+        {
+            continue;
+        }
+
 #ifdef ICE_CPP11_MAPPING
         auto connection = find(_connectionsByEndpoint, *p,
                                [](const ConnectionIPtr& conn)
@@ -494,8 +519,16 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInf
     // This must be called with the mutex locked.
 
     DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
+    const CircuitBreakerPtr& circuitBreaker = _instance->circuitBreaker();
+    bool skipEjected = circuitBreaker->enabled() && !connectors.empty() &&
+        !circuitBreaker->isEjected(connectors.front().endpoint);
     for(vector<ConnectorInfo>::const_iterator p = connectors.begin(); p != connectors.end(); ++p)
     {
+        if(skipEjected && circuitBreaker->isEjected(p->endpoint))
+        {
+            continue; // See findConnection() above.
+        }
+
         if(_pending.find(p->connector) != _pending.end())
         {
             continue;
@@ -923,6 +956,116 @@ IceInternal::OutgoingConnectionFactory::handleConnectionException(const LocalExc
     }
 }
 
+void
+IceInternal::OutgoingConnectionFactory::orderConnectors(vector<ConnectorInfo>& connectors,
+                                                        Ice::EndpointSelectionType selType)
+{
+    if(_connectStaggerDelay < 0 || connectors.size() < 2)
+    {
+        return;
+    }
+
+    //
+    // The connectors which failed recently and the connectors of the
+    // endpoints ejected by the circuit breaker are tried last. With
+    // random endpoint selection, the connectors are also sorted by
+    // connect latency, the connectors which were never tried come first
+    // to get their latency measured. The connectors with the same key
+    // keep their order.
+    //
+    const CircuitBreakerPtr& circuitBreaker = _instance->circuitBreaker();
+    vector<pair<pair<bool, IceUtil::Time>, size_t> > keys;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(size_t i = 0; i < connectors.size(); ++i)
+        {
+            bool failed = circuitBreaker->isEjected(connectors[i].endpoint);
+            IceUtil::Time latency;
+            map<ConnectorPtr, ConnectStats>::const_iterator p = _connectStats.find(connectors[i].connector);
+            if(p != _connectStats.end())
+            {
+                failed = failed ||
+                    (p->second.failed != IceUtil::Time() && now - p->second.failed < connectFailureExpiry);
+                if(selType == Ice::ICE_ENUM(EndpointSelectionType, Random))
+                {
+                    latency = p->second.latency;
+                }
+            }
+            keys.push_back(make_pair(make_pair(failed, latency), i));
+        }
+    }
+    sort(keys.begin(), keys.end());
+
+    vector<ConnectorInfo> ordered;
+    ordered.reserve(connectors.size());
+    for(vector<pair<pair<bool, IceUtil::Time>, size_t> >::const_iterator p = keys.begin(); p != keys.end(); ++p)
+    {
+        ordered.push_back(connectors[p->second]);
+    }
+    connectors.swap(ordered);
+}
+
+void
+IceInternal::OutgoingConnectionFactory::connectSucceeded(const ConnectorPtr& connector, const IceUtil::Time& latency)
+{
+    if(_connectStaggerDelay < 0)
+    {
+        return;
+    }
+
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    ConnectStats& stats = connectStats(connector);
+    stats.latency = stats.latency == IceUtil::Time() ? latency : (stats.latency * 3 + latency) / 4;
+    stats.failed = IceUtil::Time();
+}
+
+void
+IceInternal::OutgoingConnectionFactory::connectCancelled(const ConnectorPtr& connector, const IceUtil::Time& elapsed)
+{
+    if(_connectStaggerDelay < 0)
+    {
+        return;
+    }
+
+    //
+    // The connector was slower than the connector which won the race,
+    // the elapsed time is a lower bound of its latency.
+    //
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    ConnectStats& stats = connectStats(connector);
+    stats.latency = max(stats.latency, elapsed);
+}
+
+void
+IceInternal::OutgoingConnectionFactory::connectFailed(const ConnectorPtr& connector)
+{
+    if(_connectStaggerDelay < 0)
+    {
+        return;
+    }
+
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    connectStats(connector).failed = IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+IceInternal::OutgoingConnectionFactory::ConnectStats&
+IceInternal::OutgoingConnectionFactory::connectStats(const ConnectorPtr& connector)
+{
+    // This must be called with the mutex locked.
+
+    map<ConnectorPtr, ConnectStats>::iterator p = _connectStats.find(connector);
+    if(p == _connectStats.end())
+    {
+        if(_connectStats.size() >= connectStatsMax)
+        {
+            _connectStats.clear();
+        }
+        p = _connectStats.insert(make_pair(connector, ConnectStats())).first;
+    }
+    return p->second;
+}
+
 IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const InstancePtr& instance,
                                                                          const OutgoingConnectionFactoryPtr& factory,
                                                                          const vector<EndpointIPtr>& endpoints,
@@ -934,7 +1077,8 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _done(false)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -945,21 +1089,55 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
-    if(_observer)
+    Attempt attempt;
+    map<ConnectionIPtr, Attempt> attempts;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        map<ConnectionIPtr, Attempt>::iterator p = _attempts.find(connection);
+        if(p == _attempts.end())
+        {
+            return; // The attempt was cancelled, the connection is closed by cancel().
+        }
+        attempt = p->second;
+        _attempts.erase(p);
+
+        //
+        // The first validated connection is used, the other attempts are cancelled.
+        //
+        _done = true;
+        _attempts.swap(attempts);
+    }
+
+    if(attempt.observer)
     {
-        _observer->detach();
+        attempt.observer->detach();
     }
+    _factory->connectSucceeded(attempt.connector.connector,
+                               IceUtil::Time::now(IceUtil::Time::Monotonic) - attempt.start);
+    _instance->circuitBreaker()->success(attempt.connector.endpoint);
+    cancel(attempts);
 
     connection->activate();
-    _factory->finishGetConnection(_connectors, *_iter, connection, ICE_SHARED_FROM_THIS);
+    _factory->finishGetConnection(_connectors, attempt.connector, connection, ICE_SHARED_FROM_THIS);
 }
 
 void
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& /*connection*/,
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& connection,
                                                                                const LocalException& ex)
 {
-    assert(_iter != _connectors.end());
-    if(connectionStartFailedImpl(ex))
+    Attempt attempt;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        map<ConnectionIPtr, Attempt>::iterator p = _attempts.find(connection);
+        if(p == _attempts.end())
+        {
+            return; // The attempt was cancelled.
+        }
+        attempt = p->second;
+        _attempts.erase(p);
+    }
+
+    if(connectionStartFailedImpl(attempt, ex))
     {
         nextConnector();
     }
@@ -988,6 +1166,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectors(const vector
         // We now have all the connectors for the given endpoints. We can try to obtain the
         // connection.
         //
+        _factory->orderConnectors(_connectors, _selType);
         _iter = _connectors.begin();
         getConnection();
     }
@@ -1007,6 +1186,7 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::exception(const Ice::Lo
         // We now have all the connectors for the given endpoints. We can try to obtain the
         // connection.
         //
+        _factory->orderConnectors(_connectors, _selType);
         _iter = _connectors.begin();
         getConnection();
     }
@@ -1090,44 +1270,78 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
     while(true)
     {
+        Attempt attempt;
+        Ice::ConnectionIPtr connection;
         try
         {
+            IceUtil::Mutex::Lock sync(_mutex);
+            if(_done || _iter == _connectors.end())
+            {
+                return; // The connection establishment is done or all the connectors are being tried.
+            }
+
+            Ice::Instrumentation::ObserverPtr observer;
             const CommunicatorObserverPtr& obsv = _factory->_instance->initializationData().observer;
             if(obsv)
             {
-                _observer = obsv->getConnectionEstablishmentObserver(_iter->endpoint, _iter->connector->toString());
-                if(_observer)
+                observer = obsv->getConnectionEstablishmentObserver(_iter->endpoint, _iter->connector->toString());
+                if(observer)
                 {
-                    _observer->attach();
+                    observer->attach();
                 }
             }
-
-            assert(_iter != _connectors.end());
+            attempt = Attempt(*_iter++, observer);
 
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "trying to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString();
+                out << "trying to establish " << attempt.connector.endpoint->protocol() << " connection to "
+                    << attempt.connector.connector->toString();
+            }
+
+            //
+            // The connection is created with the mutex locked to ensure
+            // it's either cancelled or used if another attempt completes.
+            //
+            connection = _factory->createConnection(attempt.connector.connector->connect(), attempt.connector);
+            _attempts.insert(make_pair(connection, attempt));
+
+            if(_factory->_connectStaggerDelay >= 0 && _iter != _connectors.end())
+            {
+                try
+                {
+                    IceUtil::TimerPtr timer = _instance->timer();
+                    timer->cancel(ICE_SHARED_FROM_THIS);
+                    timer->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(_factory->_connectStaggerDelay));
+                }
+                catch(const Ice::CommunicatorDestroyedException&)
+                {
+                    // The connection establishment is interrupted by the factory destruction.
+                }
+                catch(const IceUtil::IllegalArgumentException&)
+                {
+                    // The timer is destroyed.
+                }
             }
-            Ice::ConnectionIPtr connection = _factory->createConnection(_iter->connector->connect(), *_iter);
-            connection->start(ICE_SHARED_FROM_THIS);
         }
         catch(const Ice::LocalException& ex)
         {
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "failed to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString() << "\n" << ex;
+                out << "failed to establish " << attempt.connector.endpoint->protocol() << " connection to "
+                    << attempt.connector.connector->toString() << "\n" << ex;
             }
 
-            if(connectionStartFailedImpl(ex))
+            if(connectionStartFailedImpl(attempt, ex))
             {
                 continue; // More connectors to try, continue.
             }
+            return;
         }
-        break;
+
+        connection->start(ICE_SHARED_FROM_THIS);
+        return;
     }
 }
 
@@ -1186,29 +1400,91 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::operator<(const Connect
     return this < &rhs;
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::runTimerTask()
+{
+    //
+    // The stagger delay expired, try the next connector without
+    // waiting for the pending attempts to complete.
+    //
+    nextConnector();
+}
+
 bool
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(const Ice::LocalException& ex)
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(const Attempt& attempt,
+                                                                                   const Ice::LocalException& ex)
 {
-    if(_observer)
+    if(attempt.observer)
+    {
+        attempt.observer->failed(ex.ice_id());
+        attempt.observer->detach();
+    }
+    _factory->connectFailed(attempt.connector.connector);
+    if(!dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex))
     {
-        _observer->failed(ex.ice_id());
-        _observer->detach();
+        _instance->circuitBreaker()->failure(attempt.connector.endpoint);
+    }
+
+    bool more;
+    bool done = false;
+    map<ConnectionIPtr, Attempt> attempts;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_done)
+        {
+            return false; // Another attempt completed the connection establishment.
+        }
+
+        more = _iter != _connectors.end() || !_attempts.empty();
+        if(!more || dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
+        {
+            _done = true;
+            _attempts.swap(attempts);
+            done = true;
+        }
     }
 
-    _factory->handleConnectionException(ex, _hasMore || _iter != _connectors.end() - 1);
-    if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex)) // No need to continue.
+    _factory->handleConnectionException(ex, _hasMore || more);
+    if(done)
     {
+        cancel(attempts);
         _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        return false;
     }
-    else if(++_iter != _connectors.end()) // Try the next connector.
+    return true; // Try the next connector if there's one left, otherwise wait for the pending attempts.
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::cancel(const map<ConnectionIPtr, Attempt>& attempts)
+{
+    if(_factory->_connectStaggerDelay >= 0)
     {
-        return true;
+        try
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
     }
-    else
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(map<ConnectionIPtr, Attempt>::const_iterator p = attempts.begin(); p != attempts.end(); ++p)
     {
-        _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+        if(_instance->traceLevels()->network >= 2)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "cancelling " << p->second.connector.endpoint->protocol() << " connection establishment to "
+                << p->second.connector.connector->toString();
+        }
+
+        if(p->second.observer)
+        {
+            p->second.observer->detach();
+        }
+        _factory->connectCancelled(p->second.connector.connector, now - p->second.start);
+        p->first->close(ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
     }
-    return false;
 }
 
 void
@@ -7,6 +7,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -81,8 +82,16 @@ private:
         EndpointIPtr endpoint;
     };
 
+    //
+    // If Ice.ConnectStaggerDelay is set, the connect callback doesn't
+    // wait for a connection attempt to fail before trying the next
+    // connector: the next connector is also tried once the stagger
+    // delay expires. The first connection to be validated is used and
+    // the other attempts are closed.
+    //
     class ConnectCallback : public Ice::ConnectionI::StartCallback,
-                            public IceInternal::EndpointI_connectors
+                            public IceInternal::EndpointI_connectors,
+                            public IceUtil::TimerTask
 #ifdef ICE_CPP11_MAPPING
                           , public std::enable_shared_from_this<ConnectCallback>
 #endif
@@ -114,9 +123,28 @@ private:
 
         bool operator<(const ConnectCallback&) const;
 
+        virtual void runTimerTask();
+
     private:
 
-        bool connectionStartFailedImpl(const Ice::LocalException&);
+        struct Attempt
+        {
+            Attempt() : connector(ConnectorPtr(), EndpointIPtr())
+            {
+            }
+
+            Attempt(const ConnectorInfo& c, const Ice::Instrumentation::ObserverPtr& o) :
+                connector(c), observer(o), start(IceUtil::Time::now(IceUtil::Time::Monotonic))
+            {
+            }
+
+            ConnectorInfo connector;
+            Ice::Instrumentation::ObserverPtr observer;
+            IceUtil::Time start;
+        };
+
+        bool connectionStartFailedImpl(const Attempt&, const Ice::LocalException&);
+        void cancel(const std::map<Ice::ConnectionIPtr, Attempt>&);
 
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
@@ -124,10 +152,13 @@ private:
         const bool _hasMore;
         const CreateConnectionCallbackPtr _callback;
         const Ice::EndpointSelectionType _selType;
-        Ice::Instrumentation::ObserverPtr _observer;
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
+
+        IceUtil::Mutex _mutex;
         std::vector<ConnectorInfo>::const_iterator _iter;
+        std::map<Ice::ConnectionIPtr, Attempt> _attempts;
+        bool _done;
     };
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
@@ -150,9 +181,22 @@ private:
     void handleException(const Ice::LocalException&, bool);
     void handleConnectionException(const Ice::LocalException&, bool);
 
+    void orderConnectors(std::vector<ConnectorInfo>&, Ice::EndpointSelectionType);
+    void connectSucceeded(const ConnectorPtr&, const IceUtil::Time&);
+    void connectCancelled(const ConnectorPtr&, const IceUtil::Time&);
+    void connectFailed(const ConnectorPtr&);
+
+    struct ConnectStats
+    {
+        IceUtil::Time latency;
+        IceUtil::Time failed;
+    };
+    ConnectStats& connectStats(const ConnectorPtr&);
+
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const int _connectStaggerDelay;
     bool _destroyed;
 
     std::multimap<ConnectorPtr, Ice::ConnectionIPtr> _connections;
@@ -164,6 +208,7 @@ private:
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
 #endif
     int _pendingConnectCount;
+    std::map<ConnectorPtr, ConnectStats> _connectStats;
 };
 
 class IncomingConnectionFactory : public EventHandler,
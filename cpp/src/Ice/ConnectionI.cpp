@@ -15,6 +15,8 @@
 #include <Ice/ACM.h>
 #include <Ice/ObjectAdapterI.h> // For getThreadPool() and getServantManager().
 #include <Ice/EndpointI.h>
+#include <Ice/CircuitBreaker.h>
+#include <Ice/ConcurrencyLimiter.h>
 #include <Ice/OutgoingAsync.h>
 #include <Ice/Incoming.h>
 #include <Ice/LocalException.h>
@@ -22,6 +24,7 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
+#include <Ice/InstrumentationI.h> // For DispatchObserverI.
 
 #ifdef ICE_HAS_BZIP2
 #  include <bzlib.h>
@@ -128,6 +131,133 @@ private:
     const bool _close;
 };
 
+class QueuedDispatchCall : public QueuedDispatchWorkItem
+{
+public:
+
+    QueuedDispatchCall(const ConnectionIPtr& connection, int priority, Byte compress, Int requestId,
+                       const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                       const DispatchObserverPtr& observer, InputStream& stream) :
+        QueuedDispatchWorkItem(connection, priority),
+        _connection(connection),
+        _compress(compress),
+        _requestId(requestId),
+        _servantManager(servantManager),
+        _adapter(adapter),
+        _observer(observer),
+        _stream(stream.instance(), currentProtocolEncoding)
+    {
+        _stream.swap(stream);
+    }
+
+    virtual void
+    run()
+    {
+        dequeued();
+        _connection->invokeQueued(_stream, _requestId, _compress, _servantManager, _adapter, _observer,
+                                  getQueueTime(), 0);
+    }
+
+    virtual void
+    reject(const string& reason)
+    {
+        dequeued();
+        ServerOverloadedException ex(__FILE__, __LINE__);
+        ex.reason = reason;
+        _connection->invokeQueued(_stream, _requestId, _compress, _servantManager, _adapter, _observer,
+                                  getQueueTime(), &ex);
+    }
+
+private:
+
+    void
+    dequeued()
+    {
+        DispatchObserverI* observer = dynamic_cast<DispatchObserverI*>(_observer.get());
+        if(observer)
+        {
+            observer->dequeued((IceUtil::Time::now(IceUtil::Time::Monotonic) - getQueueTime()).toMicroSeconds());
+        }
+    }
+
+    const ConnectionIPtr _connection;
+    const Byte _compress;
+    const Int _requestId;
+    const ServantManagerPtr _servantManager;
+    const ObjectAdapterPtr _adapter;
+    const DispatchObserverPtr _observer;
+    InputStream _stream;
+};
+
+//
+// Read the header of a request to get its priority and to obtain its
+// dispatch observer before it's queued, the request is read again when
+// it's dispatched. Returns null if the header can't be read, the
+// request is dispatched right away to report the failure.
+//
+QueuedDispatchWorkItemPtr
+createQueuedDispatch(const ConnectionIPtr& connection, const InstancePtr& instance, const DispatchQueuePtr& queue,
+                     Byte compress, Int requestId, const ServantManagerPtr& servantManager,
+                     const ObjectAdapterPtr& adapter, InputStream& stream)
+{
+    Current current;
+    current.adapter = adapter;
+    current.con = connection;
+    current.requestId = requestId;
+
+    InputStream::Container::iterator start = stream.i;
+    int priority;
+    DispatchObserverPtr observer;
+    try
+    {
+        stream.read(current.id);
+        vector<string> facetPath;
+        stream.read(facetPath);
+        if(!facetPath.empty())
+        {
+            current.facet = facetPath[0];
+        }
+        stream.read(current.operation, false);
+        Byte mode;
+        stream.read(mode);
+        current.mode = static_cast<OperationMode>(mode);
+        stream.read(current.ctx);
+
+        priority = queue->getPriority(current.operation, current.ctx);
+
+        const CommunicatorObserverPtr& obsv = instance->initializationData().observer;
+        if(obsv)
+        {
+            Int encapsSize;
+            stream.read(encapsSize);
+
+            //
+            // The priority is added to the context given to the
+            // observer, the metrics can be grouped by context._priority.
+            //
+            ostringstream os;
+            os << priority;
+            current.ctx["_priority"] = os.str();
+            observer = obsv->getDispatchObserver(current, static_cast<Int>(stream.i - start) - 4 + encapsSize);
+
+            DispatchObserverI* observerI = dynamic_cast<DispatchObserverI*>(observer.get());
+            if(observerI)
+            {
+                observerI->queued();
+            }
+        }
+    }
+    catch(const LocalException&)
+    {
+        stream.i = start;
+        return 0;
+    }
+    stream.i = start;
+
+    return new QueuedDispatchCall(connection, priority, compress, requestId, servantManager, adapter, observer,
+                                  stream);
+}
+
 //
 // Class for handling Ice::Connection::begin_flushBatchRequests
 //
@@ -553,6 +683,13 @@ Ice::ConnectionI::isFinished() const
     return true;
 }
 
+size_t
+Ice::ConnectionI::getPendingRequestCount() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    return _asyncRequests.size() + _sendStreams.size();
+}
+
 void
 Ice::ConnectionI::throwException() const
 {
@@ -618,13 +755,13 @@ Ice::ConnectionI::updateObserver()
     _observer.attach(o);
 }
 
-void
+IceUtil::Time
 Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
 {
     IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
     if(_state != StateActive)
     {
-        return;
+        return now + acm.timeout / 2;
     }
     assert(acm.timeout != IceUtil::Time());
 
@@ -650,6 +787,27 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
         }
     }
 
+    //
+    // Compute when the connection needs to be monitored again. If the
+    // connection can't need a heartbeat or be closed before its next
+    // activity, it's not monitored until this activity, see
+    // updateLastActivity().
+    //
+    IceUtil::Time next;
+    if(acm.heartbeat == ICE_ENUM(ACMHeartbeat, HeartbeatAlways))
+    {
+        next = now + acm.timeout / 2;
+    }
+    else if(acm.heartbeat != ICE_ENUM(ACMHeartbeat, HeartbeatOff) &&
+            (acm.heartbeat != ICE_ENUM(ACMHeartbeat, HeartbeatOnDispatch) || _dispatchCount > 0))
+    {
+        next = _acmLastActivity + acm.timeout / 4;
+        if(next <= now)
+        {
+            next = now + acm.timeout / 4; // Sending a heartbeat or another message.
+        }
+    }
+
     if(static_cast<Int>(_readStream.b.size()) > headerSize || !_writeStream.b.empty())
     {
         //
@@ -658,29 +816,50 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
         // This check is necessary because the actitivy timer is
         // only set when a message is fully read/written.
         //
-        return;
+        _acmWaitForActivity = next == IceUtil::Time();
+        return next;
     }
 
-    if(acm.close != ICE_ENUM(ACMClose, CloseOff) && now >= (_acmLastActivity + acm.timeout))
+    if(acm.close != ICE_ENUM(ACMClose, CloseOff))
     {
-        if(acm.close == ICE_ENUM(ACMClose, CloseOnIdleForceful) ||
-           (acm.close != ICE_ENUM(ACMClose, CloseOnIdle) && !_asyncRequests.empty()))
+        IceUtil::Time closeTime = _acmLastActivity + acm.timeout;
+        if(now >= closeTime)
         {
-            //
-            // Close the connection if we didn't receive a heartbeat in
-            // the last period.
-            //
-            setState(StateClosed, ConnectionTimeoutException(__FILE__, __LINE__));
+            if(acm.close == ICE_ENUM(ACMClose, CloseOnIdleForceful) ||
+               (acm.close != ICE_ENUM(ACMClose, CloseOnIdle) && !_asyncRequests.empty()))
+            {
+                //
+                // Close the connection if we didn't receive a heartbeat in
+                // the last period.
+                //
+                setState(StateClosed, ConnectionTimeoutException(__FILE__, __LINE__));
+                return IceUtil::Time();
+            }
+            else if(acm.close != ICE_ENUM(ACMClose, CloseOnInvocation) &&
+                    _dispatchCount == 0 && _batchRequestQueue->isEmpty() && _asyncRequests.empty())
+            {
+                //
+                // The connection is idle, close it.
+                //
+                setState(StateClosing, ConnectionTimeoutException(__FILE__, __LINE__));
+                return IceUtil::Time();
+            }
+            closeTime = now + acm.timeout / 2; // Not idle, check again with the next period.
         }
-        else if(acm.close != ICE_ENUM(ACMClose, CloseOnInvocation) &&
-                _dispatchCount == 0 && _batchRequestQueue->isEmpty() && _asyncRequests.empty())
+
+        //
+        // With CloseOnInvocation, the connection can only be closed
+        // once a request is sent and sending a request is an activity.
+        //
+        if((acm.close != ICE_ENUM(ACMClose, CloseOnInvocation) || !_asyncRequests.empty()) &&
+           (next == IceUtil::Time() || closeTime < next))
         {
-            //
-            // The connection is idle, close it.
-            //
-            setState(StateClosing, ConnectionTimeoutException(__FILE__, __LINE__));
+            next = closeTime;
         }
     }
+
+    _acmWaitForActivity = next == IceUtil::Time();
+    return next;
 }
 
 AsyncStatus
@@ -1160,6 +1339,7 @@ Ice::ConnectionI::setACM(const IceUtil::Optional<int>& timeout,
         _monitor->remove(ICE_SHARED_FROM_THIS);
     }
     _monitor = _monitor->acm(timeout, close, heartbeat);
+    _acmWaitForActivity = false;
 
     if(_monitor->getACM().timeout <= 0)
     {
@@ -1200,6 +1380,11 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         return; // The request has already been or will be shortly notified of the failure.
     }
 
+    if(_health && dynamic_cast<const Ice::InvocationTimeoutException*>(&ex))
+    {
+        _instance->circuitBreaker()->failure(_health);
+    }
+
     for(deque<OutgoingMessage>::iterator o = _sendStreams.begin(); o != _sendStreams.end(); ++o)
     {
         if(o->outAsync.get() == outAsync.get())
@@ -1784,10 +1969,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 }
             }
 
-            if(_acmLastActivity != IceUtil::Time())
-            {
-                _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
-            }
+            updateLastActivity();
 
             if(dispatchCount == 0)
             {
@@ -1835,17 +2017,40 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         }
     }
 
-    if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
+    //
+    // If the thread pool has a dispatch queue, the request is queued
+    // and dispatched by priority. The batch requests aren't queued.
+    //
+    QueuedDispatchWorkItemPtr queued;
+    if(invokeNum == 1 && _threadPool->getDispatchQueue())
     {
-        dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
-                 current.stream);
+        queued = createQueuedDispatch(ICE_SHARED_FROM_THIS, _instance, _threadPool->getDispatchQueue(), compress,
+                                      requestId, servantManager, adapter, current.stream);
+        if(queued)
+        {
+            invokeNum = 0;
+        }
     }
-    else
+
+    if(!queued || startCB || !sentCBs.empty() || outAsync || heartbeatCallback)
     {
-        _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
-                                                             invokeNum, servantManager, adapter, outAsync,
-                                                             heartbeatCallback, current.stream));
+        if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
+        {
+            dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync,
+                     heartbeatCallback, current.stream);
+        }
+        else
+        {
+            _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress,
+                                                                 requestId, invokeNum, servantManager, adapter,
+                                                                 outAsync, heartbeatCallback, current.stream));
 
+        }
+    }
+
+    if(queued)
+    {
+        _threadPool->dispatchQueued(queued);
     }
 }
 
@@ -2237,6 +2442,7 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _type(transceiver->protocol()),
     _connector(connector),
     _endpoint(endpoint),
+    _health(connector ? _instance->circuitBreaker()->getEndpointHealth(endpoint) : EndpointHealthPtr()),
     _adapter(adapter),
     _dispatcher(_instance->initializationData().dispatcher), // Cached for better performance.
     _logger(_instance->initializationData().logger), // Cached for better performance.
@@ -2248,6 +2454,7 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _readTimeoutScheduled(false),
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
+    _acmWaitForActivity(false),
     _compressionLevel(1),
     _nextRequestId(1),
     _asyncRequestsHint(_asyncRequests.end()),
@@ -2360,6 +2567,21 @@ Ice::ConnectionI::setState(State state, const LocalException& ex)
                 out << "connection exception:\n" << ex << '\n' << _desc;
             }
         }
+
+        //
+        // Report the failure of an established outgoing connection to
+        // the circuit breaker. The graceful closures and the closure of
+        // idle connections aren't failures.
+        //
+        if(_health && _validated && _state < StateClosing &&
+           !(dynamic_cast<const CloseConnectionException*>(&ex) ||
+             dynamic_cast<const ConnectionManuallyClosedException*>(&ex) ||
+             dynamic_cast<const CommunicatorDestroyedException*>(&ex) ||
+             dynamic_cast<const ObjectAdapterDeactivatedException*>(&ex) ||
+             (dynamic_cast<const ConnectionTimeoutException*>(&ex) && state == StateClosing)))
+        {
+            _instance->circuitBreaker()->failure(_health);
+        }
     }
 
     //
@@ -2507,6 +2729,7 @@ Ice::ConnectionI::setState(State state)
             {
                 _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
             }
+            _acmWaitForActivity = false;
             _monitor->add(ICE_SHARED_FROM_THIS);
         }
         else if(_state == StateActive)
@@ -2632,6 +2855,24 @@ Ice::ConnectionI::sendHeartbeatNow()
     }
 }
 
+void
+Ice::ConnectionI::updateLastActivity()
+{
+    //
+    // Called with the connection locked. The connection monitor is
+    // only notified if it waits for the activity of this connection.
+    //
+    if(_acmLastActivity != IceUtil::Time())
+    {
+        _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(_acmWaitForActivity)
+        {
+            _acmWaitForActivity = false;
+            _monitor->activity(ICE_SHARED_FROM_THIS);
+        }
+    }
+}
+
 bool
 Ice::ConnectionI::initialize(SocketOperation operation)
 {
@@ -2994,10 +3235,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
             {
                 status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
             }
-            if(_acmLastActivity != IceUtil::Time())
-            {
-                _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
-            }
+            updateLastActivity();
             return status;
         }
 
@@ -3048,10 +3286,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
             {
                 status = static_cast<AsyncStatus>(status | AsyncStatusInvokeSentCallback);
             }
-            if(_acmLastActivity != IceUtil::Time())
-            {
-                _acmLastActivity = IceUtil::Time::now(IceUtil::Time::Monotonic);
-            }
+            updateLastActivity();
             return status;
         }
 
@@ -3358,6 +3593,11 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
                 if(q != _asyncRequests.end())
                 {
+                    if(_health)
+                    {
+                        _instance->circuitBreaker()->success(_health);
+                    }
+
                     outAsync = q->second;
 
                     if(q == _asyncRequestsHint)
@@ -3464,12 +3704,11 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
             bool response = !_endpoint->datagram() && requestId != 0;
             assert(!response || invokeNum == 1);
 
-            Incoming in(_instance.get(), this, this, adapter, response, compress, requestId);
-
             //
             // Dispatch the invocation.
             //
-            in.invoke(servantManager, &stream);
+            invokeRequest(stream, response, requestId, compress, servantManager, adapter, ICE_NULLPTR, IceUtil::Time(),
+                          0);
 
             --invokeNum;
         }
@@ -3482,6 +3721,82 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
     }
 }
 
+void
+Ice::ConnectionI::invokeQueued(InputStream& stream, Int requestId, Byte compress,
+                               const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                               const DispatchObserverPtr& observer, const IceUtil::Time& receivedTime,
+                               const LocalException* rejection)
+{
+    //
+    // Note: must be called *without* the mutex locked, the request is
+    // rejected with the given exception if not null.
+    //
+
+    try
+    {
+        bool response = !_endpoint->datagram() && requestId != 0;
+        invokeRequest(stream, response, requestId, compress, servantManager, adapter, observer, receivedTime,
+                      rejection);
+        stream.clear();
+    }
+    catch(const LocalException& ex)
+    {
+        invokeException(requestId, ex, 1, false);  // Fatal invocation exception
+    }
+}
+
+void
+Ice::ConnectionI::invokeRequest(InputStream& stream, bool response, Int requestId, Byte compress,
+                                const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                                const DispatchObserverPtr& observer, const IceUtil::Time& receivedTime,
+                                const LocalException* rejection)
+{
+    //
+    // The request is dispatched with the response handler of the
+    // adapter concurrency limiter if the adapter limits its dispatches,
+    // it's rejected if the limit is reached.
+    //
+    ResponseHandlerPtr handler;
+    ConcurrencyLimiterPtr limiter;
+    if(!rejection && adapter)
+    {
+        limiter = dynamic_cast<ObjectAdapterI*>(adapter.get())->getConcurrencyLimiter();
+        if(limiter)
+        {
+            handler = limiter->acquire(ICE_SHARED_FROM_THIS);
+        }
+    }
+
+    Incoming in(_instance.get(), handler ? handler.get() : this, this, adapter, response, compress, requestId);
+    if(observer)
+    {
+        in.setObserver(observer);
+    }
+    if(receivedTime != IceUtil::Time())
+    {
+        in.setReceivedTime(receivedTime);
+    }
+    if(limiter)
+    {
+        in.setConcurrencyLimit(limiter->getLimit());
+    }
+
+    if(rejection)
+    {
+        in.reject(&stream, *rejection);
+    }
+    else if(limiter && !handler)
+    {
+        ServerOverloadedException ex(__FILE__, __LINE__);
+        ex.reason = "concurrency limit of object adapter `" + adapter->getName() + "' reached";
+        in.reject(&stream, ex);
+    }
+    else
+    {
+        in.invoke(servantManager, &stream);
+    }
+}
+
 void
 Ice::ConnectionI::scheduleTimeout(SocketOperation status)
 {
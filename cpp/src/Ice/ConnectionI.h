@@ -22,6 +22,7 @@
 #include <Ice/ServantManagerF.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/ConnectorF.h>
+#include <Ice/CircuitBreakerF.h>
 #include <Ice/LoggerF.h>
 #include <Ice/TraceLevelsF.h>
 #include <Ice/OutgoingAsync.h>
@@ -155,6 +156,7 @@ public:
 
     bool isActiveOrHolding() const;
     bool isFinished() const;
+    size_t getPendingRequestCount() const; // Requests being sent or waiting for a reply.
 
     virtual void throwException() const; // From Connection. Throws the connection exception if destroyed.
 
@@ -163,7 +165,7 @@ public:
 
     void updateObserver();
 
-    void monitor(const IceUtil::Time&, const IceInternal::ACMConfig&);
+    IceUtil::Time monitor(const IceUtil::Time&, const IceInternal::ACMConfig&);
 
     IceInternal::AsyncStatus sendAsyncRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool, int);
 
@@ -250,6 +252,8 @@ public:
                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
                   const IceInternal::OutgoingAsyncBasePtr&,
                   const ICE_DELEGATE(HeartbeatCallback)&, Ice::InputStream&);
+    void invokeQueued(Ice::InputStream&, Int, Byte, const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
+                      const Ice::Instrumentation::DispatchObserverPtr&, const IceUtil::Time&, const LocalException*);
     void finish(bool);
 
     void closeCallback(const ICE_DELEGATE(CloseCallback)&);
@@ -287,6 +291,7 @@ private:
 
     void initiateShutdown();
     void sendHeartbeatNow();
+    void updateLastActivity();
 
     bool initialize(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
@@ -304,6 +309,9 @@ private:
 
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
                    const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
+    void invokeRequest(Ice::InputStream&, bool, Int, Byte,
+                       const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
+                       const Ice::Instrumentation::DispatchObserverPtr&, const IceUtil::Time&, const LocalException*);
 
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
@@ -331,6 +339,7 @@ private:
     const std::string _type;
     const IceInternal::ConnectorPtr _connector;
     const IceInternal::EndpointIPtr _endpoint;
+    const IceInternal::EndpointHealthPtr _health;
 
     mutable Ice::ConnectionInfoPtr _info;
 
@@ -354,6 +363,7 @@ private:
     const bool _warnUdp;
 
     IceUtil::Time _acmLastActivity;
+    bool _acmWaitForActivity;
 
     const int _compressionLevel;
 
@@ -0,0 +1,250 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/ConnectionPoolRequestHandler.h>
+#include <Ice/ConnectRequestHandler.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/Proxy.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace IceInternal;
+
+ConnectionPoolRequestHandler::ConnectionPoolRequestHandler(const RoutableReferencePtr& ref) :
+    RequestHandler(ref),
+    _routableReference(ref),
+    _size(static_cast<size_t>(ref->getConnectionPoolSize())),
+    _next(0)
+{
+    assert(_size > 1);
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::update(const RequestHandlerPtr& previousHandler, const RequestHandlerPtr& newHandler)
+{
+    return previousHandler.get() == this ? newHandler : ICE_SHARED_FROM_THIS;
+}
+
+AsyncStatus
+ConnectionPoolRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    ConnectRequestHandlerPtr handler;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        handler = selectHandler();
+    }
+
+    try
+    {
+        return handler->sendAsyncRequest(out);
+    }
+    catch(const RetryException&)
+    {
+        removeSlot(handler);
+        throw;
+    }
+    catch(const Ice::LocalException&)
+    {
+        removeSlot(handler);
+        throw;
+    }
+}
+
+void
+ConnectionPoolRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&)
+{
+    //
+    // Not called, the requests are canceled by the connect request
+    // handler or the connection which queued them.
+    //
+    assert(false);
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::getConnection()
+{
+    ConnectRequestHandlerPtr handler;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        for(vector<Slot>::const_iterator p = _slots.begin(); p != _slots.end(); ++p)
+        {
+            try
+            {
+                Ice::ConnectionIPtr connection = p->handler->getConnection();
+                if(connection)
+                {
+                    return connection;
+                }
+            }
+            catch(const Ice::LocalException&)
+            {
+                handler = p->handler;
+            }
+        }
+    }
+
+    //
+    // Raise the connection establishment failure if none of the
+    // connections are established.
+    //
+    if(handler)
+    {
+        return handler->getConnection();
+    }
+    return ICE_NULLPTR;
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::waitForConnection()
+{
+    ConnectRequestHandlerPtr handler;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        handler = selectHandler();
+    }
+    return handler->waitForConnection();
+}
+
+ConnectRequestHandlerPtr
+ConnectionPoolRequestHandler::selectHandler()
+{
+    //
+    // Must be called with the mutex locked.
+    //
+    // Use the established connection with the fewest pending
+    // requests. A new connection is added to the pool if all the
+    // established connections are busy and no connection is being
+    // established. The connection establishment failures are only
+    // returned if no other connection is usable, the failed slots
+    // are removed when a request fails.
+    //
+    ConnectRequestHandlerPtr best;
+    size_t bestLoad = 0;
+    ConnectRequestHandlerPtr pending;
+    ConnectRequestHandlerPtr failed;
+    for(size_t i = 0; i < _slots.size(); ++i)
+    {
+        const ConnectRequestHandlerPtr& handler = _slots[(_next + i) % _slots.size()].handler;
+        try
+        {
+            Ice::ConnectionIPtr connection = handler->getConnection();
+            if(!connection)
+            {
+                if(!pending)
+                {
+                    pending = handler;
+                }
+                continue;
+            }
+
+            size_t load = connection->getPendingRequestCount();
+            if(!best || load < bestLoad)
+            {
+                best = handler;
+                bestLoad = load;
+                if(load == 0)
+                {
+                    break;
+                }
+            }
+        }
+        catch(const Ice::LocalException&)
+        {
+            if(!failed)
+            {
+                failed = handler;
+            }
+        }
+    }
+
+    if(!_slots.empty())
+    {
+        _next = (_next + 1) % _slots.size();
+    }
+
+    if(!pending && (!best || bestLoad > 0) && _slots.size() < _size)
+    {
+        ConnectRequestHandlerPtr handler = addSlot();
+        if(!best)
+        {
+            return handler;
+        }
+    }
+
+    if(best)
+    {
+        return best;
+    }
+    else if(pending)
+    {
+        return pending;
+    }
+    else
+    {
+        assert(failed);
+        return failed;
+    }
+}
+
+ConnectRequestHandlerPtr
+ConnectionPoolRequestHandler::addSlot()
+{
+    //
+    // Must be called with the mutex locked.
+    //
+    // The connection IDs of the slots are derived from the proxy
+    // connection ID, the index of a removed slot is reused to get
+    // a new connection in place of the failed one.
+    //
+    int index = 0;
+    for(bool found = true; found; )
+    {
+        found = false;
+        for(vector<Slot>::const_iterator p = _slots.begin(); p != _slots.end(); ++p)
+        {
+            if(p->index == index)
+            {
+                found = true;
+                ++index;
+                break;
+            }
+        }
+    }
+
+    RoutableReferencePtr ref = _routableReference;
+    if(index > 0)
+    {
+        ostringstream os;
+        os << _routableReference->getConnectionId() << "#" << index;
+        ref = RoutableReferencePtr::dynamicCast(_routableReference->changeConnectionId(os.str()));
+    }
+
+    Slot slot;
+    slot.index = index;
+    slot.handler = ICE_MAKE_SHARED(ConnectRequestHandler, ref, ICE_NULLPTR);
+    _slots.push_back(slot);
+
+#ifdef ICE_CPP11_MAPPING
+    ref->getConnection(slot.handler);
+#else
+    ref->getConnection(slot.handler.get());
+#endif
+    return slot.handler;
+}
+
+void
+ConnectionPoolRequestHandler::removeSlot(const ConnectRequestHandlerPtr& handler)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    for(vector<Slot>::iterator p = _slots.begin(); p != _slots.end(); ++p)
+    {
+        if(p->handler.get() == handler.get())
+        {
+            _slots.erase(p);
+            break;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+#define ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+
+#include <IceUtil/Mutex.h>
+#include <Ice/RequestHandler.h>
+#include <Ice/ConnectRequestHandlerF.h>
+#include <Ice/Reference.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The connection pool request handler spreads the invocations of a
+// proxy over up to Ice.Default.ConnectionPoolSize connections (or the
+// ConnectionPoolSize proxy property). Each connection of the pool is
+// obtained with a distinct connection ID derived from the proxy
+// connection ID, the connections are established on demand when all
+// the established connections have pending requests.
+//
+class ConnectionPoolRequestHandler ICE_FINAL : public RequestHandler
+#ifdef ICE_CPP11_MAPPING
+                                   , public std::enable_shared_from_this<ConnectionPoolRequestHandler>
+#endif
+{
+public:
+
+    ConnectionPoolRequestHandler(const RoutableReferencePtr&);
+
+    virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
+
+    virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
+
+    virtual Ice::ConnectionIPtr getConnection();
+    virtual Ice::ConnectionIPtr waitForConnection();
+
+private:
+
+    struct Slot
+    {
+        int index;
+        ConnectRequestHandlerPtr handler;
+    };
+
+    ConnectRequestHandlerPtr selectHandler();
+    ConnectRequestHandlerPtr addSlot();
+    void removeSlot(const ConnectRequestHandlerPtr&);
+
+    const RoutableReferencePtr _routableReference;
+    const size_t _size;
+
+    IceUtil::Mutex _mutex;
+    std::vector<Slot> _slots;
+    size_t _next;
+};
+
+}
+
+#endif
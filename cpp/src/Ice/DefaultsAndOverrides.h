@@ -31,6 +31,8 @@ public:
     int defaultTimeout;
     int defaultInvocationTimeout;
     int defaultLocatorCacheTimeout;
+    int defaultConnectionPoolSize;
+    bool defaultHedge;
     bool defaultPreferSecure;
     Ice::EncodingVersion defaultEncoding;
     Ice::FormatType defaultFormat;
@@ -0,0 +1,152 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/DispatchDeadline.h>
+#include <Ice/Object.h>
+#include <IceUtil/ThreadException.h>
+
+#include <sstream>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifdef _WIN32
+DWORD key;
+#else
+pthread_key_t key;
+#endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#ifdef _WIN32
+        key = TlsAlloc();
+        if(key == TLS_OUT_OF_INDEXES)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+        }
+#else
+        int err = pthread_key_create(&key, 0);
+        if(err != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+#endif
+    }
+
+    ~Init()
+    {
+#ifdef _WIN32
+        TlsFree(key);
+#else
+        pthread_key_delete(key);
+#endif
+    }
+};
+
+Init init;
+
+void
+setThreadDeadline(const DispatchDeadline* deadline)
+{
+#ifdef _WIN32
+    if(TlsSetValue(key, const_cast<DispatchDeadline*>(deadline)) == 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+    }
+#else
+    int err = pthread_setspecific(key, deadline);
+    if(err != 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+    }
+#endif
+}
+
+}
+
+IceInternal::DispatchDeadline::DispatchDeadline(const Current& current, const IceUtil::Time& deadline) :
+    _current(current),
+    _deadline(deadline),
+    _previous(0)
+{
+    if(_deadline != IceUtil::Time())
+    {
+        _previous = get();
+        setThreadDeadline(this);
+    }
+}
+
+IceInternal::DispatchDeadline::~DispatchDeadline()
+{
+    if(_deadline != IceUtil::Time())
+    {
+        setThreadDeadline(_previous);
+    }
+}
+
+const DispatchDeadline*
+IceInternal::DispatchDeadline::get()
+{
+#ifdef _WIN32
+    return static_cast<const DispatchDeadline*>(TlsGetValue(key));
+#else
+    return static_cast<const DispatchDeadline*>(pthread_getspecific(key));
+#endif
+}
+
+IceUtil::Time
+IceInternal::DispatchDeadline::parse(const Context& context, const IceUtil::Time& receivedTime)
+{
+    Context::const_iterator p = context.find("_deadline");
+    if(p != context.end())
+    {
+        istringstream value(p->second);
+        Long remaining;
+        if(value >> remaining && remaining >= 0)
+        {
+            IceUtil::Time received = receivedTime;
+            if(received == IceUtil::Time())
+            {
+                received = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            }
+            return received + IceUtil::Time::milliSeconds(remaining);
+        }
+    }
+    return IceUtil::Time();
+}
+
+Int
+Ice::getRemainingTime(const Current& current)
+{
+    const DispatchDeadline* deadline = DispatchDeadline::get();
+    if(deadline && &deadline->getCurrent() == &current)
+    {
+        IceUtil::Time remaining = deadline->getDeadline() - IceUtil::Time::now(IceUtil::Time::Monotonic);
+        return static_cast<Int>(max(remaining.toMilliSeconds(), static_cast<IceUtil::Int64>(0)));
+    }
+
+    Context::const_iterator p = current.ctx.find("_deadline");
+    if(p != current.ctx.end())
+    {
+        istringstream value(p->second);
+        Int remaining;
+        if(value >> remaining && remaining >= 0)
+        {
+            return remaining;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,68 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_DISPATCH_DEADLINE_H
+#define ICE_DISPATCH_DEADLINE_H
+
+#include <IceUtil/Time.h>
+#include <Ice/Current.h>
+
+namespace IceInternal
+{
+
+//
+// The deadline of the request dispatched by a thread. The deadline
+// of a request is the remaining time given by its _deadline context
+// entry, in milliseconds, from the time the request is received.
+//
+// The dispatch deadline is set for the calling thread while the
+// request is dispatched, the invocations made by this thread inherit
+// the deadline: their invocation timeout is shortened to the remaining
+// time of the dispatch.
+//
+class DispatchDeadline
+{
+public:
+
+    //
+    // Sets the deadline of the calling thread until the destruction
+    // of the dispatch deadline, nothing is set if the deadline is
+    // IceUtil::Time().
+    //
+    DispatchDeadline(const Ice::Current&, const IceUtil::Time&);
+    ~DispatchDeadline();
+
+    //
+    // Returns the dispatch deadline of the calling thread, or null if
+    // the calling thread doesn't dispatch a request with a deadline.
+    //
+    static const DispatchDeadline* get();
+
+    //
+    // Returns the deadline of the request with the given context and
+    // received time (now if IceUtil::Time()), or IceUtil::Time() if
+    // the request doesn't have a deadline.
+    //
+    static IceUtil::Time parse(const Ice::Context&, const IceUtil::Time&);
+
+    const Ice::Current& getCurrent() const
+    {
+        return _current;
+    }
+
+    const IceUtil::Time& getDeadline() const
+    {
+        return _deadline;
+    }
+
+private:
+
+    const Ice::Current& _current;
+    const IceUtil::Time _deadline;
+    const DispatchDeadline* _previous;
+};
+
+}
+
+#endif
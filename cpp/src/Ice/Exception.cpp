@@ -391,6 +391,18 @@ Ice::OperationNotExistException::ice_print(ostream& out) const
     printFailedRequestData(out, *this);
 }
 
+void
+Ice::ServerOverloadedException::ice_print(ostream& out) const
+{
+    Exception::ice_print(out);
+    out << ":\nserver overloaded";
+    if(!reason.empty())
+    {
+        out << ": " << reason;
+    }
+    printFailedRequestData(out, *this);
+}
+
 void
 Ice::SyscallException::ice_print(ostream& out) const
 {
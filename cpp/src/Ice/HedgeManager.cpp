@@ -0,0 +1,132 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/HedgeManager.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(HedgeManager* p) { return p; }
+
+namespace
+{
+
+//
+// The number of latency samples kept for each operation, the number
+// of samples required before hedging an invocation and the number of
+// new samples after which the percentile is computed again.
+//
+const size_t maxSamples = 128;
+const size_t minSamples = 20;
+const size_t updateSamples = 16;
+
+//
+// The maximum number of tokens which can be saved in the budget.
+//
+const double maxTokens = 10.0;
+
+}
+
+IceInternal::HedgeManager::HedgeManager(const PropertiesPtr& properties, const LoggerPtr& logger) :
+    _tokens(0)
+{
+    StringSeq operations = properties->getPropertyAsList("Ice.Hedge.Operations");
+    _operations.insert(operations.begin(), operations.end());
+
+    int minDelay = properties->getPropertyAsIntWithDefault("Ice.Hedge.MinDelay", 10);
+    if(minDelay < 0)
+    {
+        minDelay = 10;
+        Warning out(logger);
+        out << "invalid value for Ice.Hedge.MinDelay `" << properties->getProperty("Ice.Hedge.MinDelay")
+            << "': defaulting to 10";
+    }
+    _minDelay = IceUtil::Time::milliSeconds(minDelay).toMicroSeconds();
+
+    int budget = properties->getPropertyAsIntWithDefault("Ice.Hedge.Budget", 10);
+    if(budget < 0 || budget > 100)
+    {
+        budget = 10;
+        Warning out(logger);
+        out << "invalid value for Ice.Hedge.Budget `" << properties->getProperty("Ice.Hedge.Budget")
+            << "': defaulting to 10";
+    }
+    _deposit = budget / 100.0;
+}
+
+bool
+IceInternal::HedgeManager::isHedged(const string& operation) const
+{
+    return !_operations.empty() && _operations.find(operation) != _operations.end();
+}
+
+IceUtil::Time
+IceInternal::HedgeManager::getDelay(const string& operation)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+
+    //
+    // Each invocation of a hedged operation adds to the budget.
+    //
+    _tokens = min(_tokens + _deposit, maxTokens);
+
+    map<string, Latencies>::iterator p = _latencies.find(operation);
+    if(p == _latencies.end() || p->second.samples.size() < minSamples)
+    {
+        return IceUtil::Time(); // Not enough samples to compute the percentile, don't hedge.
+    }
+
+    Latencies& latencies = p->second;
+    if(latencies.updates >= updateSamples || latencies.percentile == 0)
+    {
+        vector<IceUtil::Int64> samples = latencies.samples;
+        vector<IceUtil::Int64>::iterator q = samples.begin() + (samples.size() * 95) / 100;
+        nth_element(samples.begin(), q, samples.end());
+        latencies.percentile = *q;
+        latencies.updates = 0;
+    }
+    return IceUtil::Time::microSeconds(max(latencies.percentile, _minDelay));
+}
+
+void
+IceInternal::HedgeManager::addLatency(const string& operation, const IceUtil::Time& latency)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+
+    Latencies& latencies = _latencies[operation];
+    if(latencies.samples.size() < maxSamples)
+    {
+        latencies.samples.push_back(latency.toMicroSeconds());
+    }
+    else
+    {
+        latencies.samples[latencies.next] = latency.toMicroSeconds();
+        latencies.next = (latencies.next + 1) % maxSamples;
+    }
+    ++latencies.updates;
+}
+
+bool
+IceInternal::HedgeManager::hasBudget()
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    return _tokens >= 1.0;
+}
+
+bool
+IceInternal::HedgeManager::acquireBudget()
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(_tokens < 1.0)
+    {
+        return false;
+    }
+    _tokens -= 1.0;
+    return true;
+}
@@ -0,0 +1,70 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_HEDGE_MANAGER_H
+#define ICE_HEDGE_MANAGER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/HedgeManagerF.h>
+#include <Ice/PropertiesF.h>
+#include <Ice/LoggerF.h>
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The hedge manager keeps the recent latencies of the hedged
+// operations. An invocation is hedged once it has been pending for
+// the 95th percentile of the latencies of its operation (or for
+// Ice.Hedge.MinDelay if longer). The hedged invocations are limited
+// by a budget: each hedged operation invocation adds Ice.Hedge.Budget
+// percent of a token to the budget and sending a hedge consumes one
+// token.
+//
+class HedgeManager : public IceUtil::Shared
+{
+public:
+
+    HedgeManager(const Ice::PropertiesPtr&, const Ice::LoggerPtr&);
+
+    bool isHedged(const std::string&) const;
+
+    IceUtil::Time getDelay(const std::string&);
+    void addLatency(const std::string&, const IceUtil::Time&);
+
+    bool hasBudget();
+    bool acquireBudget();
+
+private:
+
+    struct Latencies
+    {
+        Latencies() : next(0), updates(0), percentile(0)
+        {
+        }
+
+        std::vector<IceUtil::Int64> samples;
+        size_t next;
+        size_t updates;
+        IceUtil::Int64 percentile;
+    };
+
+    std::set<std::string> _operations;
+    IceUtil::Int64 _minDelay;
+    double _deposit;
+
+    IceUtil::Mutex _mutex;
+    std::map<std::string, Latencies> _latencies;
+    double _tokens;
+};
+
+}
+
+#endif
@@ -0,0 +1,19 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_HEDGE_MANAGER_F_H
+#define ICE_HEDGE_MANAGER_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class HedgeManager;
+IceUtil::Shared* upCast(HedgeManager*);
+typedef Handle<HedgeManager> HedgeManagerPtr;
+
+}
+
+#endif
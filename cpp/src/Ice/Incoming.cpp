@@ -5,7 +5,7 @@
 #include <Ice/Incoming.h>
 #include <Ice/IncomingAsync.h>
 #include <Ice/IncomingRequest.h>
-#include <Ice/ObjectAdapter.h>
+#include <Ice/ObjectAdapterI.h> // For getReplyCache().
 #include <Ice/ServantLocator.h>
 #include <Ice/ServantManager.h>
 #include <Ice/Object.h>
@@ -17,6 +17,9 @@
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
+#include <Ice/InstrumentationI.h> // For DispatchObserverI.
+#include <Ice/DispatchDeadline.h>
+#include <Ice/ReplyCache.h>
 #include <Ice/StringUtil.h>
 #include <typeinfo>
 
@@ -32,6 +35,21 @@ extern bool printStackTraces;
 
 }
 
+namespace
+{
+
+DispatchObserverI*
+getDispatchObserverI(const IceInternal::DispatchObserver& observer)
+{
+#ifdef ICE_CPP11_MAPPING
+    return dynamic_cast<DispatchObserverI*>(observer.get().get());
+#else
+    return dynamic_cast<DispatchObserverI*>(observer.get());
+#endif
+}
+
+}
+
 #ifdef ICE_CPP11_MAPPING
 Ice::MarshaledResult::MarshaledResult(const Ice::Current& current) :
     ostr(make_shared<Ice::OutputStream>(current.adapter->getCommunicator(), Ice::currentProtocolEncoding))
@@ -356,6 +374,10 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
             {
                 _os.write(replyOperationNotExist);
             }
+            else if(dynamic_cast<ServerOverloadedException*>(rfe))
+            {
+                _os.write(replyServerOverloaded);
+            }
             else
             {
                 assert(false);
@@ -377,6 +399,11 @@ IceInternal::IncomingBase::handleException(const std::exception& exc, bool amd)
 
             _os.write(rfe->operation, false);
 
+            if(ServerOverloadedException* soe = dynamic_cast<ServerOverloadedException*>(rfe))
+            {
+                _os.write(soe->reason, false);
+            }
+
             _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
             _responseHandler->sendResponse(_current.requestId, &_os, _compress, amd);
         }
@@ -557,7 +584,8 @@ IceInternal::IncomingBase::handleException(const string& msg, bool amd)
 IceInternal::Incoming::Incoming(Instance* instance, ResponseHandler* responseHandler, Ice::Connection* connection,
                                 const ObjectAdapterPtr& adapter, bool response, Byte compress, Int requestId) :
     IncomingBase(instance, responseHandler, connection, adapter, response, compress, requestId),
-    _inParamPos(0)
+    _inParamPos(0),
+    _concurrencyLimit(0)
 {
 }
 
@@ -607,7 +635,7 @@ IceInternal::Incoming::startOver()
 }
 
 void
-IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+IceInternal::Incoming::readCurrent(InputStream* stream)
 {
     _is = stream;
 
@@ -651,8 +679,14 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         _current.ctx.insert(_current.ctx.end(), pr);
     }
 
+    //
+    // The deadline of the request is given by its _deadline context
+    // entry, relative to the time the request is received.
+    //
+    _deadline = DispatchDeadline::parse(_current.ctx, _receivedTime);
+
     const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
-    if(obsv)
+    if(obsv && !_observer)
     {
         // Read the parameter encapsulation size.
         Ice::Int encapsSize;
@@ -662,6 +696,102 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + encapsSize)));
     }
 
+    if(_concurrencyLimit > 0 && _observer)
+    {
+        DispatchObserverI* observer = getDispatchObserverI(_observer);
+        if(observer)
+        {
+            observer->concurrencyLimit(_concurrencyLimit);
+        }
+    }
+}
+
+void
+IceInternal::Incoming::reject(InputStream* stream, const LocalException& ex)
+{
+    readCurrent(stream);
+    skipReadParams();
+
+    if(_observer)
+    {
+        DispatchObserverI* observer = getDispatchObserverI(_observer);
+        if(observer)
+        {
+            observer->rejected();
+        }
+    }
+    handleException(ex, false);
+}
+
+void
+IceInternal::Incoming::drop()
+{
+    skipReadParams();
+
+    if(_observer)
+    {
+        DispatchObserverI* observer = getDispatchObserverI(_observer);
+        if(observer)
+        {
+            observer->rejected();
+        }
+    }
+    _observer.detach();
+
+    _responseHandler->sendNoResponse();
+    _responseHandler = 0;
+}
+
+void
+IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+{
+    readCurrent(stream);
+
+    //
+    // The request is dropped without a response if its deadline
+    // expired, its caller no longer waits for the response.
+    //
+    if(_deadline != IceUtil::Time() && IceUtil::Time::now(IceUtil::Time::Monotonic) >= _deadline)
+    {
+        drop();
+        return;
+    }
+
+    //
+    // A request with a request ID is dispatched with the response
+    // handler of the reply cache if the object adapter caches replies.
+    // A retry of the request isn't dispatched again, it gets the reply
+    // of the request from the reply cache.
+    //
+    if(_response)
+    {
+        ObjectAdapterI* adapter = dynamic_cast<ObjectAdapterI*>(_current.adapter.get());
+        if(adapter && adapter->getReplyCache())
+        {
+            Context::const_iterator p = _current.ctx.find("_rid");
+            if(p != _current.ctx.end())
+            {
+                _replyCacheHandler = adapter->getReplyCache()->acquire(_current, p->second,
+                                                                       ICE_GET_SHARED_FROM_THIS(_responseHandler),
+                                                                       _compress);
+                if(!_replyCacheHandler)
+                {
+                    skipReadParams();
+                    _observer.detach();
+                    _responseHandler = 0;
+                    return;
+                }
+                _responseHandler = _replyCacheHandler.get();
+            }
+        }
+    }
+
+    //
+    // The invocations made while the request is dispatched inherit
+    // its deadline.
+    //
+    DispatchDeadline deadline(_current, _deadline);
+
     //
     // Don't put the code above into the try block below. Exceptions
     // in the code above are considered fatal, and must propagate to
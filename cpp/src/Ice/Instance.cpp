@@ -26,6 +26,8 @@
 #include <Ice/WSEndpoint.h>
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/HedgeManager.h>
+#include <Ice/CircuitBreaker.h>
 #include <Ice/DynamicLibrary.h>
 #include <Ice/PluginManagerI.h>
 #include <Ice/Initialize.h>
@@ -1262,6 +1264,10 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 
         _retryQueue = new RetryQueue(this);
 
+        _hedgeManager = new HedgeManager(_initData.properties, _initData.logger);
+
+        _circuitBreaker = new CircuitBreaker(_initData.properties, _initData.logger, _traceLevels);
+
         __setNoDelete(false);
     }
     catch(...)
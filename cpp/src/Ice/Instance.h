@@ -28,6 +28,8 @@
 #include <Ice/EndpointFactoryManagerF.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/RetryQueueF.h>
+#include <Ice/HedgeManagerF.h>
+#include <Ice/CircuitBreakerF.h>
 #include <Ice/DynamicLibraryF.h>
 #include <Ice/PluginF.h>
 #include <Ice/NetworkF.h>
@@ -97,6 +99,8 @@ public:
     ThreadPoolPtr serverThreadPool();
     EndpointHostResolverPtr endpointHostResolver();
     RetryQueuePtr retryQueue();
+    const HedgeManagerPtr& hedgeManager() const { return _hedgeManager; }
+    const CircuitBreakerPtr& circuitBreaker() const { return _circuitBreaker; }
     IceUtil::TimerPtr timer();
     EndpointFactoryManagerPtr endpointFactoryManager() const;
     DynamicLibraryListPtr dynamicLibraryList() const;
@@ -191,6 +195,8 @@ private:
     ThreadPoolPtr _serverThreadPool;
     EndpointHostResolverPtr _endpointHostResolver;
     RetryQueuePtr _retryQueue;
+    HedgeManagerPtr _hedgeManager;
+    CircuitBreakerPtr _circuitBreaker;
     TimerPtr _timer;
     EndpointFactoryManagerPtr _endpointFactoryManager;
     DynamicLibraryListPtr _dynamicLibraryList;
@@ -67,6 +67,20 @@ struct ThreadStateChanged
     ThreadState newState;
 };
 
+struct ConcurrencyLimitChanged
+{
+    ConcurrencyLimitChanged(Int limitP) : limit(limitP)
+    {
+    }
+
+    void operator()(const DispatchMetricsPtr& v)
+    {
+        v->concurrencyLimit = limit;
+    }
+
+    Int limit;
+};
+
 IPConnectionInfo*
 getIPConnectionInfo(const ConnectionInfoPtr& info)
 {
@@ -819,6 +833,31 @@ DispatchObserverI::reply(Int size)
     }
 }
 
+void
+DispatchObserverI::queued()
+{
+    forEach(inc(&DispatchMetrics::queued));
+}
+
+void
+DispatchObserverI::dequeued(Long queueTime)
+{
+    forEach(dec(&DispatchMetrics::queued));
+    forEach(add(&DispatchMetrics::queueTime, queueTime));
+}
+
+void
+DispatchObserverI::rejected()
+{
+    forEach(inc(&DispatchMetrics::rejected));
+}
+
+void
+DispatchObserverI::concurrencyLimit(Int limit)
+{
+    forEach(ConcurrencyLimitChanged(limit));
+}
+
 void
 RemoteObserverI::reply(Int size)
 {
@@ -859,6 +898,18 @@ InvocationObserverI::userException()
     }
 }
 
+void
+InvocationObserverI::hedged()
+{
+    forEach(inc(&InvocationMetrics::hedged));
+}
+
+void
+InvocationObserverI::hedgeWon()
+{
+    forEach(inc(&InvocationMetrics::hedgeWon));
+}
+
 RemoteObserverPtr
 InvocationObserverI::getRemoteObserver(const ConnectionInfoPtr& connection,
                                        const EndpointPtr& endpoint,
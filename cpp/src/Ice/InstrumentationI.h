@@ -169,6 +169,11 @@ public:
     virtual void userException();
 
     virtual void reply(Ice::Int);
+
+    void queued();
+    void dequeued(Ice::Long);
+    void rejected();
+    void concurrencyLimit(Ice::Int);
 };
 
 class RemoteObserverI : public ObserverWithDelegateT<IceMX::RemoteMetrics, Ice::Instrumentation::RemoteObserver>
@@ -195,6 +200,9 @@ public:
 
     virtual void userException();
 
+    void hedged();
+    void hedgeWon();
+
     virtual Ice::Instrumentation::RemoteObserverPtr
     getRemoteObserver(const Ice::ConnectionInfoPtr&, const Ice::EndpointPtr&, Ice::Int, Ice::Int);
 
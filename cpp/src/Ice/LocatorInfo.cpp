@@ -14,6 +14,9 @@
 #include <Ice/Functional.h>
 #include <Ice/Properties.h>
 #include <Ice/Comparable.h>
+#include <Ice/Communicator.h>
+#include <Ice/ObjectAdapter.h>
+#include <Ice/Connection.h>
 #include <iterator>
 
 using namespace std;
@@ -120,10 +123,66 @@ public:
     }
 };
 
+//
+// The observer of the locator cache updates, it updates or evicts the
+// entries of the locator table.
+//
+class LocatorCacheObserverI : public LocatorCacheObserver
+{
+public:
+
+    LocatorCacheObserverI(const LocatorInfoPtr& locatorInfo) : _locatorInfo(locatorInfo)
+    {
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    virtual void adapterUpdated(string id, shared_ptr<ObjectPrx> proxy, const Current&)
+#else
+    virtual void adapterUpdated(const string& id, const ObjectPrx& proxy, const Current&)
+#endif
+    {
+        _locatorInfo->adapterUpdated(id, proxy);
+    }
+
+#ifdef ICE_CPP11_MAPPING
+    virtual void objectUpdated(Identity id, const Current&)
+#else
+    virtual void objectUpdated(const Identity& id, const Current&)
+#endif
+    {
+        _locatorInfo->objectUpdated(id);
+    }
+
+private:
+
+    const LocatorInfoPtr _locatorInfo;
+};
+
+#ifndef ICE_CPP11_MAPPING
+class LocatorCacheCloseCallback : public CloseCallback
+{
+public:
+
+    LocatorCacheCloseCallback(const LocatorInfoPtr& locatorInfo) : _locatorInfo(locatorInfo)
+    {
+    }
+
+    virtual void closed(const ConnectionPtr& connection)
+    {
+        _locatorInfo->subscriptionClosed(connection);
+    }
+
+private:
+
+    const LocatorInfoPtr _locatorInfo;
+};
+#endif
+
 }
 
 IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties) :
     _background(properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+    _cacheUpdates(properties->getPropertyAsInt("Ice.LocatorCacheUpdates") > 0),
     _tableHint(_table.end())
 {
 }
@@ -194,7 +253,8 @@ IceInternal::LocatorManager::get(const LocatorPrxPtr& loc)
         _tableHint = _table.insert(_tableHint,
                                    pair<const LocatorPrxPtr, LocatorInfoPtr>(locator,
                                                                           new LocatorInfo(locator, t->second,
-                                                                                          _background)));
+                                                                                          _background,
+                                                                                          _cacheUpdates)));
     }
     else
     {
@@ -255,6 +315,23 @@ IceInternal::LocatorTable::addAdapterEndpoints(const string& adapter, const vect
     }
 }
 
+bool
+IceInternal::LocatorTable::updateAdapterEndpoints(const string& adapter, const vector<EndpointIPtr>& endpoints)
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    //
+    // Only update the endpoints of adapters already in the cache.
+    //
+    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    if(p == _adapterEndpointsMap.end())
+    {
+        return false;
+    }
+    p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints);
+    return true;
+}
+
 vector<EndpointIPtr>
 IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 {
@@ -483,10 +560,15 @@ IceInternal::LocatorInfo::Request::exception(const Ice::Exception& ex)
     }
 }
 
-IceInternal::LocatorInfo::LocatorInfo(const LocatorPrxPtr& locator, const LocatorTablePtr& table, bool background) :
+IceInternal::LocatorInfo::LocatorInfo(const LocatorPrxPtr& locator,
+                                      const LocatorTablePtr& table,
+                                      bool background,
+                                      bool cacheUpdates) :
     _locator(locator),
     _table(table),
-    _background(background)
+    _background(background),
+    _cacheUpdates(cacheUpdates),
+    _subscription(SubscriptionNone)
 {
     assert(_locator);
     assert(_table);
@@ -495,10 +577,24 @@ IceInternal::LocatorInfo::LocatorInfo(const LocatorPrxPtr& locator, const Locato
 void
 IceInternal::LocatorInfo::destroy()
 {
-    IceUtil::Mutex::Lock sync(*this);
+    ObjectAdapterPtr adapter;
+    {
+        IceUtil::Mutex::Lock sync(*this);
 
-    _locatorRegistry = 0;
-    _table->clear();
+        _locatorRegistry = 0;
+        _subscriptionConnection = 0;
+        _subscriptionAdapter.swap(adapter);
+        _table->clear();
+    }
+
+    //
+    // Destroying the adapter also releases the observer, which holds
+    // a reference to this locator info.
+    //
+    if(adapter)
+    {
+        adapter->destroy();
+    }
 }
 
 bool
@@ -553,6 +649,12 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                                        const GetEndpointsCallbackPtr& callback)
 {
     assert(ref->isIndirect());
+
+    if(_cacheUpdates)
+    {
+        subscribe();
+    }
+
     vector<EndpointIPtr> endpoints;
     if(!ref->isWellKnown())
     {
@@ -649,6 +751,283 @@ IceInternal::LocatorInfo::clearCache(const ReferencePtr& ref)
     }
 }
 
+void
+IceInternal::LocatorInfo::adapterUpdated(const string& id, const ObjectPrxPtr& proxy)
+{
+    InstancePtr instance = _locator->_getReference()->getInstance();
+
+    IceUtil::Mutex::Lock sync(*this);
+    if(_adapterRequests.find(id) != _adapterRequests.end())
+    {
+        _invalidatedAdapterRequests.insert(id);
+    }
+
+    if(proxy && !proxy->_getReference()->isIndirect())
+    {
+        if(_table->updateAdapterEndpoints(id, proxy->_getReference()->getEndpoints()) &&
+           instance->traceLevels()->location >= 2)
+        {
+            Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+            out << "updated endpoints for adapter in locator cache\nadapter = " << id << "\n";
+            out << "endpoints = " << proxy->_getReference()->toString();
+        }
+    }
+    else if(!_table->removeAdapterEndpoints(id).empty() && instance->traceLevels()->location >= 2)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "removed endpoints for adapter from locator cache\nadapter = " << id;
+    }
+}
+
+void
+IceInternal::LocatorInfo::objectUpdated(const Identity& id)
+{
+    InstancePtr instance = _locator->_getReference()->getInstance();
+
+    IceUtil::Mutex::Lock sync(*this);
+    if(_objectRequests.find(id) != _objectRequests.end())
+    {
+        _invalidatedObjectRequests.insert(id);
+    }
+
+    if(_table->removeObjectReference(id) && instance->traceLevels()->location >= 2)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "removed well-known object from locator cache\nobject = "
+            << identityToString(id, instance->toStringMode());
+    }
+}
+
+void
+IceInternal::LocatorInfo::subscribeConnection(const ConnectionPtr& connection)
+{
+    try
+    {
+        if(!connection)
+        {
+            throw FeatureNotSupportedException(__FILE__, __LINE__, "locator cache updates with a collocated locator");
+        }
+
+        //
+        // The notifications are received over the subscription connection
+        // with an unnamed object adapter. The adapter and the observer
+        // are created with the first subscription and reused when the
+        // locator info subscribes again.
+        //
+        ObjectAdapterPtr adapter;
+        ObjectPrxPtr observer;
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            adapter = _subscriptionAdapter;
+            observer = _observer;
+        }
+        if(!adapter)
+        {
+            adapter = _locator->ice_getCommunicator()->createObjectAdapter("");
+#ifdef ICE_CPP11_MAPPING
+            observer = adapter->addWithUUID(make_shared<LocatorCacheObserverI>(this));
+#else
+            observer = adapter->addWithUUID(new LocatorCacheObserverI(this));
+#endif
+            adapter->activate();
+
+            IceUtil::Mutex::Lock sync(*this);
+            _subscriptionAdapter = adapter;
+            _observer = observer;
+        }
+        connection->setAdapter(adapter);
+
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            _subscriptionConnection = connection;
+        }
+
+        //
+        // The subscription lasts as long as the connection, it must not
+        // be closed by ACM. The connection is only used for the
+        // subscription (see subscribe()), the ACM settings and the close
+        // callback don't apply to the connections of the application.
+        //
+#ifdef ICE_CPP11_MAPPING
+        connection->setACM(Ice::nullopt, ACMClose::CloseOff, ACMHeartbeat::HeartbeatAlways);
+        LocatorInfoPtr self = this;
+        connection->setCloseCallback([self](const ConnectionPtr& con) { self->subscriptionClosed(con); });
+
+        auto notifier = uncheckedCast<LocatorCacheNotifierPrx>(
+            connection->createProxy(_locator->ice_getIdentity())->ice_facet("LocatorCacheNotifier"));
+        notifier->subscribeAsync(observer->ice_getIdentity(),
+                                 [self]()
+                                 {
+                                     self->subscribeResponse();
+                                 },
+                                 [self](exception_ptr e)
+                                 {
+                                     try
+                                     {
+                                         rethrow_exception(e);
+                                     }
+                                     catch(const Exception& ex)
+                                     {
+                                         self->subscribeException(ex);
+                                     }
+                                 });
+#else
+        connection->setACM(IceUtil::None, CloseOff, HeartbeatAlways);
+        connection->setCloseCallback(new LocatorCacheCloseCallback(this));
+
+        LocatorCacheNotifierPrx notifier = LocatorCacheNotifierPrx::uncheckedCast(
+            connection->createProxy(_locator->ice_getIdentity())->ice_facet("LocatorCacheNotifier"));
+        notifier->begin_subscribe(observer->ice_getIdentity(),
+                                  newCallback_LocatorCacheNotifier_subscribe(this,
+                                                                             &LocatorInfo::subscribeResponse,
+                                                                             &LocatorInfo::subscribeException));
+#endif
+    }
+    catch(const Ice::Exception& ex)
+    {
+        subscribeException(ex);
+    }
+}
+
+void
+IceInternal::LocatorInfo::subscribeResponse()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_subscription != SubscriptionPending)
+    {
+        return; // The connection was closed.
+    }
+    _subscription = SubscriptionActive;
+
+    //
+    // The entries cached before the subscription, and the results of
+    // the lookups which might have been answered before it, could miss
+    // an update.
+    //
+    invalidateRequests();
+    _table->clear();
+
+    InstancePtr instance = _locator->_getReference()->getInstance();
+    if(instance->traceLevels()->location >= 1)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "subscribed to locator cache updates\nlocator = " << _locator->ice_toString();
+    }
+}
+
+void
+IceInternal::LocatorInfo::subscribeException(const Ice::Exception& ex)
+{
+    ConnectionPtr connection;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+
+        //
+        // If the locator doesn't support the updates, we don't try again,
+        // otherwise we try again with the next locator request.
+        //
+        bool unsupported = dynamic_cast<const FacetNotExistException*>(&ex) ||
+            dynamic_cast<const OperationNotExistException*>(&ex) ||
+            dynamic_cast<const FeatureNotSupportedException*>(&ex);
+        _subscription = unsupported ? SubscriptionUnsupported : SubscriptionNone;
+        _subscriptionConnection.swap(connection);
+    }
+
+    //
+    // The subscription connection isn't closed by ACM, it's closed here
+    // if the subscription failed.
+    //
+    if(connection)
+    {
+        connection->close(ICE_SCOPED_ENUM(ConnectionClose, Gracefully));
+    }
+
+    InstancePtr instance = _locator->_getReference()->getInstance();
+    if(instance->traceLevels()->location >= 1)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "couldn't subscribe to locator cache updates\nlocator = " << _locator->ice_toString() << "\n";
+        out << "reason = " << ex;
+    }
+}
+
+void
+IceInternal::LocatorInfo::subscriptionClosed(const ConnectionPtr& connection)
+{
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(connection != _subscriptionConnection)
+        {
+            return;
+        }
+        _subscription = SubscriptionNone;
+        _subscriptionConnection = 0;
+
+        //
+        // The updates sent while the connection was down are lost, the
+        // cached entries can't be trusted anymore.
+        //
+        invalidateRequests();
+        _table->clear();
+    }
+
+    InstancePtr instance = _locator->_getReference()->getInstance();
+    if(instance->traceLevels()->location >= 1)
+    {
+        Trace out(instance->initializationData().logger, instance->traceLevels()->locationCat);
+        out << "locator cache updates connection closed, cleared locator cache\nlocator = "
+            << _locator->ice_toString();
+    }
+}
+
+void
+IceInternal::LocatorInfo::subscribe()
+{
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(_subscription != SubscriptionNone)
+        {
+            return;
+        }
+        _subscription = SubscriptionPending;
+    }
+
+    try
+    {
+        //
+        // The subscription uses its own connection to the locator, this
+        // connection isn't shared with the proxies of the application.
+        //
+        ObjectPrxPtr locator = _locator->ice_connectionId("Ice.LocatorCacheUpdates");
+#ifdef ICE_CPP11_MAPPING
+        LocatorInfoPtr self = this;
+        locator->ice_getConnectionAsync([self](const ConnectionPtr& connection)
+                                        {
+                                            self->subscribeConnection(connection);
+                                        },
+                                        [self](exception_ptr e)
+                                        {
+                                            try
+                                            {
+                                                rethrow_exception(e);
+                                            }
+                                            catch(const Exception& ex)
+                                            {
+                                                self->subscribeException(ex);
+                                            }
+                                        });
+#else
+        locator->begin_ice_getConnection(newCallback_Object_ice_getConnection(this,
+                                                                              &LocatorInfo::subscribeConnection,
+                                                                              &LocatorInfo::subscribeException));
+#endif
+    }
+    catch(const Ice::Exception& ex)
+    {
+        subscribeException(ex);
+    }
+}
+
 void
 IceInternal::LocatorInfo::getEndpointsException(const ReferencePtr& ref, const Ice::Exception& exc)
 {
@@ -856,34 +1235,63 @@ IceInternal::LocatorInfo::finishRequest(const ReferencePtr& ref,
         }
     }
 
+    //
+    // The result is cached with the mutex locked: a locator cache update
+    // either invalidates the request before, or updates the cached entry
+    // after. The result of an invalidated request isn't cached, it might
+    // be older than the update.
+    //
+    IceUtil::Mutex::Lock sync(*this);
     if(!ref->isWellKnown())
     {
+        bool invalidated = _invalidatedAdapterRequests.erase(ref->getAdapterId()) > 0;
         if(proxy && !proxy->_getReference()->isIndirect()) // Cache the adapter endpoints.
         {
-            _table->addAdapterEndpoints(ref->getAdapterId(), proxy->_getReference()->getEndpoints());
+            if(!invalidated)
+            {
+                _table->addAdapterEndpoints(ref->getAdapterId(), proxy->_getReference()->getEndpoints());
+            }
         }
         else if(notRegistered) // If the adapter isn't registered anymore, remove it from the cache.
         {
             _table->removeAdapterEndpoints(ref->getAdapterId());
         }
 
-        IceUtil::Mutex::Lock sync(*this);
         assert(_adapterRequests.find(ref->getAdapterId()) != _adapterRequests.end());
         _adapterRequests.erase(ref->getAdapterId());
     }
     else
     {
+        bool invalidated = _invalidatedObjectRequests.erase(ref->getIdentity()) > 0;
         if(proxy && !proxy->_getReference()->isWellKnown()) // Cache the well-known object reference.
         {
-            _table->addObjectReference(ref->getIdentity(), proxy->_getReference());
+            if(!invalidated)
+            {
+                _table->addObjectReference(ref->getIdentity(), proxy->_getReference());
+            }
         }
         else if(notRegistered) // If the well-known object isn't registered anymore, remove it from the cache.
         {
             _table->removeObjectReference(ref->getIdentity());
         }
 
-        IceUtil::Mutex::Lock sync(*this);
         assert(_objectRequests.find(ref->getIdentity()) != _objectRequests.end());
         _objectRequests.erase(ref->getIdentity());
     }
 }
+
+void
+IceInternal::LocatorInfo::invalidateRequests()
+{
+    //
+    // Must be called with the mutex locked.
+    //
+    for(map<string, RequestPtr>::const_iterator p = _adapterRequests.begin(); p != _adapterRequests.end(); ++p)
+    {
+        _invalidatedAdapterRequests.insert(p->first);
+    }
+    for(map<Identity, RequestPtr>::const_iterator p = _objectRequests.begin(); p != _objectRequests.end(); ++p)
+    {
+        _invalidatedObjectRequests.insert(p->first);
+    }
+}
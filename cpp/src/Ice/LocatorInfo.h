@@ -15,10 +15,14 @@
 #include <Ice/Identity.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/PropertiesF.h>
+#include <Ice/ConnectionF.h>
+#include <Ice/ObjectAdapterF.h>
 #include <Ice/Version.h>
 
 #include <Ice/UniquePtr.h>
 
+#include <set>
+
 namespace IceInternal
 {
 
@@ -39,6 +43,7 @@ public:
 private:
 
     const bool _background;
+    const bool _cacheUpdates;
 
 #ifdef ICE_CPP11_MAPPING
     using LocatorInfoTable = std::map<std::shared_ptr<Ice::LocatorPrx>,
@@ -63,6 +68,7 @@ public:
 
     bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&);
     void addAdapterEndpoints(const std::string&, const ::std::vector<EndpointIPtr>&);
+    bool updateAdapterEndpoints(const std::string&, const ::std::vector<EndpointIPtr>&);
     ::std::vector<EndpointIPtr> removeAdapterEndpoints(const std::string&);
 
     bool getObjectReference(const Ice::Identity&, int, ReferencePtr&);
@@ -137,7 +143,7 @@ public:
     };
     typedef IceUtil::Handle<Request> RequestPtr;
 
-    LocatorInfo(const Ice::LocatorPrxPtr&, const LocatorTablePtr&, bool);
+    LocatorInfo(const Ice::LocatorPrxPtr&, const LocatorTablePtr&, bool, bool);
 
     void destroy();
 
@@ -161,8 +167,20 @@ public:
 
     void clearCache(const ReferencePtr&);
 
+    //
+    // Callbacks for the subscription to the locator cache updates.
+    //
+    void adapterUpdated(const std::string&, const Ice::ObjectPrxPtr&);
+    void objectUpdated(const Ice::Identity&);
+    void subscribeConnection(const Ice::ConnectionPtr&);
+    void subscribeResponse();
+    void subscribeException(const Ice::Exception&);
+    void subscriptionClosed(const Ice::ConnectionPtr&);
+
 private:
 
+    void subscribe();
+
     void getEndpointsException(const ReferencePtr&, const Ice::Exception&);
     void getEndpointsTrace(const ReferencePtr&, const std::vector<EndpointIPtr>&, bool);
     void trace(const std::string&, const ReferencePtr&, const std::vector<EndpointIPtr>&);
@@ -172,6 +190,7 @@ private:
     RequestPtr getObjectRequest(const ReferencePtr&);
 
     void finishRequest(const ReferencePtr&, const std::vector<ReferencePtr>&, const Ice::ObjectPrxPtr&, bool);
+    void invalidateRequests();
     friend class Request;
     friend class RequestCallback;
 
@@ -179,9 +198,36 @@ private:
     Ice::LocatorRegistryPrxPtr _locatorRegistry;
     const LocatorTablePtr _table;
     const bool _background;
+    const bool _cacheUpdates;
+
+    //
+    // When Ice.LocatorCacheUpdates is set, the locator info subscribes
+    // an observer with the locator cache notifier of the locator. The
+    // observer is hosted by an unnamed object adapter, it receives the
+    // updates over a connection dedicated to the subscription and the
+    // subscription ends with the closure of this connection.
+    //
+    enum SubscriptionState
+    {
+        SubscriptionNone,
+        SubscriptionPending,
+        SubscriptionActive,
+        SubscriptionUnsupported
+    };
+    SubscriptionState _subscription;
+    Ice::ConnectionPtr _subscriptionConnection;
+    Ice::ObjectAdapterPtr _subscriptionAdapter;
+    Ice::ObjectPrxPtr _observer;
 
     std::map<std::string, RequestPtr> _adapterRequests;
     std::map<Ice::Identity, RequestPtr> _objectRequests;
+
+    //
+    // The pending requests invalidated by a locator cache update, their
+    // result isn't cached.
+    //
+    std::set<std::string> _invalidatedAdapterRequests;
+    std::set<Ice::Identity> _invalidatedObjectRequests;
 };
 
 }
@@ -22,6 +22,8 @@
 #include <Ice/Locator.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/ThreadPool.h>
+#include <Ice/ConcurrencyLimiter.h>
+#include <Ice/ReplyCache.h>
 #include <Ice/Communicator.h>
 #include <Ice/Router.h>
 #include <Ice/DefaultsAndOverrides.h>
@@ -1022,6 +1024,22 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             _threadPool = new ThreadPool(_instance, _name + ".ThreadPool", 0);
         }
 
+        //
+        // Create the concurrency limiter if the adapter limits the number of concurrent dispatches.
+        //
+        if(properties->getPropertyAsInt(_name + ".ConcurrencyLimit") > 0)
+        {
+            _concurrencyLimiter = new ConcurrencyLimiter(_instance, _name);
+        }
+
+        //
+        // Create the reply cache if the adapter caches the replies of the requests with a request ID.
+        //
+        if(properties->getPropertyAsInt(_name + ".ReplyCache.Size") > 0)
+        {
+            _replyCache = new ReplyCache(_instance, _name);
+        }
+
         if(!router)
         {
             const_cast<RouterPrxPtr&>(router) = ICE_UNCHECKED_CAST(RouterPrx,
@@ -1442,6 +1460,10 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ACM.Heartbeat",
         "ACM.Timeout",
         "AdapterId",
+        "ConcurrencyLimit",
+        "ConcurrencyLimit.Latency",
+        "ConcurrencyLimit.Max",
+        "ConcurrencyLimit.Min",
         "Endpoints",
         "Locator",
         "Locator.EncodingVersion",
@@ -1453,6 +1475,8 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "MessageSizeMax",
         "PublishedEndpoints",
         "ReplicaGroupId",
+        "ReplyCache.Size",
+        "ReplyCache.TTL",
         "Router",
         "Router.EncodingVersion",
         "Router.EndpointSelection",
@@ -1474,7 +1498,11 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ThreadPool.SizeWarn",
         "ThreadPool.StackSize",
         "ThreadPool.Serialize",
-        "ThreadPool.ThreadPriority"
+        "ThreadPool.ThreadPriority",
+        "ThreadPool.DispatchPriorities",
+        "ThreadPool.DispatchOperationPriorities",
+        "ThreadPool.DispatchWeights",
+        "ThreadPool.DispatchQueueTimeMax"
     };
 
     //
@@ -20,6 +20,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/LocatorInfoF.h>
 #include <Ice/ThreadPoolF.h>
+#include <Ice/ConcurrencyLimiterF.h>
+#include <Ice/ReplyCacheF.h>
 #include <Ice/OutgoingAsyncF.h>
 #include <Ice/Exception.h>
 #include <Ice/BuiltinSequences.h>
@@ -100,6 +102,8 @@ public:
     IceInternal::ACMConfig getACM() const;
     void setAdapterOnConnection(const Ice::ConnectionIPtr&);
     size_t messageSizeMax() const { return _messageSizeMax; }
+    const IceInternal::ConcurrencyLimiterPtr& getConcurrencyLimiter() const { return _concurrencyLimiter; }
+    const IceInternal::ReplyCachePtr& getReplyCache() const { return _replyCache; }
 
     ObjectAdapterI(const IceInternal::InstancePtr&, const CommunicatorPtr&,
                    const IceInternal::ObjectAdapterFactoryPtr&, const std::string&, bool);
@@ -135,6 +139,8 @@ private:
     CommunicatorPtr _communicator;
     IceInternal::ObjectAdapterFactoryPtr _objectAdapterFactory;
     IceInternal::ThreadPoolPtr _threadPool;
+    IceInternal::ConcurrencyLimiterPtr _concurrencyLimiter;
+    IceInternal::ReplyCachePtr _replyCache;
     IceInternal::ACMConfig _acm;
     IceInternal::ServantManagerPtr _servantManager;
     const std::string _name;
@@ -15,6 +15,13 @@
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/HedgeManager.h>
+#include <Ice/InstrumentationI.h>
+#include <Ice/ProxyFactory.h>
+#include <Ice/DispatchDeadline.h>
+#include <IceUtil/UUID.h>
+
+#include <sstream>
 
 using namespace std;
 using namespace Ice;
@@ -38,6 +45,266 @@ OutgoingAsyncCompletionCallback::~OutgoingAsyncCompletionCallback()
     // Out of line to avoid weak vtable
 }
 
+namespace
+{
+
+//
+// The hedging states of an invocation.
+//
+const unsigned char HedgeNone = 0;
+const unsigned char HedgeScheduled = 1;
+const unsigned char HedgeSent = 2;
+const unsigned char HedgeDone = 3;
+const unsigned char HedgeWon = 4;
+
+InvocationObserverI*
+getInvocationObserverI(const InvocationObserver& observer)
+{
+#ifdef ICE_CPP11_MAPPING
+    return dynamic_cast<InvocationObserverI*>(observer.get().get());
+#else
+    return dynamic_cast<InvocationObserverI*>(observer.get());
+#endif
+}
+
+void
+addEntries(Context& context, bool deadline, bool replyCached)
+{
+    if(deadline)
+    {
+        context.erase("_deadline"); // Written by OutgoingAsync::writeContext.
+    }
+    if(replyCached)
+    {
+        context["_rid"] = IceUtil::generateUUID();
+    }
+}
+
+//
+// The hedged request of an idempotent twoway invocation. The request
+// is sent from the timer thread once the invocation is pending for
+// the hedge delay. The reply is also delivered from the timer thread
+// since the invocation can't be canceled with the connection of the
+// hedged request locked. Only a successful reply or a user exception
+// completes the invocation, other failures are ignored and the
+// invocation waits for its own reply.
+//
+class HedgeOutgoingAsync : public OutgoingAsync
+{
+public:
+
+    HedgeOutgoingAsync(const ObjectPrxPtr& proxy, const OutgoingAsyncPtr& outAsync, OperationMode mode) :
+        OutgoingAsync(proxy, false),
+        _outAsync(outAsync),
+        _status(StatusScheduled)
+    {
+        _mode = mode;
+    }
+
+    void start(const IceUtil::Time& delay)
+    {
+        Lock sync(_m);
+        if(_status == StatusScheduled)
+        {
+            schedule(delay);
+        }
+    }
+
+    //
+    // Called once the invocation is completed, possibly with the
+    // connection of the invocation locked.
+    //
+    void abandon()
+    {
+        Lock sync(_m);
+        _outAsync = ICE_NULLPTR;
+        if(_status == StatusScheduled)
+        {
+            _status = StatusDone;
+            try
+            {
+                _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+            }
+            catch(const Ice::CommunicatorDestroyedException&)
+            {
+            }
+        }
+        else if(_status == StatusSent)
+        {
+            _status = StatusCanceled;
+            schedule(IceUtil::Time());
+        }
+    }
+
+    virtual bool sent()
+    {
+        return false;
+    }
+
+    virtual bool exception(const Ice::Exception&)
+    {
+        Lock sync(_m);
+        if(_status != StatusReplied)
+        {
+            _status = StatusDone;
+            _outAsync = ICE_NULLPTR;
+        }
+        return false;
+    }
+
+    virtual bool response()
+    {
+        //
+        // NOTE: this method is called from ConnectionI.parseMessage
+        // with the connection locked.
+        //
+        Lock sync(_m);
+        if(_status == StatusSent && _is.i != _is.b.end() && (*_is.i == replyOK || *_is.i == replyUserException))
+        {
+            _status = StatusReplied;
+            schedule(IceUtil::Time());
+        }
+        else
+        {
+            _status = StatusDone;
+            _outAsync = ICE_NULLPTR;
+        }
+        return false;
+    }
+
+    virtual void runTimerTask()
+    {
+        OutgoingAsyncPtr outAsync;
+        unsigned char status;
+        {
+            Lock sync(_m);
+            outAsync = _outAsync;
+            status = _status;
+        }
+
+        if(status == StatusScheduled)
+        {
+            if(!outAsync || !outAsync->startHedge(&_os))
+            {
+                finish();
+                return;
+            }
+
+            {
+                Lock sync(_m);
+                if(_status != StatusScheduled)
+                {
+                    return;
+                }
+                _status = StatusSent;
+            }
+
+            try
+            {
+                _handler = _proxy->_getRequestHandler();
+                _handler->sendAsyncRequest(ICE_SHARED_FROM_THIS);
+            }
+            catch(const RetryException&)
+            {
+                _proxy->_updateRequestHandler(_handler, 0); // Clear request handler, the hedge isn't retried.
+                finish();
+            }
+            catch(const Ice::Exception&)
+            {
+                finish();
+            }
+        }
+        else if(status == StatusCanceled)
+        {
+            cancel();
+        }
+        else if(status == StatusReplied)
+        {
+            finish();
+            if(outAsync && outAsync->hedgeResponse(&_is))
+            {
+                outAsync->invokeResponseAsync();
+            }
+        }
+    }
+
+protected:
+
+    virtual bool handleSent(bool, bool)
+    {
+        return false;
+    }
+
+    virtual bool handleException(const Ice::Exception&)
+    {
+        return false;
+    }
+
+    virtual bool handleResponse(bool)
+    {
+        return false;
+    }
+
+    virtual void handleInvokeSent(bool, OutgoingAsyncBase*) const
+    {
+        assert(false);
+    }
+
+    virtual void handleInvokeException(const Ice::Exception&, OutgoingAsyncBase*) const
+    {
+        assert(false);
+    }
+
+    virtual void handleInvokeResponse(bool, OutgoingAsyncBase*) const
+    {
+        assert(false);
+    }
+
+private:
+
+    void schedule(const IceUtil::Time& delay)
+    {
+        //
+        // Must be called with _m locked.
+        //
+        try
+        {
+            _instance->timer()->schedule(ICE_SHARED_FROM_THIS, delay);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+            _status = StatusDone;
+            _outAsync = ICE_NULLPTR;
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            _status = StatusDone;
+            _outAsync = ICE_NULLPTR;
+        }
+    }
+
+    void finish()
+    {
+        Lock sync(_m);
+        _status = StatusDone;
+        _outAsync = ICE_NULLPTR;
+    }
+
+    enum Status
+    {
+        StatusScheduled,
+        StatusSent,
+        StatusReplied,
+        StatusCanceled,
+        StatusDone
+    };
+
+    OutgoingAsyncPtr _outAsync;
+    Status _status;
+};
+
+}
+
 bool
 OutgoingAsyncBase::sent()
 {
@@ -597,8 +864,9 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
         _childObserver.detach();
     }
 
+    ConnectionIPtr connection = ICE_DYNAMIC_CAST(ConnectionI, _cachedConnection);
     _cachedConnection = 0;
-    if(_proxy->_getReference()->getInvocationTimeout() == -2)
+    if(_invocationTimeout == -2)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
@@ -609,12 +877,40 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
     //
     try
     {
+        //
+        // A request rejected because the server is overloaded wasn't
+        // dispatched, it's retried on the other endpoints of the proxy,
+        // if it has other endpoints.
+        //
+        const bool overloaded = connection && dynamic_cast<const ServerOverloadedException*>(&exc);
+
+        ObjectPrxPtr proxy = _retryProxy;
+        int interval = proxy->_handleException(exc, _handler, overloaded ? _mode : getRetryMode(connection), _sent,
+                                               _cnt);
+        if(overloaded)
+        {
+            ReferencePtr ref = _retryProxy->_getReference();
+            vector<EndpointIPtr> endpoints = ref->getEndpoints();
+            vector<EndpointIPtr> others;
+            for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+            {
+                if(!(*p)->equivalent(connection->endpoint()))
+                {
+                    others.push_back(*p);
+                }
+            }
+            if(!others.empty() && others.size() < endpoints.size())
+            {
+                _retryProxy = _instance->proxyFactory()->referenceToProxy(ref->changeEndpoints(others));
+            }
+        }
+
         //
         // It's important to let the retry queue do the retry even if
         // the retry interval is 0. This method can be called with the
         // connection locked so we can't just retry here.
         //
-        _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, _proxy->_handleException(exc, _handler, _mode, _sent, _cnt));
+        _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, interval);
         return false;
     }
     catch(const Exception& ex)
@@ -626,7 +922,7 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
 void
 ProxyOutgoingAsyncBase::cancelable(const CancellationHandlerPtr& handler)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() == -2 && _cachedConnection)
+    if(_invocationTimeout == -2 && _cachedConnection)
     {
         const int timeout = _cachedConnection->timeout();
         if(timeout > 0)
@@ -648,7 +944,7 @@ ProxyOutgoingAsyncBase::retryException(const Exception&)
         // require could end up waiting for the flush of the
         // connection to be done.
         //
-        _proxy->_updateRequestHandler(_handler, 0); // Clear request handler and always retry.
+        _retryProxy->_updateRequestHandler(_handler, 0); // Clear request handler and always retry.
         _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, 0);
     }
     catch(const Ice::Exception& exc)
@@ -704,9 +1000,31 @@ ProxyOutgoingAsyncBase::ProxyOutgoingAsyncBase(const ObjectPrxPtr& prx) :
     OutgoingAsyncBase(prx->_getReference()->getInstance()),
     _proxy(prx),
     _mode(ICE_ENUM(OperationMode, Normal)),
+    _invocationTimeout(prx->_getReference()->getInvocationTimeout()),
+    _replyCached(false),
+    _retryProxy(prx),
+    _replyCachePinned(false),
     _cnt(0),
     _sent(false)
 {
+    //
+    // An invocation made by a thread dispatching a request with a
+    // deadline inherits the deadline: the invocation timeout is
+    // shortened to the remaining time of the dispatch.
+    //
+    if(_invocationTimeout != -2)
+    {
+        const DispatchDeadline* deadline = DispatchDeadline::get();
+        if(deadline)
+        {
+            IceUtil::Time remaining = deadline->getDeadline() - IceUtil::Time::now(IceUtil::Time::Monotonic);
+            int timeout = static_cast<int>(max(remaining.toMilliSeconds(), static_cast<IceUtil::Int64>(1)));
+            if(_invocationTimeout < 0 || timeout < _invocationTimeout)
+            {
+                _invocationTimeout = timeout;
+            }
+        }
+    }
 }
 
 ProxyOutgoingAsyncBase::~ProxyOutgoingAsyncBase()
@@ -720,10 +1038,9 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
     {
         if(userThread)
         {
-            int invocationTimeout = _proxy->_getReference()->getInvocationTimeout();
-            if(invocationTimeout > 0)
+            if(_invocationTimeout > 0)
             {
-                _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(invocationTimeout));
+                _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(_invocationTimeout));
             }
         }
         else
@@ -736,7 +1053,7 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
             try
             {
                 _sent = false;
-                _handler = _proxy->_getRequestHandler();
+                _handler = _retryProxy->_getRequestHandler();
                 AsyncStatus status = _handler->sendAsyncRequest(ICE_SHARED_FROM_THIS);
                 if(status & AsyncStatusSent)
                 {
@@ -760,7 +1077,7 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
             }
             catch(const RetryException&)
             {
-                _proxy->_updateRequestHandler(_handler, 0); // Clear request handler and always retry.
+                _retryProxy->_updateRequestHandler(_handler, 0); // Clear request handler and always retry.
             }
             catch(const Exception& ex)
             {
@@ -769,7 +1086,10 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
                     _childObserver.failed(ex.ice_id());
                     _childObserver.detach();
                 }
-                int interval = _proxy->_handleException(ex, _handler, _mode, _sent, _cnt);
+                ObjectPrxPtr proxy = _retryProxy;
+                int interval = proxy->_handleException(ex, _handler,
+                                                       getRetryMode(ICE_DYNAMIC_CAST(ConnectionI, _cachedConnection)),
+                                                       _sent, _cnt);
                 if(interval > 0)
                 {
                     _instance->retryQueue()->add(ICE_SHARED_FROM_THIS, interval);
@@ -805,7 +1125,7 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
     _sent = true;
     if(done)
     {
-        if(_proxy->_getReference()->getInvocationTimeout() != -1)
+        if(_invocationTimeout != -1)
         {
             _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
         }
@@ -816,7 +1136,7 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() != -1)
+    if(_invocationTimeout != -1)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
@@ -826,17 +1146,48 @@ ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 bool
 ProxyOutgoingAsyncBase::responseImpl(bool ok, bool invoke)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() != -1)
+    if(_invocationTimeout != -1)
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
     return OutgoingAsyncBase::responseImpl(ok, invoke);
 }
 
+OperationMode
+ProxyOutgoingAsyncBase::getRetryMode(const ConnectionIPtr& connection)
+{
+    //
+    // An invocation with a request ID is retried like an idempotent
+    // invocation once it's sent only if its retries are sent to the
+    // endpoint of the connection which sent the request: the object
+    // adapter which received the request has its reply, another server
+    // or replica would dispatch the request again. It isn't retried if
+    // the request was sent through a router or wasn't sent over a
+    // connection.
+    //
+    if(!_replyCached || !_sent)
+    {
+        return _mode;
+    }
+
+    if(!_replyCachePinned)
+    {
+        ReferencePtr ref = _retryProxy->_getReference();
+        if(!connection || ref->getRouterInfo())
+        {
+            return _mode;
+        }
+        vector<EndpointIPtr> endpoints(1, connection->endpoint());
+        _retryProxy = _instance->proxyFactory()->referenceToProxy(ref->changeEndpoints(endpoints));
+        _replyCachePinned = true;
+    }
+    return ICE_ENUM(OperationMode, Idempotent);
+}
+
 void
 ProxyOutgoingAsyncBase::runTimerTask()
 {
-    if(_proxy->_getReference()->getInvocationTimeout() == -2)
+    if(_invocationTimeout == -2)
     {
         cancel(ConnectionTimeoutException(__FILE__, __LINE__));
     }
@@ -849,12 +1200,14 @@ ProxyOutgoingAsyncBase::runTimerTask()
 OutgoingAsync::OutgoingAsync(const ObjectPrxPtr& prx, bool synchronous) :
     ProxyOutgoingAsyncBase(prx),
     _encoding(getCompatibleEncoding(prx->_getReference()->getEncoding())),
-    _synchronous(synchronous)
+    _synchronous(synchronous),
+    _deadlinePos(0),
+    _hedgeState(HedgeNone)
 {
 }
 
 void
-OutgoingAsync::prepare(const string& operation, OperationMode mode, const Context& context)
+OutgoingAsync::prepare(const string& operation, const string& typeId, OperationMode mode, const Context& context)
 {
     checkSupportedProtocol(getCompatibleProtocol(_proxy->_getReference()->getProtocol()));
 
@@ -900,6 +1253,21 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
 
     _os.write(static_cast<Byte>(_mode));
 
+    //
+    // The invocation timeout is propagated with the _deadline context
+    // entry. Batch requests are sent later and don't have a deadline.
+    //
+    const bool deadline = _invocationTimeout > 0 && ref->getMode() != Reference::ModeBatchOneway &&
+        ref->getMode() != Reference::ModeBatchDatagram;
+
+    //
+    // The twoway invocations of the Ice.ReplyCache.Operations operations
+    // have a request ID, given by the _rid context entry. The request ID
+    // is generated once, the retries send the same request.
+    //
+    _replyCached = _mode == ICE_ENUM(OperationMode, Normal) && ref->getMode() == Reference::ModeTwoway &&
+        _instance->proxyFactory()->isReplyCached(typeId, operation);
+
 #if defined(_MSC_VER) && (_MSC_VER <= 1600)
     //
     // COMPILERFIX v90 and v100 get confused with namespaces and we need to
@@ -915,7 +1283,16 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         // Explicit context
         //
-        _os.write(context);
+        if(deadline || _replyCached)
+        {
+            Context ctx(context);
+            addEntries(ctx, deadline, _replyCached);
+            writeContext(ctx, deadline);
+        }
+        else
+        {
+            _os.write(context);
+        }
     }
     else
     {
@@ -924,7 +1301,21 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
         const Context& prxContext = ref->getContext()->getValue();
-        if(implicitContext == 0)
+        if(deadline || _replyCached)
+        {
+            Context ctx;
+            if(implicitContext == 0)
+            {
+                ctx = prxContext;
+            }
+            else
+            {
+                implicitContext->combine(prxContext, ctx);
+            }
+            addEntries(ctx, deadline, _replyCached);
+            writeContext(ctx, deadline);
+        }
+        else if(implicitContext == 0)
         {
             _os.write(prxContext);
         }
@@ -933,14 +1324,52 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
             implicitContext->write(prxContext, &_os);
         }
     }
+
+    //
+    // Hedging is enabled with the Hedge proxy property or the
+    // Ice.Hedge.Operations property for idempotent twoway invocations.
+    //
+    if(_mode != ICE_ENUM(OperationMode, Normal) && ref->getMode() == Reference::ModeTwoway &&
+       !ref->getRouterInfo() && dynamic_cast<RoutableReference*>(ref))
+    {
+        const HedgeManagerPtr& hedgeManager = _instance->hedgeManager();
+        if(ref->getHedge() || hedgeManager->isHedged(operation))
+        {
+            _hedgeOperation = operation;
+            _hedgeDelay = hedgeManager->getDelay(operation);
+            _hedgeStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+    }
 }
 
 bool
 OutgoingAsync::sent()
 {
+    if(_hedgeDelay != IceUtil::Time() && _cachedConnection)
+    {
+        scheduleHedge();
+    }
     return ProxyOutgoingAsyncBase::sentImpl(!_proxy->ice_isTwoway()); // done = true if it's not a two-way proxy
 }
 
+bool
+OutgoingAsync::exception(const Exception& ex)
+{
+    if(!_hedgeOperation.empty() && !finishHedge())
+    {
+        //
+        // The invocation was completed by its hedged request, ignore
+        // the cancellation of the request.
+        //
+        if(_childObserver)
+        {
+            _childObserver.detach();
+        }
+        return false;
+    }
+    return ProxyOutgoingAsyncBase::exception(ex);
+}
+
 bool
 OutgoingAsync::response()
 {
@@ -957,6 +1386,16 @@ OutgoingAsync::response()
         _childObserver.detach();
     }
 
+    if(!_hedgeOperation.empty())
+    {
+        if(!finishHedge())
+        {
+            return false; // Already completed by the hedged request.
+        }
+        _instance->hedgeManager()->addLatency(_hedgeOperation,
+                                              IceUtil::Time::now(IceUtil::Time::Monotonic) - _hedgeStart);
+    }
+
     Byte replyStatus;
     try
     {
@@ -977,6 +1416,7 @@ OutgoingAsync::response()
             case replyObjectNotExist:
             case replyFacetNotExist:
             case replyOperationNotExist:
+            case replyServerOverloaded:
             {
                 Identity ident;
                 _is.read(ident);
@@ -1020,6 +1460,14 @@ OutgoingAsync::response()
                         break;
                     }
 
+                    case replyServerOverloaded:
+                    {
+                        ServerOverloadedException* soe = new ServerOverloadedException(__FILE__, __LINE__);
+                        ex.reset(soe);
+                        _is.read(soe->reason, false);
+                        break;
+                    }
+
                     default:
                     {
                         assert(false);
@@ -1088,17 +1536,223 @@ OutgoingAsync::response()
     }
 }
 
+bool
+OutgoingAsync::startHedge(OutputStream* os)
+{
+    Lock sync(_m);
+    if(_hedgeState != HedgeScheduled || !_instance->hedgeManager()->acquireBudget())
+    {
+        return false;
+    }
+    _hedgeState = HedgeSent;
+
+    os->writeBlob(&_os.b[0], _os.b.size());
+    os->b[9] = 0; // Reset the compression status, it's set by the connection.
+    updateDeadline(*os);
+
+    InvocationObserverI* observer = getInvocationObserverI(_observer);
+    if(observer)
+    {
+        observer->hedged();
+    }
+    return true;
+}
+
+bool
+OutgoingAsync::hedgeResponse(InputStream* is)
+{
+    {
+        Lock sync(_m);
+        if(_hedgeState != HedgeSent)
+        {
+            return false;
+        }
+        _hedgeState = HedgeWon;
+        _hedge = ICE_NULLPTR;
+    }
+
+    //
+    // Cancel the request of this invocation. Once canceled, the request
+    // input stream is no longer used by its connection and can be
+    // replaced with the reply of the hedged request.
+    //
+    cancel();
+
+    InvocationObserverI* observer = getInvocationObserverI(_observer);
+    if(observer)
+    {
+        observer->hedgeWon();
+    }
+
+    _instance->hedgeManager()->addLatency(_hedgeOperation, IceUtil::Time::now(IceUtil::Time::Monotonic) - _hedgeStart);
+
+    _is.swap(*is);
+    Byte replyStatus;
+    _is.read(replyStatus);
+    if(replyStatus == replyUserException)
+    {
+        _observer.userException();
+    }
+    return responseImpl(replyStatus == replyOK, true);
+}
+
+void
+OutgoingAsync::scheduleHedge()
+{
+    {
+        Lock sync(_m);
+        if(_hedgeState != HedgeNone)
+        {
+            return; // Only the first request of the invocation is hedged.
+        }
+        _hedgeState = HedgeDone;
+        if(!_instance->hedgeManager()->hasBudget())
+        {
+            return;
+        }
+        _hedgeState = HedgeScheduled;
+    }
+
+    ProxyOutgoingAsyncBasePtr hedge;
+    try
+    {
+        //
+        // The hedged request is sent over a connection distinct from
+        // the connection of this request, to another endpoint if the
+        // proxy has other endpoints.
+        //
+        ReferencePtr ref = _proxy->_getReference();
+        EndpointIPtr endpoint = ICE_DYNAMIC_CAST(ConnectionI, _cachedConnection)->endpoint();
+        vector<EndpointIPtr> endpoints = ref->getEndpoints();
+        vector<EndpointIPtr> others;
+        for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+        {
+            if(!(*p)->equivalent(endpoint))
+            {
+                others.push_back(*p);
+            }
+        }
+        if(!others.empty())
+        {
+            ref = ref->changeEndpoints(others);
+        }
+        ref = ref->changeConnectionId(ref->getConnectionId() + "#hedge");
+        ref = ref->changeCollocationOptimized(false);
+        ref = ref->changeInvocationTimeout(-1);
+
+#ifdef ICE_CPP11_MAPPING
+        OutgoingAsyncPtr self = static_pointer_cast<OutgoingAsync>(shared_from_this());
+#else
+        OutgoingAsyncPtr self = this;
+#endif
+        hedge = ICE_MAKE_SHARED(HedgeOutgoingAsync, _instance->proxyFactory()->referenceToProxy(ref), self, _mode);
+    }
+    catch(const Ice::LocalException&)
+    {
+        return; // Communicator destroyed, don't hedge.
+    }
+
+    {
+        Lock sync(_m);
+        if(_hedgeState != HedgeScheduled)
+        {
+            return;
+        }
+        _hedge = hedge;
+    }
+    static_cast<HedgeOutgoingAsync*>(hedge.get())->start(_hedgeDelay);
+}
+
+bool
+OutgoingAsync::finishHedge()
+{
+    ProxyOutgoingAsyncBasePtr hedge;
+    {
+        Lock sync(_m);
+        if(_hedgeState == HedgeWon)
+        {
+            return false;
+        }
+        _hedgeState = HedgeDone;
+        hedge = _hedge;
+        _hedge = ICE_NULLPTR;
+    }
+    if(hedge)
+    {
+        static_cast<HedgeOutgoingAsync*>(hedge.get())->abandon();
+    }
+    return true;
+}
+
+void
+OutgoingAsync::writeContext(const Context& context, bool deadline)
+{
+    if(!deadline)
+    {
+        _os.write(context);
+        return;
+    }
+
+    //
+    // The _deadline entry is written last, its value is the invocation
+    // timeout with a fixed number of digits so that updateDeadline can
+    // rewrite it with the remaining time when the request is sent.
+    //
+    _os.writeSize(static_cast<Int>(context.size() + 1));
+    for(Context::const_iterator p = context.begin(); p != context.end(); ++p)
+    {
+        _os.write(p->first);
+        _os.write(p->second);
+    }
+    _os.write(string("_deadline"));
+    _deadlinePos = _os.b.size();
+    ostringstream os;
+    os << _invocationTimeout;
+    _os.write(os.str());
+    _deadlineStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+void
+OutgoingAsync::updateDeadline(OutputStream& os)
+{
+    if(_deadlinePos == 0)
+    {
+        return;
+    }
+
+    Long elapsed = (IceUtil::Time::now(IceUtil::Time::Monotonic) - _deadlineStart).toMilliSeconds();
+    Long remaining = max(static_cast<Long>(_invocationTimeout) - elapsed, static_cast<Long>(1));
+
+    //
+    // The value is a string of at most 10 digits, its size is encoded
+    // on one byte followed by the digits, padded with zeros.
+    //
+    Byte* p = &os.b[_deadlinePos];
+    for(Byte* q = p + *p; q > p; --q)
+    {
+        *q = static_cast<Byte>('0' + remaining % 10);
+        remaining /= 10;
+    }
+}
+
 AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
     _cachedConnection = connection;
+    updateDeadline(_os);
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
 
 AsyncStatus
 OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
 {
-    return handler->invokeAsyncRequest(this, 0, _synchronous);
+    updateDeadline(_os);
+
+    //
+    // A synchronous invocation with an invocation timeout isn't
+    // dispatched by the calling thread, to be able to time out.
+    //
+    return handler->invokeAsyncRequest(this, 0, _synchronous && _invocationTimeout <= 0);
 }
 
 void
@@ -1141,6 +1795,7 @@ OutgoingAsync::invoke(const string& operation)
 #ifdef ICE_CPP11_MAPPING
 void
 OutgoingAsync::invoke(const string& operation,
+                      const string& typeId,
                       Ice::OperationMode mode,
                       Ice::FormatType format,
                       const Ice::Context& context,
@@ -1148,7 +1803,7 @@ OutgoingAsync::invoke(const string& operation,
 {
     try
     {
-        prepare(operation, mode, context);
+        prepare(operation, typeId, mode, context);
         if(write)
         {
             _os.startEncapsulation(_encoding, format);
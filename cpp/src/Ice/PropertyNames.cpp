@@ -34,6 +34,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.Hedge", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Router", false, 0),
     IceInternal::Property("Ice.Admin.Locator.CollocationOptimized", false, 0),
@@ -46,6 +48,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Admin.Router.Hedge", false, 0),
     IceInternal::Property("Ice.Admin.Router.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Router.Router", false, 0),
     IceInternal::Property("Ice.Admin.Router.CollocationOptimized", false, 0),
@@ -59,7 +63,17 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("Ice.Admin.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("Ice.Admin.ReplyCache.Size", false, 0),
+    IceInternal::Property("Ice.Admin.ReplyCache.TTL", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
@@ -69,16 +83,24 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Logger.Properties", false, 0),
     IceInternal::Property("Ice.Admin.ServerId", false, 0),
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
+    IceInternal::Property("Ice.LocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
+    IceInternal::Property("Ice.CircuitBreaker.Backoff", false, 0),
+    IceInternal::Property("Ice.CircuitBreaker.ErrorRate", false, 0),
+    IceInternal::Property("Ice.CircuitBreaker.Failures", false, 0),
+    IceInternal::Property("Ice.CircuitBreaker.MaxBackoff", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
+    IceInternal::Property("Ice.ConnectStaggerDelay", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Ice.Default.Hedge", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
@@ -87,6 +109,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Default.Locator.Router", false, 0),
     IceInternal::Property("Ice.Default.Locator.CollocationOptimized", false, 0),
@@ -102,6 +125,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.Router.Locator", false, 0),
     IceInternal::Property("Ice.Default.Router.Router", false, 0),
     IceInternal::Property("Ice.Default.Router.CollocationOptimized", false, 0),
@@ -114,6 +138,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
+    IceInternal::Property("Ice.Hedge.Budget", false, 0),
+    IceInternal::Property("Ice.Hedge.MinDelay", false, 0),
+    IceInternal::Property("Ice.Hedge.Operations", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
@@ -138,6 +165,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.ReplyCache.Operations", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
@@ -152,6 +180,10 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.DispatchPriorities", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.DispatchWeights", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -159,7 +191,15 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.DispatchPriorities", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.DispatchWeights", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.DispatchPriorities", false, 0),
+    IceInternal::Property("Ice.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("Ice.DispatchWeights", false, 0),
+    IceInternal::Property("Ice.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
@@ -220,6 +260,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.Hedge", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.CollocationOptimized", false, 0),
@@ -232,6 +274,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.Hedge", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.CollocationOptimized", false, 0),
@@ -245,7 +289,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
@@ -257,6 +311,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.Hedge", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -269,6 +325,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.Hedge", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -282,7 +340,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
@@ -294,6 +362,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.Hedge", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -306,6 +376,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.Hedge", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -319,7 +391,17 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.RetryCount", false, 0),
@@ -347,6 +429,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Hedge", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -359,6 +443,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.Hedge", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -372,7 +458,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Close", false, 0),
@@ -384,6 +480,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Hedge", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -396,6 +494,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.Hedge", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -409,7 +509,17 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Lookup", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.RetryCount", false, 0),
@@ -457,6 +567,8 @@ const IceInternal::Property IceBoxAdminPropsData[] =
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Hedge", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Locator", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Router", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.CollocationOptimized", false, 0),
@@ -481,6 +593,8 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBridge.Source.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceBridge.Source.Locator.Hedge", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.Locator", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.Router", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.CollocationOptimized", false, 0),
@@ -493,6 +607,8 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Router.PreferSecure", false, 0),
     IceInternal::Property("IceBridge.Source.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBridge.Source.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBridge.Source.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceBridge.Source.Router.Hedge", false, 0),
     IceInternal::Property("IceBridge.Source.Router.Locator", false, 0),
     IceInternal::Property("IceBridge.Source.Router.Router", false, 0),
     IceInternal::Property("IceBridge.Source.Router.CollocationOptimized", false, 0),
@@ -506,7 +622,17 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceBridge.Source.MessageSizeMax", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceBridge.Source.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceBridge.Source.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceBridge.Source.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceBridge.Target.Endpoints", false, 0),
     IceInternal::Property("IceBridge.InstanceName", false, 0),
 };
@@ -536,6 +662,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Locator.Hedge", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.CollocationOptimized", false, 0),
@@ -548,6 +676,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Router.Hedge", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.CollocationOptimized", false, 0),
@@ -561,7 +691,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Address", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Interface", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Lookup", false, 0),
@@ -576,6 +716,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Hedge", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -588,6 +730,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Hedge", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.CollocationOptimized", false, 0),
@@ -601,7 +745,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Close", false, 0),
@@ -613,6 +767,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Hedge", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -625,6 +781,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Hedge", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.CollocationOptimized", false, 0),
@@ -638,7 +796,17 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
 };
@@ -660,6 +828,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.CollocationOptimized", false, 0),
@@ -672,6 +842,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.CollocationOptimized", false, 0),
@@ -685,7 +857,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
@@ -698,6 +880,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.CollocationOptimized", false, 0),
@@ -710,6 +894,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Router.CollocationOptimized", false, 0),
@@ -723,8 +909,19 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Node.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Node.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Node.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
+    IceInternal::Property("IceGrid.Node.ActivationThreads", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
     IceInternal::Property("IceGrid.Node.Data", false, 0),
@@ -747,6 +944,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.Hedge", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Router", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.CollocationOptimized", false, 0),
@@ -759,6 +958,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.CollocationOptimized", false, 0),
@@ -776,6 +977,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.CollocationOptimized", false, 0),
@@ -788,6 +991,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.CollocationOptimized", false, 0),
@@ -801,12 +1006,24 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -823,6 +1040,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.CollocationOptimized", false, 0),
@@ -835,6 +1054,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.CollocationOptimized", false, 0),
@@ -848,7 +1069,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Timeout", false, 0),
@@ -862,6 +1093,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.CollocationOptimized", false, 0),
@@ -874,6 +1107,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.CollocationOptimized", false, 0),
@@ -887,7 +1122,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Port", false, 0),
@@ -904,6 +1149,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.CollocationOptimized", false, 0),
@@ -916,6 +1163,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.CollocationOptimized", false, 0),
@@ -929,15 +1178,29 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
+    IceInternal::Property("IceGrid.Registry.LMDB.SyncMode", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.ObserverUpdateWindow", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -958,6 +1221,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.CollocationOptimized", false, 0),
@@ -970,6 +1235,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.CollocationOptimized", false, 0),
@@ -983,7 +1250,17 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
@@ -996,6 +1273,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.CollocationOptimized", false, 0),
@@ -1008,6 +1287,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.CollocationOptimized", false, 0),
@@ -1021,13 +1302,25 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ReplyCache.Size", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ReplyCache.TTL", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Hedge", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -1067,6 +1360,8 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IcePatch2.Locator.Hedge", false, 0),
     IceInternal::Property("IcePatch2.Locator.Locator", false, 0),
     IceInternal::Property("IcePatch2.Locator.Router", false, 0),
     IceInternal::Property("IcePatch2.Locator.CollocationOptimized", false, 0),
@@ -1079,6 +1374,8 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("IcePatch2.Router.Hedge", false, 0),
     IceInternal::Property("IcePatch2.Router.Locator", false, 0),
     IceInternal::Property("IcePatch2.Router.Router", false, 0),
     IceInternal::Property("IcePatch2.Router.CollocationOptimized", false, 0),
@@ -1092,8 +1389,19 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("IcePatch2.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("IcePatch2.ReplyCache.Size", false, 0),
+    IceInternal::Property("IcePatch2.ReplyCache.TTL", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
+    IceInternal::Property("IcePatch2.FileCacheSize", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
 };
 
@@ -1104,6 +1412,7 @@ const IceInternal::PropertyArray
 const IceInternal::Property IcePatch2ClientPropsData[] =
 {
     IceInternal::Property("IcePatch2Client.ChunkSize", false, 0),
+    IceInternal::Property("IcePatch2Client.ChunkSync", false, 0),
     IceInternal::Property("IcePatch2Client.Directory", false, 0),
     IceInternal::Property("IcePatch2Client.Proxy", false, 0),
     IceInternal::Property("IcePatch2Client.Remove", false, 0),
@@ -1200,6 +1509,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.Hedge", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.CollocationOptimized", false, 0),
@@ -1212,6 +1523,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.Hedge", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Router.CollocationOptimized", false, 0),
@@ -1225,7 +1538,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("Glacier2.Client.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("Glacier2.Client.ReplyCache.Size", false, 0),
+    IceInternal::Property("Glacier2.Client.ReplyCache.TTL", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -1247,6 +1570,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.Hedge", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -1258,6 +1583,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.Hedge", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -1275,6 +1602,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.Hedge", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.CollocationOptimized", false, 0),
@@ -1287,6 +1616,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.Hedge", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Router.CollocationOptimized", false, 0),
@@ -1300,7 +1631,17 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.DispatchPriorities", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.DispatchOperationPriorities", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.DispatchWeights", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.DispatchQueueTimeMax", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit.Latency", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit.Max", false, 0),
+    IceInternal::Property("Glacier2.Server.ConcurrencyLimit.Min", false, 0),
+    IceInternal::Property("Glacier2.Server.ReplyCache.Size", false, 0),
+    IceInternal::Property("Glacier2.Server.ReplyCache.TTL", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
@@ -1312,6 +1653,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.Hedge", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SessionManager.CollocationOptimized", false, 0),
@@ -1322,6 +1665,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLSessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ConnectionPoolSize", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.Hedge", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.CollocationOptimized", false, 0),
@@ -174,7 +174,8 @@ Ice::ObjectPrx::_iceI_isA(const shared_ptr<IceInternal::OutgoingAsyncT<bool>>& o
                           const Context& ctx)
 {
     _checkTwowayOnly(ice_isA_name);
-    outAsync->invoke(ice_isA_name, OperationMode::Nonmutating, ICE_ENUM(FormatType, DefaultFormat), ctx,
+    outAsync->invoke(ice_isA_name, ::Ice::Object::ice_staticId(), OperationMode::Nonmutating,
+                     ICE_ENUM(FormatType, DefaultFormat), ctx,
                      [&](Ice::OutputStream* os)
                      {
                          os->write(typeId, false);
@@ -185,14 +186,16 @@ Ice::ObjectPrx::_iceI_isA(const shared_ptr<IceInternal::OutgoingAsyncT<bool>>& o
 void
 Ice::ObjectPrx::_iceI_ping(const shared_ptr<IceInternal::OutgoingAsyncT<void>>& outAsync, const Context& ctx)
 {
-    outAsync->invoke(ice_ping_name, OperationMode::Nonmutating, ICE_ENUM(FormatType, DefaultFormat), ctx, nullptr, nullptr);
+    outAsync->invoke(ice_ping_name, ::Ice::Object::ice_staticId(), OperationMode::Nonmutating,
+                     ICE_ENUM(FormatType, DefaultFormat), ctx, nullptr, nullptr);
 }
 
 void
 Ice::ObjectPrx::_iceI_ids(const shared_ptr<IceInternal::OutgoingAsyncT<vector<string>>>& outAsync, const Context& ctx)
 {
     _checkTwowayOnly(ice_ids_name);
-    outAsync->invoke(ice_ids_name, OperationMode::Nonmutating, ICE_ENUM(FormatType, DefaultFormat), ctx, nullptr, nullptr,
+    outAsync->invoke(ice_ids_name, ::Ice::Object::ice_staticId(), OperationMode::Nonmutating,
+                     ICE_ENUM(FormatType, DefaultFormat), ctx, nullptr, nullptr,
                      [](Ice::InputStream* stream)
                      {
                          vector<string> v;
@@ -205,7 +208,8 @@ void
 Ice::ObjectPrx::_iceI_id(const shared_ptr<IceInternal::OutgoingAsyncT<string>>& outAsync, const Context& ctx)
 {
     _checkTwowayOnly(ice_id_name);
-    outAsync->invoke(ice_id_name, OperationMode::Nonmutating, ICE_ENUM(FormatType, DefaultFormat), ctx, nullptr, nullptr,
+    outAsync->invoke(ice_id_name, ::Ice::Object::ice_staticId(), OperationMode::Nonmutating,
+                     ICE_ENUM(FormatType, DefaultFormat), ctx, nullptr, nullptr,
                      [](Ice::InputStream* stream)
                      {
                          string v;
@@ -301,7 +305,7 @@ IceProxy::Ice::Object::_iceI_begin_ice_isA(const string& typeId,
     OutgoingAsyncPtr result = new CallbackOutgoing(this, ice_isA_name, del, cookie, sync);
     try
     {
-        result->prepare(ice_isA_name, Nonmutating, ctx);
+        result->prepare(ice_isA_name, ::Ice::Object::ice_staticId(), Nonmutating, ctx);
         ::Ice::OutputStream* ostr = result->startWriteParams(ICE_ENUM(FormatType, DefaultFormat));
         ostr->write(typeId, false);
         result->endWriteParams();
@@ -346,7 +350,7 @@ IceProxy::Ice::Object::_iceI_begin_ice_ping(const Context& ctx,
     OutgoingAsyncPtr result = new CallbackOutgoing(this, ice_ping_name, del, cookie, sync);
     try
     {
-        result->prepare(ice_ping_name, Nonmutating, ctx);
+        result->prepare(ice_ping_name, ::Ice::Object::ice_staticId(), Nonmutating, ctx);
         result->writeEmptyParams();
         result->invoke(ice_ping_name);
     }
@@ -373,7 +377,7 @@ IceProxy::Ice::Object::_iceI_begin_ice_ids(const Context& ctx,
     OutgoingAsyncPtr result = new CallbackOutgoing(this, ice_ids_name, del, cookie, sync);
     try
     {
-        result->prepare(ice_ids_name, Nonmutating, ctx);
+        result->prepare(ice_ids_name, ::Ice::Object::ice_staticId(), Nonmutating, ctx);
         result->writeEmptyParams();
         result->invoke(ice_ids_name);
     }
@@ -417,7 +421,7 @@ IceProxy::Ice::Object::_iceI_begin_ice_id(const Context& ctx,
     OutgoingAsyncPtr result = new CallbackOutgoing(this, ice_id_name, del, cookie, sync);
     try
     {
-        result->prepare(ice_id_name, Nonmutating, ctx);
+        result->prepare(ice_id_name, ::Ice::Object::ice_staticId(), Nonmutating, ctx);
         result->writeEmptyParams();
         result->invoke(ice_id_name);
     }
@@ -520,7 +524,7 @@ IceProxy::Ice::Object::_iceI_begin_ice_invoke(const string& operation,
     OutgoingAsyncPtr result = new CallbackOutgoing(this, ice_invoke_name, del, cookie, sync);
     try
     {
-        result->prepare(operation, mode, ctx);
+        result->prepare(operation, string(), mode, ctx);
         result->writeParamEncaps(inEncaps.first, static_cast<Int>(inEncaps.second - inEncaps.first));
         result->invoke(operation);
     }
@@ -748,7 +752,7 @@ ObjectPrxPtr
 ICE_OBJECT_PRX::ice_context(const Context& newContext) const
 {
     ObjectPrxPtr proxy = _newInstance();
-    proxy->setup(_reference->changeContext(newContext));
+    proxy->setup(_reference->changeContext(newContext), _getCachedRequestHandler());
     return proxy;
 }
 
@@ -772,7 +776,7 @@ ICE_OBJECT_PRX::ice_facet(const string& newFacet) const
 #else
         ObjectPrx proxy = new IceProxy::Ice::Object;
 #endif
-        proxy->setup(_reference->changeFacet(newFacet));
+        proxy->setup(_reference->changeFacet(newFacet), _getCachedRequestHandler());
         return proxy;
     }
 }
@@ -941,7 +945,7 @@ ICE_OBJECT_PRX::ice_encodingVersion(const ::Ice::EncodingVersion& encoding) cons
     else
     {
         ObjectPrxPtr proxy = _newInstance();
-        proxy->setup(_reference->changeEncoding(encoding));
+        proxy->setup(_reference->changeEncoding(encoding), _getCachedRequestHandler());
         return proxy;
     }
 }
@@ -1067,8 +1071,17 @@ ICE_OBJECT_PRX::ice_invocationTimeout(Int newTimeout) const
     }
     else
     {
+        //
+        // The collocated request handler depends on the invocation
+        // timeout, it can't be shared with the new proxy.
+        //
+        RequestHandlerPtr handler = _getCachedRequestHandler();
+        if(dynamic_cast<CollocatedRequestHandler*>(handler.get()))
+        {
+            handler = ICE_NULLPTR;
+        }
         ObjectPrxPtr proxy = _newInstance();
-        proxy->setup(_reference->changeInvocationTimeout(newTimeout));
+        proxy->setup(_reference->changeInvocationTimeout(newTimeout), handler);
         return proxy;
     }
 }
@@ -1290,12 +1303,7 @@ ICE_OBJECT_PRX::ice_fixed(const ::Ice::ConnectionPtr& connection) const
 ConnectionPtr
 ICE_OBJECT_PRX::ice_getCachedConnection() const
 {
-    RequestHandlerPtr handler;
-    {
-        IceUtil::Mutex::Lock sync(_mutex);
-        handler =  _requestHandler;
-    }
-
+    RequestHandlerPtr handler = _getCachedRequestHandler();
     if(handler)
     {
         try
@@ -1310,7 +1318,7 @@ ICE_OBJECT_PRX::ice_getCachedConnection() const
 }
 
 void
-ICE_OBJECT_PRX::setup(const ReferencePtr& ref)
+ICE_OBJECT_PRX::setup(const ReferencePtr& ref, const RequestHandlerPtr& handler)
 {
     //
     // No need to synchronize "*this", as this operation is only
@@ -1321,6 +1329,16 @@ ICE_OBJECT_PRX::setup(const ReferencePtr& ref)
     assert(!_requestHandler);
 
     _reference = ref;
+
+    //
+    // A proxy derived from a proxy with a cached request handler
+    // shares this handler if the reference attributes used by the
+    // handler are unchanged (context, facet, ...).
+    //
+    if(_reference->getCacheConnection())
+    {
+        _requestHandler = handler;
+    }
 }
 
 int
@@ -1344,6 +1362,9 @@ ICE_OBJECT_PRX::_handleException(const Exception& ex,
     // "at-most-once" (see the implementation of the checkRetryAfterException method
     //  of the ProxyFactory class for the reasons why it can be useful).
     //
+    // A request rejected because the server is overloaded isn't dispatched, it can
+    // also always be retried.
+    //
     // If the request didn't get sent or if it's non-mutating or idempotent it can
     // also always be retried if the retry count isn't reached.
     //
@@ -1351,7 +1372,8 @@ ICE_OBJECT_PRX::_handleException(const Exception& ex,
     if(localEx && (!sent ||
                    mode == ICE_ENUM(OperationMode, Nonmutating) || mode == ICE_ENUM(OperationMode, Idempotent) ||
                    dynamic_cast<const CloseConnectionException*>(&ex) ||
-                   dynamic_cast<const ObjectNotExistException*>(&ex)))
+                   dynamic_cast<const ObjectNotExistException*>(&ex) ||
+                   dynamic_cast<const ServerOverloadedException*>(&ex)))
     {
         try
         {
@@ -1375,18 +1397,28 @@ ICE_OBJECT_PRX::_handleException(const Exception& ex,
 ::IceInternal::RequestHandlerPtr
 ICE_OBJECT_PRX::_getRequestHandler()
 {
-    RequestHandlerPtr handler;
     if(_reference->getCacheConnection())
     {
-        IceUtil::Mutex::Lock sync(_mutex);
-        if(_requestHandler)
+        RequestHandlerPtr handler = _getCachedRequestHandler();
+        if(handler)
         {
-            return _requestHandler;
+            return handler;
         }
     }
     return _reference->getRequestHandler(ICE_SHARED_FROM_THIS);
 }
 
+::IceInternal::RequestHandlerPtr
+ICE_OBJECT_PRX::_getCachedRequestHandler() const
+{
+#ifdef ICE_CPP11_MAPPING
+    return atomic_load(&_requestHandler);
+#else
+    IceUtil::Mutex::Lock sync(_mutex);
+    return _requestHandler;
+#endif
+}
+
 IceInternal::BatchRequestQueuePtr
 ICE_OBJECT_PRX::_getBatchRequestQueue()
 {
@@ -1403,12 +1435,21 @@ ICE_OBJECT_PRX::_setRequestHandler(const ::IceInternal::RequestHandlerPtr& handl
 {
     if(_reference->getCacheConnection())
     {
+#ifdef ICE_CPP11_MAPPING
+        RequestHandlerPtr previous;
+        if(atomic_compare_exchange_strong(&_requestHandler, &previous, handler))
+        {
+            return handler;
+        }
+        return previous;
+#else
         IceUtil::Mutex::Lock sync(_mutex);
         if(!_requestHandler)
         {
             _requestHandler = handler;
         }
         return _requestHandler;
+#endif
     }
     return handler;
 }
@@ -1419,27 +1460,38 @@ ICE_OBJECT_PRX::_updateRequestHandler(const ::IceInternal::RequestHandlerPtr& pr
 {
     if(_reference->getCacheConnection() && previous)
     {
+        //
+        // Update the request handler only if "previous" is the same
+        // as the current request handler. This is called after
+        // connection binding by the connect request handler. We only
+        // replace the request handler if the current handler is the
+        // connect request handler.
+        //
+#ifdef ICE_CPP11_MAPPING
+        RequestHandlerPtr current = atomic_load(&_requestHandler);
+        while(current && current.get() != handler.get())
+        {
+            RequestHandlerPtr updated = current->update(previous, handler);
+            if(updated == current || atomic_compare_exchange_weak(&_requestHandler, &current, updated))
+            {
+                break;
+            }
+        }
+#else
         IceUtil::Mutex::Lock sync(_mutex);
         if(_requestHandler && _requestHandler.get() != handler.get())
         {
-            //
-            // Update the request handler only if "previous" is the same
-            // as the current request handler. This is called after
-            // connection binding by the connect request handler. We only
-            // replace the request handler if the current handler is the
-            // connect request handler.
-            //
             _requestHandler = _requestHandler->update(previous, handler);
         }
+#endif
     }
 }
 
 void
 ICE_OBJECT_PRX::_copyFrom(const ObjectPrxPtr& from)
 {
-    IceUtil::Mutex::Lock sync(from->_mutex);
     _reference = from->_reference;
-    _requestHandler = from->_requestHandler;
+    _requestHandler = from->_getCachedRequestHandler();
 }
 
 CommunicatorPtr
@@ -159,11 +159,12 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex, co
             ex.ice_throw();
         }
     }
-    else if(dynamic_cast<const RequestFailedException*>(&ex))
+    else if(dynamic_cast<const RequestFailedException*>(&ex) && !dynamic_cast<const ServerOverloadedException*>(&ex))
     {
         //
         // We don't retry other *NotExistException, which are all
-        // derived from RequestFailedException.
+        // derived from RequestFailedException. A request rejected
+        // because the server is overloaded is retried.
         //
         ex.ice_throw();
     }
@@ -214,6 +215,14 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex, co
         ex.ice_throw();
     }
 
+    //
+    // A request rejected because the server is overloaded wasn't
+    // dispatched, it's retried regardless of the operation mode. The
+    // invocation retries it on the other endpoints of the proxy, if
+    // any, see ProxyOutgoingAsyncBase::exception.
+    //
+    const bool overloaded = dynamic_cast<const ServerOverloadedException*>(&ex);
+
     ++cnt;
     assert(cnt > 0);
 
@@ -248,11 +257,25 @@ IceInternal::ProxyFactory::checkRetryAfterException(const LocalException& ex, co
         {
             out << " in " << interval << "ms";
         }
-        out << " because of exception\n" << ex;
+        if(overloaded)
+        {
+            out << " because the server is overloaded\n" << ex;
+        }
+        else
+        {
+            out << " because of exception\n" << ex;
+        }
     }
     return interval;
 }
 
+bool
+IceInternal::ProxyFactory::isReplyCached(const string& typeId, const string& operation) const
+{
+    return !_replyCacheOperations.empty() &&
+        _replyCacheOperations.find(make_pair(typeId, operation)) != _replyCacheOperations.end();
+}
+
 IceInternal::ProxyFactory::ProxyFactory(const InstancePtr& instance) :
     _instance(instance)
 {
@@ -284,6 +307,30 @@ IceInternal::ProxyFactory::ProxyFactory(const InstancePtr& instance) :
             _retryIntervals.push_back(v > 0 ? v : 0);
         }
     }
+
+    //
+    // The operations are given with the type ID of their interface,
+    // for example ::Demo::Account::transfer. An operation name alone
+    // could match the operation of another interface, implemented by a
+    // server without a reply cache.
+    //
+    StringSeq operations = _instance->initializationData().properties->getPropertyAsList("Ice.ReplyCache.Operations");
+    for(StringSeq::const_iterator p = operations.begin(); p != operations.end(); ++p)
+    {
+        string::size_type pos = p->rfind("::");
+        if(pos == string::npos || pos == 0 || pos + 2 == p->size())
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "invalid operation `" << *p << "' in Ice.ReplyCache.Operations, expected `<type id>::<operation>'";
+            continue;
+        }
+        string typeId = p->substr(0, pos);
+        if(typeId.find("::") != 0)
+        {
+            typeId = "::" + typeId;
+        }
+        _replyCacheOperations.insert(make_pair(typeId, p->substr(pos + 2)));
+    }
 }
 
 IceInternal::ProxyFactory::~ProxyFactory()
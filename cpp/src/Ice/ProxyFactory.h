@@ -15,6 +15,8 @@
 #include <Ice/OutgoingAsyncF.h>
 #include <Ice/Properties.h>
 
+#include <set>
+
 namespace Ice
 {
 
@@ -42,6 +44,15 @@ public:
 
     int checkRetryAfterException(const Ice::LocalException&, const ReferencePtr&, int&) const;
 
+    //
+    // The invocations of the Ice.ReplyCache.Operations operations have
+    // a request ID and are retried like idempotent invocations, their
+    // replies are cached by the object adapters with a reply cache. An
+    // operation is given by the type ID of the interface which defines
+    // it and its name.
+    //
+    bool isReplyCached(const std::string&, const std::string&) const;
+
 private:
 
     ProxyFactory(const InstancePtr&);
@@ -50,6 +61,7 @@ private:
 
     InstancePtr _instance;
     std::vector<int> _retryIntervals;
+    std::set<std::pair<std::string, std::string> > _replyCacheOperations;
 };
 
 }
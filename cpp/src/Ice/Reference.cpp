@@ -22,6 +22,7 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/ConnectionRequestHandler.h>
 #include <Ice/DefaultsAndOverrides.h>
+#include <Ice/CircuitBreaker.h>
 #include <Ice/Comparable.h>
 #include <Ice/StringUtil.h>
 
@@ -651,6 +652,18 @@ IceInternal::FixedReference::getLocatorCacheTimeout() const
     return 0;
 }
 
+int
+IceInternal::FixedReference::getConnectionPoolSize() const
+{
+    return 1;
+}
+
+bool
+IceInternal::FixedReference::getHedge() const
+{
+    return false;
+}
+
 string
 IceInternal::FixedReference::getConnectionId() const
 {
@@ -905,6 +918,8 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
                                                   int invocationTimeout,
+                                                  int connectionPoolSize,
+                                                  bool hedge,
                                                   const Ice::Context& ctx) :
     Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout, ctx),
     _endpoints(endpoints),
@@ -916,6 +931,8 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _preferSecure(preferSecure),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
+    _connectionPoolSize(connectionPoolSize),
+    _hedge(hedge),
     _overrideTimeout(false),
     _timeout(-1)
 {
@@ -976,6 +993,18 @@ IceInternal::RoutableReference::getLocatorCacheTimeout() const
     return _locatorCacheTimeout;
 }
 
+int
+IceInternal::RoutableReference::getConnectionPoolSize() const
+{
+    return _connectionPoolSize;
+}
+
+bool
+IceInternal::RoutableReference::getHedge() const
+{
+    return _hedge;
+}
+
 string
 IceInternal::RoutableReference::getConnectionId() const
 {
@@ -1299,6 +1328,16 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
         s << getInvocationTimeout();
         properties[prefix + ".InvocationTimeout"] = s.str();
     }
+    if(_connectionPoolSize > 1)
+    {
+        ostringstream s;
+        s << _connectionPoolSize;
+        properties[prefix + ".ConnectionPoolSize"] = s.str();
+    }
+    if(_hedge)
+    {
+        properties[prefix + ".Hedge"] = "1";
+    }
     if(_routerInfo)
     {
         PropertyDict routerProperties = _routerInfo->getRouter()->_getReference()->toProperty(prefix + ".Router");
@@ -1397,6 +1436,14 @@ IceInternal::RoutableReference::operator==(const Reference& r) const
     {
         return false;
     }
+    if(_connectionPoolSize != rhs->_connectionPoolSize)
+    {
+        return false;
+    }
+    if(_hedge != rhs->_hedge)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -1528,6 +1575,22 @@ IceInternal::RoutableReference::operator<(const Reference& r) const
     {
         return false;
     }
+    if(_connectionPoolSize < rhs->_connectionPoolSize)
+    {
+        return true;
+    }
+    else if(rhs->_connectionPoolSize < _connectionPoolSize)
+    {
+        return false;
+    }
+    if(!_hedge && rhs->_hedge)
+    {
+        return true;
+    }
+    else if(rhs->_hedge < _hedge)
+    {
+        return false;
+    }
     return false;
 }
 
@@ -1874,6 +1937,8 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _preferSecure(r._preferSecure),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
+    _connectionPoolSize(r._connectionPoolSize),
+    _hedge(r._hedge),
     _overrideTimeout(r._overrideTimeout),
     _timeout(r._timeout),
     _connectionId(r._connectionId)
@@ -2042,5 +2107,10 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
 #endif
     }
 
+    //
+    // The endpoints ejected by the circuit breaker are tried last.
+    //
+    getInstance()->circuitBreaker()->sortEndpoints(endpoints);
+
     return endpoints;
 }
@@ -83,6 +83,8 @@ public:
     virtual bool getPreferSecure() const = 0;
     virtual Ice::EndpointSelectionType getEndpointSelection() const = 0;
     virtual int getLocatorCacheTimeout() const = 0;
+    virtual int getConnectionPoolSize() const = 0;
+    virtual bool getHedge() const = 0;
     virtual std::string getConnectionId() const = 0;
     virtual IceUtil::Optional<int> getTimeout() const = 0;
 
@@ -196,6 +198,8 @@ public:
     virtual bool getPreferSecure() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
+    virtual int getConnectionPoolSize() const;
+    virtual bool getHedge() const;
     virtual std::string getConnectionId() const;
     virtual IceUtil::Optional<int> getTimeout() const;
 
@@ -241,7 +245,7 @@ public:
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
                       const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool,
-                      Ice::EndpointSelectionType, int, int, const Ice::Context&);
+                      Ice::EndpointSelectionType, int, int, int, bool, const Ice::Context&);
 
     virtual std::vector<EndpointIPtr> getEndpoints() const;
     virtual std::string getAdapterId() const;
@@ -252,6 +256,8 @@ public:
     virtual bool getPreferSecure() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
+    virtual int getConnectionPoolSize() const;
+    virtual bool getHedge() const;
     virtual std::string getConnectionId() const;
     virtual IceUtil::Optional<int> getTimeout() const;
 
@@ -312,6 +318,8 @@ private:
     bool _preferSecure;
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
+    int _connectionPoolSize;
+    bool _hedge;
 
     bool _overrideTimeout;
     int _timeout; // Only used if _overrideTimeout == true
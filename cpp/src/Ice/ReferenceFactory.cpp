@@ -668,6 +668,8 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
         "PreferSecure",
         "LocatorCacheTimeout",
         "InvocationTimeout",
+        "ConnectionPoolSize",
+        "Hedge",
         "Locator",
         "Router",
         "CollocationOptimized",
@@ -752,6 +754,8 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
+    int connectionPoolSize = defaultsAndOverrides->defaultConnectionPoolSize;
+    bool hedge = defaultsAndOverrides->defaultHedge;
     Ice::Context ctx;
 
     //
@@ -855,6 +859,24 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             }
         }
 
+        property = propertyPrefix + ".ConnectionPoolSize";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            connectionPoolSize = properties->getPropertyAsIntWithDefault(property, connectionPoolSize);
+            if(connectionPoolSize < 1)
+            {
+                connectionPoolSize = 1;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 1";
+            }
+        }
+
+        property = propertyPrefix + ".Hedge";
+        hedge = properties->getPropertyAsIntWithDefault(property, hedge) > 0;
+
         property = propertyPrefix + ".Context.";
         PropertyDict contexts = properties->getPropertiesForPrefix(property);
         for(PropertyDict::const_iterator p = contexts.begin(); p != contexts.end(); ++p)
@@ -884,5 +906,7 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
                                  endpointSelection,
                                  locatorCacheTimeout,
                                  invocationTimeout,
+                                 connectionPoolSize,
+                                 hedge,
                                  ctx);
 }
@@ -0,0 +1,271 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/ReplyCache.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/OutputStream.h>
+#include <Ice/Protocol.h>
+#include <Ice/ReplyStatus.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(ReplyCache* p) { return p; }
+
+IceInternal::ReplyCache::ReplyCache(const InstancePtr& instance, const string& name) :
+    _instance(instance)
+{
+    PropertiesPtr properties = instance->initializationData().properties;
+    LoggerPtr logger = instance->initializationData().logger;
+
+    int size = properties->getPropertyAsInt(name + ".ReplyCache.Size");
+    assert(size > 0);
+
+    //
+    // The size is split evenly between the shards.
+    //
+    _size = (static_cast<size_t>(size) + shardCount - 1) / shardCount;
+
+    int ttl = properties->getPropertyAsIntWithDefault(name + ".ReplyCache.TTL", 60);
+    if(ttl < 1)
+    {
+        ttl = 60;
+        Warning out(logger);
+        out << "invalid value for " << name << ".ReplyCache.TTL `"
+            << properties->getProperty(name + ".ReplyCache.TTL") << "': defaulting to 60";
+    }
+    _ttl = IceUtil::Time::seconds(ttl);
+}
+
+ResponseHandlerPtr
+IceInternal::ReplyCache::acquire(const Current& current, const string& rid, const ResponseHandlerPtr& handler,
+                                 Byte compress)
+{
+    Waiter waiter;
+    waiter.handler = handler;
+    waiter.requestId = current.requestId;
+    waiter.compress = compress;
+
+    //
+    // The request ID given by the client is scoped by the target and
+    // the operation of the request.
+    //
+    string id = current.id.category;
+    id += '\0';
+    id += current.id.name;
+    id += '\0';
+    id += current.facet;
+    id += '\0';
+    id += current.operation;
+    id += '\0';
+    id += rid;
+
+    vector<Byte> reply;
+    {
+        Shard& shard = getShard(id);
+        IceUtil::Mutex::Lock sync(shard.mutex);
+        evict(shard, IceUtil::Time::now(IceUtil::Time::Monotonic));
+
+        map<string, Entry>::iterator p = shard.entries.find(id);
+        if(p == shard.entries.end())
+        {
+            shard.entries.insert(make_pair(id, Entry()));
+            return ICE_MAKE_SHARED(ReplyCacheResponseHandler, this, id, handler);
+        }
+        else if(!p->second.completed)
+        {
+            //
+            // The request is still dispatched, the retry gets its
+            // reply once it's dispatched.
+            //
+            p->second.waiters.push_back(waiter);
+            return ICE_NULLPTR;
+        }
+        reply = p->second.reply;
+    }
+
+    sendReply(waiter, reply, false);
+    return ICE_NULLPTR;
+}
+
+void
+IceInternal::ReplyCache::completed(const string& id, const OutputStream& os)
+{
+    //
+    // The reply is cached without its header and request ID, these
+    // are written again for each retry.
+    //
+    vector<Byte> reply(os.b.begin() + headerSize + sizeof(Int), os.b.end());
+    vector<Waiter> waiters;
+    {
+        Shard& shard = getShard(id);
+        IceUtil::Mutex::Lock sync(shard.mutex);
+        map<string, Entry>::iterator p = shard.entries.find(id);
+        if(p == shard.entries.end())
+        {
+            return;
+        }
+
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        p->second.completed = true;
+        p->second.reply = reply;
+        p->second.waiters.swap(waiters);
+        shard.completed.push_back(make_pair(now + _ttl, id));
+        evict(shard, now);
+    }
+
+    for(vector<Waiter>::const_iterator q = waiters.begin(); q != waiters.end(); ++q)
+    {
+        sendReply(*q, reply, true);
+    }
+}
+
+void
+IceInternal::ReplyCache::failed(const string& id)
+{
+    //
+    // The request failed without a reply, it's removed from the cache
+    // and it's dispatched again if retried. The retries which wait
+    // for its reply get an UnknownLocalException.
+    //
+    vector<Waiter> waiters;
+    {
+        Shard& shard = getShard(id);
+        IceUtil::Mutex::Lock sync(shard.mutex);
+        map<string, Entry>::iterator p = shard.entries.find(id);
+        if(p == shard.entries.end() || p->second.completed)
+        {
+            return;
+        }
+        p->second.waiters.swap(waiters);
+        shard.entries.erase(p);
+    }
+
+    for(vector<Waiter>::const_iterator q = waiters.begin(); q != waiters.end(); ++q)
+    {
+        sendFailure(*q, "dispatch of the retried request failed without a reply");
+    }
+}
+
+ReplyCache::Shard&
+IceInternal::ReplyCache::getShard(const string& id)
+{
+    //
+    // FNV-1a hash of the scoped request ID.
+    //
+    size_t hash = 2166136261U;
+    for(string::const_iterator p = id.begin(); p != id.end(); ++p)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return _shards[hash % shardCount];
+}
+
+void
+IceInternal::ReplyCache::evict(Shard& shard, const IceUtil::Time& now)
+{
+    //
+    // Must be called with the shard mutex locked.
+    //
+    // The completed requests are ordered by expiration, the requests
+    // which are still dispatched are never evicted.
+    //
+    while(!shard.completed.empty() && (shard.completed.front().first <= now || shard.completed.size() > _size))
+    {
+        shard.entries.erase(shard.completed.front().second);
+        shard.completed.pop_front();
+    }
+}
+
+void
+IceInternal::ReplyCache::sendReply(const Waiter& waiter, const vector<Byte>& reply, bool amd)
+{
+    OutputStream os(_instance.get(), currentProtocolEncoding);
+    os.writeBlob(replyHdr, sizeof(replyHdr));
+    os.write(waiter.requestId);
+    if(!reply.empty())
+    {
+        os.writeBlob(&reply[0], reply.size());
+    }
+    waiter.handler->sendResponse(waiter.requestId, &os, waiter.compress, amd);
+}
+
+void
+IceInternal::ReplyCache::sendFailure(const Waiter& waiter, const string& reason)
+{
+    OutputStream os(_instance.get(), currentProtocolEncoding);
+    os.writeBlob(replyHdr, sizeof(replyHdr));
+    os.write(waiter.requestId);
+    os.write(replyUnknownLocalException);
+    os.write(reason, false);
+    waiter.handler->sendResponse(waiter.requestId, &os, waiter.compress, true);
+}
+
+IceInternal::ReplyCacheResponseHandler::ReplyCacheResponseHandler(const ReplyCachePtr& cache, const string& id,
+                                                                  const ResponseHandlerPtr& handler) :
+    _cache(cache),
+    _id(id),
+    _handler(handler),
+    _completed(false)
+{
+}
+
+IceInternal::ReplyCacheResponseHandler::~ReplyCacheResponseHandler()
+{
+    failed();
+}
+
+void
+IceInternal::ReplyCacheResponseHandler::sendResponse(Int requestId, OutputStream* os, Byte compress, bool amd)
+{
+    //
+    // The reply is cached before it's sent, the response handler can
+    // adopt the buffer of the stream.
+    //
+    if(!_completed)
+    {
+        _completed = true;
+        _cache->completed(_id, *os);
+    }
+    _handler->sendResponse(requestId, os, compress, amd);
+}
+
+void
+IceInternal::ReplyCacheResponseHandler::sendNoResponse()
+{
+    failed();
+    _handler->sendNoResponse();
+}
+
+bool
+IceInternal::ReplyCacheResponseHandler::systemException(Int requestId, const SystemException& ex, bool amd)
+{
+    if(_handler->systemException(requestId, ex, amd))
+    {
+        failed();
+        return true;
+    }
+    return false;
+}
+
+void
+IceInternal::ReplyCacheResponseHandler::invokeException(Int requestId, const LocalException& ex, int invokeNum,
+                                                        bool amd)
+{
+    failed();
+    _handler->invokeException(requestId, ex, invokeNum, amd);
+}
+
+void
+IceInternal::ReplyCacheResponseHandler::failed()
+{
+    if(!_completed)
+    {
+        _completed = true;
+        _cache->failed(_id);
+    }
+}
@@ -0,0 +1,120 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_REPLY_CACHE_H
+#define ICE_REPLY_CACHE_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/ReplyCacheF.h>
+#include <Ice/ResponseHandler.h>
+#include <Ice/InstanceF.h>
+#include <Ice/Current.h>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The reply cache of an object adapter keeps the replies of the
+// requests with a request ID, given by the _rid context entry. A
+// request ID is scoped by the identity, facet and operation of the
+// request, a request with the same ID for another target or
+// operation is dispatched. The
+// clients give a request ID to the invocations of the operations
+// listed by Ice.ReplyCache.Operations, and retry these invocations
+// like the invocations of idempotent operations.
+//
+// A retry of a request isn't dispatched again: it gets the cached
+// reply of the request or, if the request is still dispatched, the
+// reply of the request once it's dispatched. The replies are kept
+// for <adapter>.ReplyCache.TTL seconds, up to <adapter>.ReplyCache.Size
+// replies. The cache is split in shards locked independently.
+//
+class ReplyCache : public IceUtil::Shared
+{
+public:
+
+    ReplyCache(const InstancePtr&, const std::string&);
+
+    //
+    // Returns the response handler of the dispatch with the given
+    // current and request ID, which caches the reply of the request.
+    // Returns null if the request is a retry, its reply is sent with
+    // the given response handler.
+    //
+    ResponseHandlerPtr acquire(const Ice::Current&, const std::string&, const ResponseHandlerPtr&, Ice::Byte);
+    void completed(const std::string&, const Ice::OutputStream&);
+    void failed(const std::string&);
+
+private:
+
+    static const size_t shardCount = 16;
+
+    struct Waiter
+    {
+        ResponseHandlerPtr handler;
+        Ice::Int requestId;
+        Ice::Byte compress;
+    };
+
+    struct Entry
+    {
+        Entry() : completed(false)
+        {
+        }
+
+        bool completed;
+        std::vector<Ice::Byte> reply;
+        std::vector<Waiter> waiters;
+    };
+
+    struct Shard
+    {
+        IceUtil::Mutex mutex;
+        std::map<std::string, Entry> entries;
+        std::deque<std::pair<IceUtil::Time, std::string> > completed;
+    };
+
+    Shard& getShard(const std::string&);
+    void evict(Shard&, const IceUtil::Time&);
+    void sendReply(const Waiter&, const std::vector<Ice::Byte>&, bool);
+    void sendFailure(const Waiter&, const std::string&);
+
+    const InstancePtr _instance;
+    size_t _size;
+    IceUtil::Time _ttl;
+
+    Shard _shards[shardCount];
+};
+
+class ReplyCacheResponseHandler : public ResponseHandler
+{
+public:
+
+    ReplyCacheResponseHandler(const ReplyCachePtr&, const std::string&, const ResponseHandlerPtr&);
+    virtual ~ReplyCacheResponseHandler();
+
+    virtual void sendResponse(Ice::Int, Ice::OutputStream*, Ice::Byte, bool);
+    virtual void sendNoResponse();
+    virtual bool systemException(Ice::Int, const Ice::SystemException&, bool);
+    virtual void invokeException(Ice::Int, const Ice::LocalException&, int, bool);
+
+private:
+
+    void failed();
+
+    const ReplyCachePtr _cache;
+    const std::string _id;
+    const ResponseHandlerPtr _handler;
+    bool _completed;
+};
+
+}
+
+#endif
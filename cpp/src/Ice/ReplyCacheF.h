@@ -0,0 +1,19 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_REPLY_CACHE_F_H
+#define ICE_REPLY_CACHE_F_H
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class ReplyCache;
+IceUtil::Shared* upCast(ReplyCache*);
+typedef Handle<ReplyCache> ReplyCachePtr;
+
+}
+
+#endif
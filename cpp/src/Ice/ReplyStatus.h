@@ -18,6 +18,7 @@ static const Ice::Byte replyOperationNotExist = 4;
 static const Ice::Byte replyUnknownLocalException = 5;
 static const Ice::Byte replyUnknownUserException = 6;
 static const Ice::Byte replyUnknownException = 7;
+static const Ice::Byte replyServerOverloaded = 8;
 
 }
 
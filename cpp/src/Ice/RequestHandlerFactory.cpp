@@ -5,7 +5,7 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/CollocatedRequestHandler.h>
 #include <Ice/ConnectRequestHandler.h>
-#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/ConnectionPoolRequestHandler.h>
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
@@ -29,6 +29,16 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         }
     }
 
+    //
+    // The connections of a pool are obtained independently of the
+    // router, the proxies of a routed reference use a single
+    // connection to the router.
+    //
+    if(ref->getConnectionPoolSize() > 1 && ref->getCacheConnection() && !ref->getRouterInfo())
+    {
+        return proxy->_setRequestHandler(ICE_MAKE_SHARED(ConnectionPoolRequestHandler, ref));
+    }
+
     ConnectRequestHandlerPtr handler;
     bool connect = false;
     if(ref->getCacheConnection())
@@ -17,6 +17,8 @@
 #   include <Ice/StringConverter.h>
 #endif
 
+#include <sstream>
+
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -137,6 +139,202 @@ IceInternal::DispatchWorkItem::execute(ThreadPoolCurrent& current)
     current.dispatchFromThisThread(this);
 }
 
+IceInternal::QueuedDispatchWorkItem::QueuedDispatchWorkItem(const Ice::ConnectionPtr& connection, int priority) :
+    DispatchWorkItem(connection),
+    _priority(priority),
+    _queueTime(IceUtil::Time::now(IceUtil::Time::Monotonic))
+{
+}
+
+IceInternal::DispatchQueue::DispatchQueue(const InstancePtr& instance, const string& prefix, int priorities,
+                                          int dispatchesMax) :
+    _priorities(priorities),
+    _dispatchesMax(dispatchesMax),
+    _queues(static_cast<size_t>(priorities)),
+    _dispatches(0)
+{
+    PropertiesPtr properties = instance->initializationData().properties;
+    LoggerPtr logger = instance->initializationData().logger;
+
+    StringSeq operations = properties->getPropertyAsList(prefix + ".DispatchOperationPriorities");
+    for(StringSeq::const_iterator p = operations.begin(); p != operations.end(); ++p)
+    {
+        string::size_type pos = p->rfind(':');
+        int priority = -1;
+        if(pos != string::npos)
+        {
+            istringstream value(p->substr(pos + 1));
+            if(!(value >> priority) || !value.eof())
+            {
+                priority = -1;
+            }
+        }
+
+        if(pos == 0 || priority < 0 || priority >= _priorities)
+        {
+            Warning out(logger);
+            out << "invalid value for " << prefix << ".DispatchOperationPriorities `" << *p << "': ignoring it";
+            continue;
+        }
+        _operationPriorities[p->substr(0, pos)] = priority;
+    }
+
+    StringSeq weights = properties->getPropertyAsList(prefix + ".DispatchWeights");
+    for(StringSeq::const_iterator p = weights.begin(); p != weights.end(); ++p)
+    {
+        istringstream value(*p);
+        int weight;
+        if(!(value >> weight) || !value.eof() || weight < 1 || weights.size() != _queues.size())
+        {
+            _weights.clear();
+            Warning out(logger);
+            out << "invalid value for " << prefix << ".DispatchWeights `"
+                << properties->getProperty(prefix + ".DispatchWeights") << "': using strict priorities";
+            break;
+        }
+        _weights.push_back(weight);
+    }
+    _currentWeights.resize(_weights.size(), 0);
+
+    int queueTimeMax = properties->getPropertyAsInt(prefix + ".DispatchQueueTimeMax");
+    if(queueTimeMax < 0)
+    {
+        queueTimeMax = 0;
+        Warning out(logger);
+        out << "invalid value for " << prefix << ".DispatchQueueTimeMax `"
+            << properties->getProperty(prefix + ".DispatchQueueTimeMax") << "': defaulting to 0";
+    }
+    _queueTimeMax = IceUtil::Time::milliSeconds(queueTimeMax);
+}
+
+int
+IceInternal::DispatchQueue::getPriority(const string& operation, const Context& context) const
+{
+    //
+    // The _priority context entry overrides the priority of the
+    // operation, the priority is clamped to the priorities of the
+    // queue.
+    //
+    Context::const_iterator p = context.find("_priority");
+    if(p != context.end())
+    {
+        istringstream value(p->second);
+        int priority;
+        if(value >> priority)
+        {
+            return max(0, min(priority, _priorities - 1));
+        }
+    }
+
+    if(!_operationPriorities.empty())
+    {
+        map<string, int>::const_iterator q = _operationPriorities.find(operation);
+        if(q != _operationPriorities.end())
+        {
+            return q->second;
+        }
+    }
+    return 0;
+}
+
+bool
+IceInternal::DispatchQueue::push(const QueuedDispatchWorkItemPtr& workItem, vector<QueuedDispatchWorkItemPtr>& rejected)
+{
+    //
+    // Returns true if the caller can dispatch the queued requests, it
+    // must then call next() until it returns null.
+    //
+    IceUtil::Mutex::Lock sync(_mutex);
+    _queues[static_cast<size_t>(workItem->getPriority())].push_back(workItem);
+    shed(rejected);
+    if(_dispatches < _dispatchesMax)
+    {
+        ++_dispatches;
+        return true;
+    }
+    return false;
+}
+
+QueuedDispatchWorkItemPtr
+IceInternal::DispatchQueue::next(vector<QueuedDispatchWorkItemPtr>& rejected)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    shed(rejected);
+
+    int priority = -1;
+    if(_weights.empty())
+    {
+        for(int i = _priorities - 1; i >= 0; --i)
+        {
+            if(!_queues[static_cast<size_t>(i)].empty())
+            {
+                priority = i;
+                break;
+            }
+        }
+    }
+    else
+    {
+        //
+        // Smooth weighted round-robin over the priorities with queued
+        // requests.
+        //
+        int total = 0;
+        for(int i = _priorities - 1; i >= 0; --i)
+        {
+            size_t j = static_cast<size_t>(i);
+            if(!_queues[j].empty())
+            {
+                _currentWeights[j] += _weights[j];
+                total += _weights[j];
+                if(priority < 0 || _currentWeights[j] > _currentWeights[static_cast<size_t>(priority)])
+                {
+                    priority = i;
+                }
+            }
+        }
+        if(priority >= 0)
+        {
+            _currentWeights[static_cast<size_t>(priority)] -= total;
+        }
+    }
+
+    if(priority < 0)
+    {
+        --_dispatches;
+        return 0;
+    }
+
+    deque<QueuedDispatchWorkItemPtr>& queue = _queues[static_cast<size_t>(priority)];
+    QueuedDispatchWorkItemPtr workItem = queue.front();
+    queue.pop_front();
+    return workItem;
+}
+
+void
+IceInternal::DispatchQueue::shed(vector<QueuedDispatchWorkItemPtr>& rejected)
+{
+    //
+    // Must be called with the mutex locked. The requests with the
+    // highest priority are never shed.
+    //
+    if(_queueTimeMax == IceUtil::Time())
+    {
+        return;
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(size_t i = 0; i < _queues.size() - 1; ++i)
+    {
+        deque<QueuedDispatchWorkItemPtr>& queue = _queues[i];
+        while(!queue.empty() && now - queue.front()->getQueueTime() > _queueTimeMax)
+        {
+            rejected.push_back(queue.front());
+            queue.pop_front();
+        }
+    }
+}
+
 IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool) :
     _threadPool(threadPool),
     _destroyed(false)
@@ -367,6 +565,24 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
         const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
     }
 
+    int priorities = properties->getPropertyAsInt(_prefix + ".DispatchPriorities");
+    if(priorities > 1)
+    {
+        if(_serialize)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".DispatchPriorities is ignored, the requests are serialized";
+        }
+        else
+        {
+            //
+            // One thread of the pool is always available to read the
+            // requests of the connections.
+            //
+            _dispatchQueue = new DispatchQueue(_instance, _prefix, priorities, max(1, _sizeMax - 1));
+        }
+    }
+
     _workQueue = ICE_MAKE_SHARED(ThreadPoolWorkQueue, *this);
     _selector.initialize(_workQueue.get());
 
@@ -568,6 +784,56 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
     }
 }
 
+void
+IceInternal::ThreadPool::dispatchQueued(const QueuedDispatchWorkItemPtr& workItem)
+{
+    assert(_dispatchQueue);
+
+    //
+    // Queue the request and, if this thread can dispatch, dispatch
+    // the queued requests until the queue is empty.
+    //
+    vector<QueuedDispatchWorkItemPtr> shed;
+    bool dispatch = _dispatchQueue->push(workItem, shed);
+    reject(shed);
+    if(dispatch)
+    {
+        QueuedDispatchWorkItemPtr next;
+        while((next = _dispatchQueue->next(shed)))
+        {
+            reject(shed);
+            dispatchFromThisThread(next);
+        }
+        reject(shed);
+    }
+}
+
+void
+IceInternal::ThreadPool::reject(vector<QueuedDispatchWorkItemPtr>& shed)
+{
+    if(shed.empty())
+    {
+        return;
+    }
+
+    if(_instance->traceLevels()->threadPool >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+        out << "rejecting " << shed.size() << " request(s) queued for more than "
+            << _dispatchQueue->getQueueTimeMax().toMilliSeconds() << "ms in " << _prefix;
+    }
+
+    ostringstream os;
+    os << "request queued for more than " << _dispatchQueue->getQueueTimeMax().toMilliSeconds() << "ms in "
+       << _prefix;
+    const string reason = os.str();
+    for(vector<QueuedDispatchWorkItemPtr>::const_iterator p = shed.begin(); p != shed.end(); ++p)
+    {
+        (*p)->reject(reason);
+    }
+    shed.clear();
+}
+
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
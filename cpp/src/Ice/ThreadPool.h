@@ -9,9 +9,11 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Thread.h>
+#include <IceUtil/Time.h>
 
 #include <Ice/Config.h>
 #include <Ice/Dispatcher.h>
+#include <Ice/Current.h>
 #include <Ice/ThreadPoolF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/LoggerF.h>
@@ -23,6 +25,8 @@
 
 #include <set>
 #include <list>
+#include <map>
+#include <deque>
 
 namespace IceInternal
 {
@@ -61,6 +65,78 @@ private:
 };
 typedef IceUtil::Handle<DispatchWorkItem> DispatchWorkItemPtr;
 
+//
+// A request dispatch queued by the dispatch queue of a thread pool.
+// reject() is called instead of run() if the dispatch is shed, the
+// request is rejected with ServerOverloadedException.
+//
+class QueuedDispatchWorkItem : public DispatchWorkItem
+{
+public:
+
+    QueuedDispatchWorkItem(const Ice::ConnectionPtr&, int);
+
+    int getPriority() const
+    {
+        return _priority;
+    }
+
+    const IceUtil::Time& getQueueTime() const
+    {
+        return _queueTime;
+    }
+
+    virtual void reject(const std::string&) = 0;
+
+private:
+
+    const int _priority;
+    const IceUtil::Time _queueTime;
+};
+typedef IceUtil::Handle<QueuedDispatchWorkItem> QueuedDispatchWorkItemPtr;
+
+//
+// The dispatch queue of a thread pool is enabled with the
+// DispatchPriorities property of the thread pool. The requests are
+// queued by priority and at most SizeMax - 1 threads of the pool
+// dispatch them concurrently, the highest priority first or in
+// proportion to the DispatchWeights of the priorities. The requests
+// below the highest priority are shed once they are queued for longer
+// than DispatchQueueTimeMax.
+//
+class DispatchQueue : public IceUtil::Shared
+{
+public:
+
+    DispatchQueue(const InstancePtr&, const std::string&, int, int);
+
+    int getPriority(const std::string&, const Ice::Context&) const;
+
+    bool push(const QueuedDispatchWorkItemPtr&, std::vector<QueuedDispatchWorkItemPtr>&);
+    QueuedDispatchWorkItemPtr next(std::vector<QueuedDispatchWorkItemPtr>&);
+
+    const IceUtil::Time& getQueueTimeMax() const
+    {
+        return _queueTimeMax;
+    }
+
+private:
+
+    void shed(std::vector<QueuedDispatchWorkItemPtr>&);
+
+    const int _priorities;
+    const int _dispatchesMax;
+    std::map<std::string, int> _operationPriorities;
+    std::vector<int> _weights;
+    IceUtil::Time _queueTimeMax;
+
+    IceUtil::Mutex _mutex;
+    std::vector<std::deque<QueuedDispatchWorkItemPtr> > _queues;
+    std::vector<int> _currentWeights;
+    int _dispatches;
+};
+typedef IceUtil::Handle<DispatchQueue> DispatchQueuePtr;
+
 class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
 {
     class EventHandlerThread : public IceUtil::Thread
@@ -106,6 +182,12 @@ public:
     void dispatchFromThisThread(const DispatchWorkItemPtr&);
     void dispatch(const DispatchWorkItemPtr&);
 
+    const DispatchQueuePtr& getDispatchQueue() const
+    {
+        return _dispatchQueue;
+    }
+    void dispatchQueued(const QueuedDispatchWorkItemPtr&);
+
     void joinWithAllThreads();
 
     std::string prefix() const;
@@ -116,6 +198,8 @@ private:
 
     bool ioCompleted(ThreadPoolCurrent&);
 
+    void reject(std::vector<QueuedDispatchWorkItemPtr>&);
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     bool startMessage(ThreadPoolCurrent&);
     void finishMessage(ThreadPoolCurrent&);
@@ -152,6 +236,7 @@ private:
     const int _serverIdleTime;
     const int _threadIdleTime;
     const size_t _stackSize;
+    DispatchQueuePtr _dispatchQueue;
 
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
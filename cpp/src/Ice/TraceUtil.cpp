@@ -243,6 +243,7 @@ printReply(ostream& s, InputStream& stream)
     case replyObjectNotExist:
     case replyFacetNotExist:
     case replyOperationNotExist:
+    case replyServerOverloaded:
     {
         switch(replyStatus)
         {
@@ -264,6 +265,12 @@ printReply(ostream& s, InputStream& stream)
             break;
         }
 
+        case replyServerOverloaded:
+        {
+            s << "(server overloaded)";
+            break;
+        }
+
         default:
         {
             assert(false);
@@ -272,6 +279,12 @@ printReply(ostream& s, InputStream& stream)
         }
 
         printIdentityFacetOperation(s, stream);
+        if(replyStatus == replyServerOverloaded)
+        {
+            string reason;
+            stream.read(reason, false);
+            s << "\nreason = " << reason;
+        }
         break;
     }
 
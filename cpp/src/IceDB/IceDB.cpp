@@ -3,7 +3,9 @@
 //
 
 #include <IceDB/IceDB.h>
+#include <IceUtil/StringUtil.h>
 #include <Ice/Initialize.h>
+#include <Ice/UniquePtr.h>
 
 #include <lmdb.h>
 
@@ -139,7 +141,89 @@ BadEnvException::ice_throw() const
     throw *this;
 }
 
-Env::Env(const string& path, MDB_dbi maxDbs, size_t mapSize, unsigned int maxReaders)
+//
+// A mutation queued by Env::groupCommit
+//
+struct Env::GroupCommitRequest
+{
+    GroupCommitRequest(Mutation& m) :
+        mutation(m),
+        done(false)
+    {
+    }
+
+    //
+    // Must be called from a catch block
+    //
+    void setException()
+    {
+#ifdef ICE_CPP11_MAPPING
+        exception = std::current_exception();
+#else
+        try
+        {
+            throw;
+        }
+        catch(const IceUtil::Exception& ex)
+        {
+            exception.reset(ex.ice_clone());
+        }
+        catch(const std::exception& ex)
+        {
+            error = ex.what();
+        }
+        catch(...)
+        {
+            error = "unknown exception";
+        }
+#endif
+    }
+
+    bool failed() const
+    {
+#ifdef ICE_CPP11_MAPPING
+        return exception != nullptr;
+#else
+        return exception.get() != 0 || !error.empty();
+#endif
+    }
+
+    void throwException() const
+    {
+#ifdef ICE_CPP11_MAPPING
+        if(exception)
+        {
+            std::rethrow_exception(exception);
+        }
+#else
+        if(exception.get())
+        {
+            exception->ice_throw();
+        }
+        if(!error.empty())
+        {
+            throw runtime_error(error);
+        }
+#endif
+    }
+
+    Mutation& mutation;
+    bool done;
+#ifdef ICE_CPP11_MAPPING
+    std::exception_ptr exception;
+#else
+    IceInternal::UniquePtr<IceUtil::Exception> exception;
+    string error;
+#endif
+};
+
+Mutation::~Mutation()
+{
+    // Out of line to avoid weak vtable
+}
+
+Env::Env(const string& path, MDB_dbi maxDbs, size_t mapSize, unsigned int maxReaders, unsigned int flags) :
+    _committing(false)
 {
     int rc = mdb_env_create(&_menv);
     if(rc != MDB_SUCCESS)
@@ -188,7 +272,7 @@ Env::Env(const string& path, MDB_dbi maxDbs, size_t mapSize, unsigned int maxRea
         }
     }
 
-    rc = mdb_env_open(_menv, path.c_str(), 0, 0644);
+    rc = mdb_env_open(_menv, path.c_str(), flags, 0644);
     if(rc != MDB_SUCCESS)
     {
         throw LMDBException(__FILE__, __LINE__, rc);
@@ -222,6 +306,81 @@ Env::menv() const
     return _menv;
 }
 
+void
+Env::groupCommit(Mutation& mutation) const
+{
+    GroupCommitRequest request(mutation);
+
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+    _queue.push_back(&request);
+    while(!request.done)
+    {
+        if(_committing)
+        {
+            _monitor.wait();
+            continue;
+        }
+
+        //
+        // No batch is being committed: this thread commits all the
+        // queued mutations, including its own, in one transaction.
+        //
+        _committing = true;
+        vector<GroupCommitRequest*> batch;
+        batch.swap(_queue);
+
+        sync.release();
+        commitBatch(batch);
+        sync.acquire();
+
+        for(vector<GroupCommitRequest*>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            (*p)->done = true;
+        }
+        _committing = false;
+        _monitor.notifyAll();
+    }
+
+    request.throwException();
+}
+
+void
+Env::commitBatch(const vector<GroupCommitRequest*>& batch) const
+{
+    try
+    {
+        ReadWriteTxn txn(*this);
+        for(vector<GroupCommitRequest*>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            try
+            {
+                ReadWriteTxn nested(*this, txn);
+                (*p)->mutation.execute(nested);
+                nested.commit();
+            }
+            catch(...)
+            {
+                (*p)->setException();
+            }
+        }
+        txn.commit();
+    }
+    catch(...)
+    {
+        //
+        // The transaction couldn't be created or committed, none of
+        // the mutations were applied.
+        //
+        for(vector<GroupCommitRequest*>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            if(!(*p)->failed())
+            {
+                (*p)->setException();
+            }
+        }
+    }
+}
+
 Txn::Txn(const Env& env, unsigned int flags)
 {
     const int rc = mdb_txn_begin(env.menv(), 0, flags, &_mtxn);
@@ -231,6 +390,15 @@ Txn::Txn(const Env& env, unsigned int flags)
     }
 }
 
+Txn::Txn(const Env& env, const Txn& parent, unsigned int flags)
+{
+    const int rc = mdb_txn_begin(env.menv(), parent.mtxn(), flags, &_mtxn);
+    if(rc != MDB_SUCCESS)
+    {
+        throw LMDBException(__FILE__, __LINE__, rc);
+    }
+}
+
 Txn::~Txn()
 {
     rollback();
@@ -299,6 +467,11 @@ ReadWriteTxn::ReadWriteTxn(const Env& env) :
 {
 }
 
+ReadWriteTxn::ReadWriteTxn(const Env& env, const ReadWriteTxn& parent) :
+    Txn(env, parent, 0)
+{
+}
+
 DbiBase::DbiBase(const Txn& txn, const std::string& name, unsigned int flags, MDB_cmp_func* cmp)
 {
     int rc = mdb_dbi_open(txn.mtxn(), name.c_str(), flags, &_mdbi);
@@ -499,3 +672,25 @@ IceDB::getMapSize(int configValue)
 
    return ((configValue <= 0) ? defaultMapSize : configValue) * 1024 * 1024;
 }
+
+unsigned int
+IceDB::getSyncFlags(const string& configValue)
+{
+    const string mode = IceUtilInternal::toLower(configValue);
+    if(mode.empty() || mode == "sync")
+    {
+        return 0;
+    }
+    else if(mode == "nometasync")
+    {
+        return MDB_NOMETASYNC;
+    }
+    else if(mode == "nosync")
+    {
+        return MDB_NOSYNC;
+    }
+    else
+    {
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, "invalid LMDB sync mode `" + configValue + "'");
+    }
+}
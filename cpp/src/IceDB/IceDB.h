@@ -7,6 +7,8 @@
 
 #include <IceUtil/Exception.h>
 #include <IceUtil/FileUtil.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Mutex.h>
 #include <Ice/Initialize.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
@@ -142,24 +144,57 @@ private:
 template<typename T, typename C, typename H>
 struct Codec;
 
+class ReadWriteTxn;
+
+//
+// A Mutation updates the database within a write transaction
+// provided by Env::groupCommit
+//
+class ICE_DB_API Mutation
+{
+public:
+
+    virtual ~Mutation();
+
+    virtual void execute(const ReadWriteTxn&) = 0;
+};
+
 class ICE_DB_API Env
 {
 public:
 
-    explicit Env(const std::string&, MDB_dbi = 0, size_t = 0, unsigned int = 0);
+    explicit Env(const std::string&, MDB_dbi = 0, size_t = 0, unsigned int = 0, unsigned int = 0);
     ~Env();
 
     void close();
 
     MDB_env* menv() const;
 
+    //
+    // Executes the mutation in a nested transaction of a write
+    // transaction shared with the mutations of concurrent callers,
+    // and returns once this write transaction is committed. The
+    // mutation can be executed by another thread; neither the
+    // mutation nor the caller can hold another write transaction.
+    // If the mutation raises an exception, only its own changes are
+    // rolled back and groupCommit raises this exception.
+    //
+    void groupCommit(Mutation&) const;
+
 private:
 
     // Not implemented: class is not copyable
     Env(const Env&);
     void operator=(const Env&);
 
+    struct GroupCommitRequest;
+    void commitBatch(const std::vector<GroupCommitRequest*>&) const;
+
     MDB_env* _menv;
+
+    mutable IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    mutable std::vector<GroupCommitRequest*> _queue;
+    mutable bool _committing;
 };
 
 class ICE_DB_API Txn
@@ -176,6 +211,7 @@ public:
 protected:
 
     explicit Txn(const Env&, unsigned int);
+    Txn(const Env&, const Txn&, unsigned int);
 
     MDB_txn* _mtxn;
 
@@ -205,6 +241,11 @@ public:
     virtual ~ReadWriteTxn();
 
     explicit ReadWriteTxn(const Env&);
+
+    //
+    // Creates a transaction nested in the given parent transaction
+    //
+    ReadWriteTxn(const Env&, const ReadWriteTxn&);
 };
 
 class ICE_DB_API DbiBase
@@ -404,6 +445,22 @@ public:
         return false;
     }
 
+    //
+    // Moves the cursor like get but only unmarshals the data, the key
+    // is not read from the database pages. This is typically used with
+    // MDB_NEXT_DUP to iterate over the data of a key.
+    //
+    bool getData(D& data, MDB_cursor_op op)
+    {
+        MDB_val mkey, mdata;
+        if(CursorBase::get(&mkey, &mdata, op))
+        {
+            Codec<D, C, H>::read(data, mdata, _marshalingContext);
+            return true;
+        }
+        return false;
+    }
+
     bool find(const K& key)
     {
         unsigned char kbuf[maxKeySize];
@@ -537,6 +594,16 @@ struct Codec<T, IceContext, Ice::OutputStream>
 
 ICE_DB_API size_t getMapSize(int);
 
+//
+// Returns the LMDB environment flags for the given sync mode:
+// - Sync (the default): commits are flushed to disk
+// - NoMetaSync: the meta page is not flushed, a system crash may undo
+//   the last committed transaction but never corrupts the database
+// - NoSync: commits are not flushed, a system crash may lose the last
+//   committed transactions or corrupt the database
+//
+ICE_DB_API unsigned int getSyncFlags(const std::string&);
+
 }
 
 #endif
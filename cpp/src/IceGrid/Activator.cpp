@@ -36,6 +36,19 @@
 #   include <grp.h> // for setgroups
 #endif
 
+//
+// posix_spawn can only preserve the working directory and the closing of
+// the inherited file descriptors with the posix_spawn_file_actions_addchdir_np
+// and posix_spawn_file_actions_addclosefrom_np extensions of glibc 2.34.
+//
+#if defined(__GLIBC__)
+#   if __GLIBC_PREREQ(2, 34)
+#      include <spawn.h>
+#      define ICE_GRID_POSIX_SPAWN
+extern char** environ;
+#   endif
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -67,6 +80,27 @@ private:
     Activator& _activator;
 };
 
+class ActivationThread : public IceUtil::Thread
+{
+public:
+
+    ActivationThread(Activator& activator) :
+        IceUtil::Thread("IceGrid activation thread"),
+        _activator(activator)
+    {
+    }
+
+    virtual
+    void run()
+    {
+        _activator.runActivations();
+    }
+
+private:
+
+    Activator& _activator;
+};
+
 #ifndef _WIN32
 //
 // Helper function for async-signal safe error reporting
@@ -100,6 +134,72 @@ reportChildError(int err, int fd, const char* cannot, const char* name, const Tr
     _exit(EXIT_FAILURE);
 }
 
+#ifdef ICE_GRID_POSIX_SPAWN
+//
+// The server process is created with posix_spawn if it runs with the
+// user and group ids of the node and if its environment doesn't change
+// the PATH used to find its executable. Otherwise, fork is used to
+// switch the user and setup the environment before exec.
+//
+bool
+canSpawn(const string& path, uid_t uid, gid_t gid, const StringSeq& envs)
+{
+    if(uid == 0 || uid != getuid() || uid != geteuid() || gid != getgid() || gid != getegid())
+    {
+        return false;
+    }
+
+    if(path.find('/') == string::npos)
+    {
+        for(StringSeq::const_iterator p = envs.begin(); p != envs.end(); ++p)
+        {
+            if(*p == "PATH" || p->compare(0, 5, "PATH=") == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+//
+// The environment of the node with the server environment variables. As
+// with putenv, a variable without a value is removed.
+//
+StringSeq
+spawnEnvironment(const StringSeq& envs)
+{
+    StringSeq env;
+    for(char** p = environ; *p != 0; ++p)
+    {
+        env.push_back(*p);
+    }
+
+    for(StringSeq::const_iterator p = envs.begin(); p != envs.end(); ++p)
+    {
+        string::size_type pos = p->find('=');
+        string name = p->substr(0, pos);
+        StringSeq::iterator q = env.begin();
+        while(q != env.end())
+        {
+            if(q->size() > name.size() && q->compare(0, name.size(), name) == 0 && (*q)[name.size()] == '=')
+            {
+                q = env.erase(q);
+            }
+            else
+            {
+                ++q;
+            }
+        }
+        if(pos != string::npos)
+        {
+            env.push_back(*p);
+        }
+    }
+    return env;
+}
+#endif
+
 #endif
 
 string
@@ -287,9 +387,47 @@ extern "C" void CALLBACK activatorWaitCallback(PVOID data, BOOLEAN)
 }
 #endif
 
-Activator::Activator(const TraceLevelsPtr& traceLevels) :
+//
+// The activator isn't locked while the server process is created, the
+// guard counts the activations in progress. The activator can't be
+// destroyed and the termination listener can't stop until they are
+// completed.
+//
+class Activator::ActivationGuard
+{
+public:
+
+    ActivationGuard(Activator& activator) :
+        _activator(activator)
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(_activator);
+        if(_activator._deactivating)
+        {
+            throw runtime_error("The node is being shutdown.");
+        }
+        ++_activator._activating;
+    }
+
+    ~ActivationGuard()
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(_activator);
+        if(--_activator._activating == 0 && _activator._deactivating)
+        {
+            _activator.setInterrupt();
+            _activator.notifyAll();
+        }
+    }
+
+private:
+
+    Activator& _activator;
+};
+
+Activator::Activator(const TraceLevelsPtr& traceLevels, int activationThreads) :
     _traceLevels(traceLevels),
-    _deactivating(false)
+    _deactivating(false),
+    _activating(0),
+    _activationThreads(activationThreads)
 {
 #ifdef _WIN32
     _hIntr = CreateEvent(
@@ -346,12 +484,7 @@ Activator::activate(const string& name,
                     const Ice::StringSeq& envs,
                     const ServerIPtr& server)
 {
-    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
-
-    if(_deactivating)
-    {
-        throw runtime_error("The node is being shutdown.");
-    }
+    ActivationGuard guard(*this);
 
     string path = exePath;
     if(path.empty())
@@ -597,6 +730,8 @@ Activator::activate(const string& name,
     process.pid = pi.dwProcessId;
     process.hnd = pi.hProcess;
     process.server = server;
+
+    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
     map<string, Process>::iterator it = _processes.insert(make_pair(name, process)).first;
 
     Process* pp = &it->second;
@@ -660,201 +795,289 @@ Activator::activate(const string& name,
         throw SyscallException(__FILE__, __LINE__, getSystemErrno());
     }
 
-    int errorFds[2];
-    if(pipe(errorFds) != 0)
-    {
-        throw SyscallException(__FILE__, __LINE__, getSystemErrno());
-    }
-
     //
     // Convert to standard argc/argv.
     //
     IceInternal::ArgVector av(args);
-    IceInternal::ArgVector env(envs);
 
     //
     // Current directory
     //
     const char* pwdCStr = pwd.c_str();
 
-    pid_t pid = fork();
-    if(pid == -1)
+    pid_t pid;
+#ifdef ICE_GRID_POSIX_SPAWN
+    if(canSpawn(path, uid, gid, envs))
     {
-        throw SyscallException(__FILE__, __LINE__, getSystemErrno());
-    }
-
-    if(pid == 0) // Child process.
-    {
-        //
-        // Until exec, we can only use async-signal safe functions
-        //
+        IceInternal::ArgVector env(spawnEnvironment(envs));
 
         //
-        // Unblock signals blocked by IceUtil::CtrlCHandler.
+        // The spawned process gets its own process group and the signals
+        // blocked by IceUtil::CtrlCHandler are unblocked. The write side
+        // of the pipe is its only file descriptor besides the standard
+        // input, output and error.
         //
+        posix_spawnattr_t attr;
+        posix_spawnattr_init(&attr);
         sigset_t sigs;
-        sigemptyset(&sigs);
-        sigaddset(&sigs, SIGHUP);
-        sigaddset(&sigs, SIGINT);
-        sigaddset(&sigs, SIGTERM);
-        sigprocmask(SIG_UNBLOCK, &sigs, 0);
-
-        //
-        // Change the uid/gid under which the process will run.
-        //
-        if(setgid(gid) == -1)
+        pthread_sigmask(SIG_SETMASK, 0, &sigs);
+        sigdelset(&sigs, SIGHUP);
+        sigdelset(&sigs, SIGINT);
+        sigdelset(&sigs, SIGTERM);
+        posix_spawnattr_setsigmask(&attr, &sigs);
+        posix_spawnattr_setpgroup(&attr, 0);
+        posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETPGROUP);
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        if(strlen(pwdCStr) != 0)
         {
-            ostringstream os;
-            os << gid;
-            reportChildError(getSystemErrno(), errorFds[1], "cannot set process group id", os.str().c_str(),
-                             _traceLevels);
+            posix_spawn_file_actions_addchdir_np(&actions, pwdCStr);
         }
+        posix_spawn_file_actions_adddup2(&actions, fds[1], 3);
+        posix_spawn_file_actions_addclosefrom_np(&actions, 4);
 
-        //
-        // Don't initialize supplementary groups if we are not running as root.
-        //
-        if(getuid() == 0 && setgroups(groups.size(), &groups[0]) == -1)
+        int spawnErr = posix_spawnp(&pid, av.argv[0], &actions, &attr, av.argv, env.argv);
+
+        posix_spawn_file_actions_destroy(&actions);
+        posix_spawnattr_destroy(&attr);
+
+        close(fds[1]);
+        if(spawnErr != 0)
         {
+            close(fds[0]);
+
             ostringstream os;
-            os << pw->pw_name;
-            reportChildError(getSystemErrno(), errorFds[1], "cannot set process supplementary groups", os.str().c_str(),
-                                                             _traceLevels);
+            if(strlen(pwdCStr) != 0 && access(pwdCStr, X_OK) != 0)
+            {
+                os << "cannot change working directory to `" << pwd << "'";
+            }
+            else
+            {
+                os << "cannot execute `" << av.argv[0] << "'";
+            }
+            os << ": " << IceUtilInternal::errorToString(spawnErr) << endl;
+            throw runtime_error(os.str());
         }
-
-        if(setuid(uid) == -1)
+    }
+    else
+#endif
+    {
+        int errorFds[2];
+        if(pipe(errorFds) != 0)
         {
-            ostringstream os;
-            os << uid;
-            reportChildError(getSystemErrno(), errorFds[1], "cannot set process user id", os.str().c_str(),
-                             _traceLevels);
+            close(fds[0]);
+            close(fds[1]);
+            throw SyscallException(__FILE__, __LINE__, getSystemErrno());
         }
 
-        //
-        // Assign a new process group for this process.
-        //
-        setpgid(0, 0);
+        IceInternal::ArgVector env(envs);
 
-        //
-        // Close all file descriptors, except for standard input,
-        // standard output, standard error, and the write side
-        // of the newly created pipe.
-        //
-        int maxFd = static_cast<int>(sysconf(_SC_OPEN_MAX));
-        for(int fd = 3; fd < maxFd; ++fd)
+        pid = fork();
+        if(pid == -1)
         {
-            if(fd != fds[1] && fd != errorFds[1])
-            {
-                close(fd);
-            }
+            int forkErr = getSystemErrno();
+            close(fds[0]);
+            close(fds[1]);
+            close(errorFds[0]);
+            close(errorFds[1]);
+            throw SyscallException(__FILE__, __LINE__, forkErr);
         }
 
-        for(int i = 0; i < env.argc; i++)
+        if(pid == 0) // Child process.
         {
             //
-            // Each env is leaked on purpose ... see man putenv().
+            // Until exec, we can only use async-signal safe functions
             //
-            if(putenv(strdup(env.argv[i])) != 0)
+
+            //
+            // Unblock signals blocked by IceUtil::CtrlCHandler.
+            //
+            sigset_t sigs;
+            sigemptyset(&sigs);
+            sigaddset(&sigs, SIGHUP);
+            sigaddset(&sigs, SIGINT);
+            sigaddset(&sigs, SIGTERM);
+            sigprocmask(SIG_UNBLOCK, &sigs, 0);
+
+            //
+            // Change the uid/gid under which the process will run.
+            //
+            if(setgid(gid) == -1)
             {
-                reportChildError(errno, errorFds[1], "cannot set environment variable",  env.argv[i],
+                ostringstream os;
+                os << gid;
+                reportChildError(getSystemErrno(), errorFds[1], "cannot set process group id", os.str().c_str(),
                                  _traceLevels);
             }
-        }
 
-        //
-        // Change working directory.
-        //
-        if(strlen(pwdCStr) != 0)
-        {
-            if(chdir(pwdCStr) == -1)
+            //
+            // Don't initialize supplementary groups if we are not running as root.
+            //
+            if(getuid() == 0 && setgroups(groups.size(), &groups[0]) == -1)
             {
-                reportChildError(errno, errorFds[1], "cannot change working directory to",  pwdCStr,
+                ostringstream os;
+                os << pw->pw_name;
+                reportChildError(getSystemErrno(), errorFds[1], "cannot set process supplementary groups",
+                                 os.str().c_str(), _traceLevels);
+            }
+
+            if(setuid(uid) == -1)
+            {
+                ostringstream os;
+                os << uid;
+                reportChildError(getSystemErrno(), errorFds[1], "cannot set process user id", os.str().c_str(),
                                  _traceLevels);
             }
-        }
 
-        //
-        // Close on exec the error message file descriptor.
-        //
-        int flags = fcntl(errorFds[1], F_GETFD);
-        flags |= 1; // FD_CLOEXEC
-        if(fcntl(errorFds[1], F_SETFD, flags) == -1)
-        {
-            close(errorFds[1]);
-            errorFds[1] = -1;
-        }
+            //
+            // Assign a new process group for this process.
+            //
+            setpgid(0, 0);
 
-        if(execvp(av.argv[0], av.argv) == -1)
-        {
-            if(errorFds[1] != -1)
+            //
+            // Close all file descriptors, except for standard input,
+            // standard output, standard error, and the write side
+            // of the newly created pipe.
+            //
+            int maxFd = static_cast<int>(sysconf(_SC_OPEN_MAX));
+            for(int fd = 3; fd < maxFd; ++fd)
             {
-                reportChildError(errno, errorFds[1], "cannot execute",  av.argv[0], _traceLevels);
+                if(fd != fds[1] && fd != errorFds[1])
+                {
+                    close(fd);
+                }
             }
-            else
+
+            for(int i = 0; i < env.argc; i++)
             {
-                reportChildError(errno, fds[1], "cannot execute",  av.argv[0], _traceLevels);
+                //
+                // Each env is leaked on purpose ... see man putenv().
+                //
+                if(putenv(strdup(env.argv[i])) != 0)
+                {
+                    reportChildError(errno, errorFds[1], "cannot set environment variable",  env.argv[i],
+                                     _traceLevels);
+                }
             }
-        }
-    }
-    else // Parent process.
-    {
-        close(fds[1]);
-        close(errorFds[1]);
 
-        //
-        // Read a potential error message over the error message pipe.
-        //
-        char s[16];
-        ssize_t rs;
-        string message;
-        while((rs = read(errorFds[0], &s, 16)) > 0)
-        {
-            message.append(s, rs);
-        }
+            //
+            // Change working directory.
+            //
+            if(strlen(pwdCStr) != 0)
+            {
+                if(chdir(pwdCStr) == -1)
+                {
+                    reportChildError(errno, errorFds[1], "cannot change working directory to",  pwdCStr,
+                                     _traceLevels);
+                }
+            }
 
-        //
-        // If an error occured before the exec() we do some cleanup and throw.
-        //
-        if(!message.empty())
+            //
+            // Close on exec the error message file descriptor.
+            //
+            int flags = fcntl(errorFds[1], F_GETFD);
+            flags |= 1; // FD_CLOEXEC
+            if(fcntl(errorFds[1], F_SETFD, flags) == -1)
+            {
+                close(errorFds[1]);
+                errorFds[1] = -1;
+            }
+
+            if(execvp(av.argv[0], av.argv) == -1)
+            {
+                if(errorFds[1] != -1)
+                {
+                    reportChildError(errno, errorFds[1], "cannot execute",  av.argv[0], _traceLevels);
+                }
+                else
+                {
+                    reportChildError(errno, fds[1], "cannot execute",  av.argv[0], _traceLevels);
+                }
+            }
+        }
+        else // Parent process.
         {
-            close(fds[0]);
+            close(fds[1]);
+            close(errorFds[1]);
+
+            //
+            // Read a potential error message over the error message pipe.
+            //
+            char s[16];
+            ssize_t rs;
+            string message;
+            while((rs = read(errorFds[0], &s, 16)) > 0)
+            {
+                message.append(s, rs);
+            }
+
+            //
+            // If an error occured before the exec() we do some cleanup and throw.
+            //
+            if(!message.empty())
+            {
+                close(fds[0]);
+                close(errorFds[0]);
+                waitPid(pid);
+                throw runtime_error(message);
+            }
+
+            //
+            // Otherwise, the exec() was successfull and we don't need the error message
+            // pipe anymore.
+            //
             close(errorFds[0]);
-            waitPid(pid);
-            throw runtime_error(message);
         }
+    }
 
-        //
-        // Otherwise, the exec() was successfull and we don't need the error message
-        // pipe anymore.
-        //
-        close(errorFds[0]);
-
-        Process process;
-        process.pid = pid;
-        process.pipeFd = fds[0];
-        process.server = server;
-        _processes.insert(make_pair(name, process));
+    Process process;
+    process.pid = pid;
+    process.pipeFd = fds[0];
+    process.server = server;
 
-        int flags = fcntl(process.pipeFd, F_GETFL);
-        flags |= O_NONBLOCK;
-        fcntl(process.pipeFd, F_SETFL, flags);
+    int flags = fcntl(process.pipeFd, F_GETFL);
+    flags |= O_NONBLOCK;
+    fcntl(process.pipeFd, F_SETFL, flags);
 
-        setInterrupt();
+    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+    _processes.insert(make_pair(name, process));
+    setInterrupt();
 
     //
     // Don't print the following trace, this might interfere with the
     // output of the started process if it fails with an error message.
     //
-//      if(_traceLevels->activator > 0)
-//      {
-//          Ice::Trace out(_traceLevels->logger, _traceLevels->activatorCat);
-//          out << "activated server `" << name << "' (pid = " << pid << ")";
-//      }
-    }
+//  if(_traceLevels->activator > 0)
+//  {
+//      Ice::Trace out(_traceLevels->logger, _traceLevels->activatorCat);
+//      out << "activated server `" << name << "' (pid = " << pid << ")";
+//  }
 
     return pid;
 #endif
 }
 
+void
+Activator::queueActivation(const ServerIPtr& server)
+{
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        if(!_activationPool.empty() && !_deactivating)
+        {
+            _activations.push_back(server);
+            notifyAll();
+            return;
+        }
+    }
+
+    //
+    // Without activation threads, the server is activated by the calling
+    // thread.
+    //
+    server->activate();
+}
+
 namespace
 {
 
@@ -1032,6 +1255,18 @@ Activator::start()
     //
     _thread = new TerminationListenerThread(*this);
     _thread->start();
+
+    //
+    // Create the activation threads, the servers are activated
+    // concurrently by these threads.
+    //
+    IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+    for(int i = 0; i < _activationThreads; ++i)
+    {
+        IceUtil::ThreadPtr thread = new ActivationThread(*this);
+        thread->start();
+        _activationPool.push_back(thread);
+    }
 }
 
 void
@@ -1067,10 +1302,28 @@ Activator::shutdown()
 void
 Activator::destroy()
 {
-    map<string, Process> processes;
+    //
+    // Join the activation threads, they terminate once the queued
+    // activations are completed.
+    //
+    vector<IceUtil::ThreadPtr> activationPool;
     {
         IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
         assert(_deactivating);
+        activationPool.swap(_activationPool);
+    }
+    for(vector<IceUtil::ThreadPtr>::const_iterator p = activationPool.begin(); p != activationPool.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+
+    map<string, Process> processes;
+    {
+        IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+        while(_activating > 0)
+        {
+            wait();
+        }
         processes = _processes;
     }
 
@@ -1148,6 +1401,43 @@ Activator::runTerminationListener()
     }
 }
 
+void
+Activator::runActivations()
+{
+    while(true)
+    {
+        ServerIPtr server;
+        {
+            IceUtil::Monitor< IceUtil::Mutex>::Lock sync(*this);
+            while(_activations.empty() && !_deactivating)
+            {
+                wait();
+            }
+            if(_activations.empty())
+            {
+                return;
+            }
+            server = _activations.front();
+            _activations.pop_front();
+        }
+
+        try
+        {
+            server->activate();
+        }
+        catch(const Exception& ex)
+        {
+            Error out(_traceLevels->logger);
+            out << "exception in server activation thread:\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(_traceLevels->logger);
+            out << "unknown exception in server activation thread";
+        }
+    }
+}
+
 void
 Activator::terminationListener()
 {
@@ -1184,7 +1474,7 @@ Activator::terminationListener()
                 }
             }
             _terminated.clear();
-            deactivated = _deactivating && _processes.empty();
+            deactivated = _deactivating && _processes.empty() && _activating == 0;
         }
 
         for(vector<Process>::const_iterator p = terminated.begin(); p != terminated.end(); ++p)
@@ -1275,7 +1565,7 @@ Activator::terminationListener()
             {
                 clearInterrupt();
 
-                if(_deactivating && _processes.empty())
+                if(_deactivating && _processes.empty() && _activating == 0)
                 {
                     return;
                 }
@@ -1336,7 +1626,7 @@ Activator::terminationListener()
             //
             // We are deactivating and there's no more active processes.
             //
-            deactivated = _deactivating && _processes.empty();
+            deactivated = _deactivating && _processes.empty() && _activating == 0;
         }
 
         for(vector<Process>::const_iterator p = terminated.begin(); p != terminated.end(); ++p)
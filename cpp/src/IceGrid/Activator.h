@@ -8,6 +8,8 @@
 #include <IceUtil/Thread.h>
 #include <IceGrid/Internal.h>
 
+#include <deque>
+
 #ifndef _WIN32
 #   include <sys/types.h> // for uid_t, gid_t
 #endif
@@ -42,7 +44,7 @@ public:
         ServerIPtr server;
     };
 
-    Activator(const TraceLevelsPtr&);
+    Activator(const TraceLevelsPtr&, int = 0);
     virtual ~Activator();
 
     virtual int activate(const std::string&, const std::string&, const std::string&,
@@ -50,6 +52,7 @@ public:
                          uid_t, gid_t,
 #endif
                          const Ice::StringSeq&, const Ice::StringSeq&, const ServerIPtr&);
+    virtual void queueActivation(const ServerIPtr&);
     virtual void deactivate(const std::string&, const Ice::ProcessPrx&);
     virtual void kill(const std::string&);
     virtual void sendSignal(const std::string&, const std::string&);
@@ -65,6 +68,7 @@ public:
 
     void sendSignal(const std::string&, int);
     void runTerminationListener();
+    void runActivations();
 
 #ifdef _WIN32
     void processTerminated(Process*);
@@ -72,6 +76,8 @@ public:
 
 private:
 
+    class ActivationGuard;
+
     void terminationListener();
     void clearInterrupt();
     void setInterrupt();
@@ -83,6 +89,11 @@ private:
     TraceLevelsPtr _traceLevels;
     std::map<std::string, Process> _processes;
     bool _deactivating;
+    int _activating;
+
+    const int _activationThreads;
+    std::deque<ServerIPtr> _activations;
+    std::vector<IceUtil::ThreadPtr> _activationPool;
 
 #ifdef _WIN32
     HANDLE _hIntr;
@@ -52,6 +52,16 @@ public:
     LoadSample _loadSample;
 };
 
+struct TransformToReplicaLatencyLoad :
+        public unary_function<const ServerAdapterEntryPtr&, pair<float, ServerAdapterEntryPtr> >
+{
+    pair<float, ServerAdapterEntryPtr>
+    operator()(const ServerAdapterEntryPtr& value)
+    {
+        return make_pair(value->getLatencyLoad(), value);
+    }
+};
+
 struct TransformToReplica : public unary_function<const pair<string, ServerAdapterEntryPtr>&, ServerAdapterEntryPtr>
 {
     ServerAdapterEntryPtr
@@ -170,7 +180,14 @@ typedef IceUtil::Handle<ReplicaGroupSyncCallback> ReplicaGroupSyncCallbackPtr;
 
 }
 
-AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) : _communicator(communicator)
+AdapterCache::AdapterCache(const Ice::CommunicatorPtr& communicator) :
+    _communicator(communicator),
+    //
+    // The nodes report the adapter loads with each keep alive, a load
+    // which isn't updated for two node session timeouts is ignored.
+    //
+    _loadTimeout(IceUtil::Time::seconds(2 * communicator->getProperties()->getPropertyAsIntWithDefault(
+                                                "IceGrid.Registry.NodeSessionTimeout", 30)))
 {
 }
 
@@ -295,6 +312,34 @@ AdapterCache::removeReplicaGroup(const string& id)
     removeImpl(id);
 }
 
+void
+AdapterCache::updateLoads(const AdapterLoadSeq& loads)
+{
+    for(AdapterLoadSeq::const_iterator p = loads.begin(); p != loads.end(); ++p)
+    {
+        ServerAdapterEntryPtr entry;
+        {
+            Lock sync(*this);
+            entry = ServerAdapterEntryPtr::dynamicCast(getImpl(p->id));
+        }
+        if(entry)
+        {
+            entry->updateLoad(p->latency, p->outstanding);
+        }
+    }
+}
+
+bool
+AdapterCache::hasLatencyLoadSample(const string& id) const
+{
+    ReplicaGroupEntryPtr entry;
+    {
+        Lock sync(*this);
+        entry = ReplicaGroupEntryPtr::dynamicCast(getImpl(id));
+    }
+    return entry && entry->hasLatencyLoadSample();
+}
+
 AdapterEntryPtr
 AdapterCache::addImpl(const string& id, const AdapterEntryPtr& entry)
 {
@@ -351,7 +396,9 @@ ServerAdapterEntry::ServerAdapterEntry(AdapterCache& cache,
     AdapterEntry(cache, id, application),
     _replicaGroupId(replicaGroupId),
     _priority(priority),
-    _server(server)
+    _server(server),
+    _latency(-1.0f),
+    _outstanding(0)
 {
 }
 
@@ -476,12 +523,59 @@ ServerAdapterEntry::getNodeName() const
     }
 }
 
+void
+ServerAdapterEntry::updateLoad(float latency, int outstanding)
+{
+    //
+    // The latency is smoothed with an exponentially weighted moving
+    // average. If no requests were dispatched since the last report,
+    // the average decays so that an idle replica gets requests again.
+    //
+    const float alpha = 0.5f;
+
+    IceUtil::Mutex::Lock sync(_loadMutex);
+    if(latency < 0)
+    {
+        if(_latency > 0)
+        {
+            _latency *= 1.0f - alpha;
+        }
+    }
+    else if(_latency < 0)
+    {
+        _latency = latency;
+    }
+    else
+    {
+        _latency = alpha * latency + (1.0f - alpha) * _latency;
+    }
+    _outstanding = outstanding;
+    _loadTime = IceUtil::Time::now(IceUtil::Time::Monotonic);
+}
+
+float
+ServerAdapterEntry::getLatencyLoad() const
+{
+    IceUtil::Mutex::Lock sync(_loadMutex);
+    if(_latency < 0 || IceUtil::Time::now(IceUtil::Time::Monotonic) - _loadTime > _cache.getLoadTimeout())
+    {
+        return -1.0f;
+    }
+
+    //
+    // The expected time to dispatch a new request, assuming the requests
+    // being dispatched are completed first.
+    //
+    return _latency * static_cast<float>(_outstanding + 1);
+}
+
 ReplicaGroupEntry::ReplicaGroupEntry(AdapterCache& cache,
                                      const string& id,
                                      const string& application,
                                      const LoadBalancingPolicyPtr& policy,
                                      const string& filter) :
     AdapterEntry(cache, id, application),
+    _latency(false),
     _lastReplica(0),
     _requestInProgress(false)
 {
@@ -580,10 +674,16 @@ ReplicaGroupEntry::update(const string& application, const LoadBalancingPolicyPt
     int nReplicas = 0;
     is >> nReplicas;
     _loadBalancingNReplicas = nReplicas < 0 ? 1 : nReplicas;
+    _latency = false;
     AdaptiveLoadBalancingPolicyPtr alb = AdaptiveLoadBalancingPolicyPtr::dynamicCast(_loadBalancing);
     if(alb)
     {
-        if(alb->loadSample == "1")
+        _loadSample = LoadSample1;
+        if(alb->loadSample == "latency")
+        {
+            _latency = true;
+        }
+        else if(alb->loadSample == "1")
         {
             _loadSample = LoadSample1;
         }
@@ -608,6 +708,7 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
 {
     vector<ServerAdapterEntryPtr> replicas;
     bool adaptive = false;
+    bool latency = false;
     LoadSample loadSample = LoadSample1;
     {
         Lock sync(*this);
@@ -642,6 +743,7 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
             replicas = _replicas;
             IceUtilInternal::shuffle(replicas.begin(), replicas.end());
             loadSample = _loadSample;
+            latency = _latency;
             adaptive = true;
         }
         else if(OrderedLoadBalancingPolicyPtr::dynamicCast(_loadBalancing))
@@ -660,7 +762,49 @@ ReplicaGroupEntry::getLocatorAdapterInfo(LocatorAdapterInfoSeq& adapters, int& n
     bool synchronizing = false;
     try
     {
-        if(adaptive)
+        if(latency)
+        {
+            //
+            // The replicas are shuffled and ordered with a single pass
+            // comparing each replica with the next one: the first replica
+            // is the least loaded of two random replicas (the power of
+            // two choices). Unlike sorting all the replicas, this doesn't
+            // send all the clients to the same replica until the next
+            // load reports. Replicas without a recent load report are
+            // assumed to have the average load of the others.
+            //
+            vector<pair<float, ServerAdapterEntryPtr> > rl;
+            transform(replicas.begin(), replicas.end(), back_inserter(rl), TransformToReplicaLatencyLoad());
+
+            float total = 0.0f;
+            int count = 0;
+            for(vector<pair<float, ServerAdapterEntryPtr> >::const_iterator p = rl.begin(); p != rl.end(); ++p)
+            {
+                if(p->first >= 0)
+                {
+                    total += p->first;
+                    ++count;
+                }
+            }
+            for(vector<pair<float, ServerAdapterEntryPtr> >::iterator p = rl.begin(); p != rl.end(); ++p)
+            {
+                if(p->first < 0)
+                {
+                    p->first = count > 0 ? total / static_cast<float>(count) : 0.0f;
+                }
+            }
+
+            for(size_t i = 1; i < rl.size(); ++i)
+            {
+                if(rl[i].first < rl[i - 1].first)
+                {
+                    swap(rl[i], rl[i - 1]);
+                }
+            }
+            replicas.clear();
+            transform(rl.begin(), rl.end(), back_inserter(replicas), TransformToReplica());
+        }
+        else if(adaptive)
         {
             //
             // This must be done outside the synchronization block since
@@ -804,3 +948,10 @@ ReplicaGroupEntry::hasAdaptersFromOtherApplications() const
     }
     return false;
 }
+
+bool
+ReplicaGroupEntry::hasLatencyLoadSample() const
+{
+    Lock sync(*this);
+    return _latency;
+}
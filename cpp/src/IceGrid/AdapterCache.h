@@ -87,11 +87,19 @@ public:
     std::string getServerId() const;
     std::string getNodeName() const;
 
+    void updateLoad(float, int);
+    float getLatencyLoad() const;
+
 private:
 
     const std::string _replicaGroupId;
     const int _priority;
     const ServerEntryPtr _server;
+
+    mutable IceUtil::Mutex _loadMutex;
+    float _latency;
+    int _outstanding;
+    IceUtil::Time _loadTime;
 };
 typedef IceUtil::Handle<ServerAdapterEntry> ServerAdapterEntryPtr;
 
@@ -117,12 +125,14 @@ public:
     bool hasAdaptersFromOtherApplications() const;
 
     const std::string& getFilter() const { return _filter; }
+    bool hasLatencyLoadSample() const;
 
 private:
 
     LoadBalancingPolicyPtr _loadBalancing;
     int _loadBalancingNReplicas;
     LoadSample _loadSample;
+    bool _latency;
     std::string _filter;
     std::vector<ServerAdapterEntryPtr> _replicas;
     int _lastReplica;
@@ -144,6 +154,10 @@ public:
     void removeServerAdapter(const std::string&);
     void removeReplicaGroup(const std::string&);
 
+    void updateLoads(const AdapterLoadSeq&);
+    bool hasLatencyLoadSample(const std::string&) const;
+    IceUtil::Time getLoadTimeout() const { return _loadTimeout; }
+
 protected:
 
     virtual AdapterEntryPtr addImpl(const std::string&, const AdapterEntryPtr&);
@@ -152,6 +166,7 @@ protected:
 private:
 
     const Ice::CommunicatorPtr _communicator;
+    const IceUtil::Time _loadTimeout;
 };
 
 };
@@ -98,9 +98,57 @@ FileIteratorI::read(int size, Ice::StringSeq& lines, const Ice::Current&)
     }
 }
 
+void
+FileIteratorI::follow(int size, const FileObserverPrx& observer, const Ice::Current& current)
+{
+    if(!observer)
+    {
+        throw FileNotAvailableException("no observer to send the lines of the file to");
+    }
+
+    //
+    // The node or registry which reads the file sends the lines to the
+    // observer through a forwarder hosted by this registry.
+    //
+    FileObserverPrx forwarder = _session->addFileObserver(current.id, observer, current);
+    try
+    {
+        _reader->follow(_filename, _offset, size > _messageSizeMax ? _messageSizeMax : size, forwarder);
+    }
+    catch(const FileNotAvailableException&)
+    {
+        _session->removeFileObserver(current.id);
+        throw;
+    }
+    catch(const Ice::OperationNotExistException&)
+    {
+        _session->removeFileObserver(current.id);
+        throw FileNotAvailableException("following files isn't supported by this node or registry");
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        _session->removeFileObserver(current.id);
+        ostringstream os;
+        os << ex;
+        throw FileNotAvailableException(os.str());
+    }
+}
+
 void
 FileIteratorI::destroy(const Ice::Current& current)
 {
+    FileObserverPrx forwarder = _session->removeFileObserver(current.id);
+    if(forwarder)
+    {
+        try
+        {
+            _reader->begin_unfollow(forwarder);
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Ignore, the node stops sending lines once the forwarder is removed.
+        }
+    }
     _session->removeFileIterator(current.id, current);
 }
 
@@ -446,6 +494,46 @@ AdminSessionI::removeFileIterator(const Ice::Identity& id, const Ice::Current&)
     _servantManager->remove(id);
 }
 
+FileObserverPrx
+AdminSessionI::addFileObserver(const Ice::Identity& id, const FileObserverPrx& observer, const Ice::Current& current)
+{
+    removeFileObserver(id);
+
+    Lock sync(*this);
+    if(_destroyed)
+    {
+        throw Ice::ObjectNotExistException(__FILE__, __LINE__, current.id, "", "");
+    }
+
+    const int t = _timeout * 1000;
+    FileObserverPrx forwarder =
+        FileObserverPrx::uncheckedCast(addForwarder(observer->ice_timeout(t)->ice_locator(_registry->getLocator())));
+    _fileObservers.insert(make_pair(id, forwarder));
+    return forwarder;
+}
+
+FileObserverPrx
+AdminSessionI::removeFileObserver(const Ice::Identity& id)
+{
+    Lock sync(*this);
+    map<Ice::Identity, FileObserverPrx>::iterator p = _fileObservers.find(id);
+    if(p == _fileObservers.end())
+    {
+        return 0;
+    }
+
+    FileObserverPrx forwarder = p->second;
+    _fileObservers.erase(p);
+    try
+    {
+        _registry->getRegistryAdapter()->remove(forwarder->ice_getIdentity());
+    }
+    catch(const Ice::ObjectAdapterDeactivatedException&)
+    {
+    }
+    return forwarder;
+}
+
 void
 AdminSessionI::destroyImpl(bool shutdown)
 {
@@ -472,6 +560,26 @@ AdminSessionI::destroyImpl(bool shutdown)
         setupObserverSubscription(AdapterObserverTopicName, 0);
         setupObserverSubscription(ObjectObserverTopicName, 0);
     }
+
+    //
+    // Remove the file observer forwarders, the nodes stop sending the
+    // lines of the followed files once their forwarder is gone.
+    //
+    map<Ice::Identity, FileObserverPrx> fileObservers;
+    {
+        Lock sync(*this);
+        fileObservers.swap(_fileObservers);
+    }
+    for(map<Ice::Identity, FileObserverPrx>::const_iterator p = fileObservers.begin(); p != fileObservers.end(); ++p)
+    {
+        try
+        {
+            _registry->getRegistryAdapter()->remove(p->second->ice_getIdentity());
+        }
+        catch(const Ice::ObjectAdapterDeactivatedException&)
+        {
+        }
+    }
 }
 
 AdminSessionFactory::AdminSessionFactory(const SessionServantManagerPtr& servantManager,
@@ -58,6 +58,9 @@ public:
 
     void removeFileIterator(const Ice::Identity&, const Ice::Current&);
 
+    FileObserverPrx addFileObserver(const Ice::Identity&, const FileObserverPrx&, const Ice::Current&);
+    FileObserverPrx removeFileObserver(const Ice::Identity&);
+
 private:
 
     void setupObserverSubscription(TopicName, const Ice::ObjectPrx&, bool = false);
@@ -71,6 +74,7 @@ private:
     const std::string _replicaName;
     AdminPrx _admin;
     std::map<TopicName, std::pair<Ice::ObjectPrx, bool> > _observers;
+    std::map<Ice::Identity, FileObserverPrx> _fileObservers;
     RegistryIPtr _registry;
     Ice::ObjectPrx _adminCallbackTemplate;
 };
@@ -131,6 +135,7 @@ public:
     FileIteratorI(const AdminSessionIPtr&, const FileReaderPrx&, const std::string&, Ice::Long, int);
 
     virtual bool read(int, Ice::StringSeq&, const Ice::Current&);
+    virtual void follow(int, const FileObserverPrx&, const Ice::Current&);
     virtual void destroy(const Ice::Current&);
 
 private:
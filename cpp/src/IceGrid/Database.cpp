@@ -43,6 +43,12 @@ const string internalObjectsDbName = "internal-objects";
 const string internalObjectsByTypeDbName = "internal-objectsByType";
 const string serialsDbName = "serials";
 
+//
+// The maximum number of entries of the objects caches.
+//
+const size_t objectsCacheSize = 10000;
+const size_t objectsByTypeCacheSize = 1000;
+
 struct ObjectLoadCI : binary_function<pair<Ice::ObjectPrx, float>&, pair<Ice::ObjectPrx, float>&, bool>
 {
     bool operator()(const pair<Ice::ObjectPrx, float>& lhs, const pair<Ice::ObjectPrx, float>& rhs)
@@ -150,8 +156,7 @@ findByReplicaGroupId(const IceDB::Txn& txn,
         adapters.get(txn, id, info);
         result.push_back(info);
 
-        string n;
-        while(cursor.get(n, id, MDB_NEXT) && n == name)
+        while(cursor.getData(id, MDB_NEXT_DUP))
         {
             adapters.get(txn, id, info);
             result.push_back(info);
@@ -175,8 +180,11 @@ findByType(const IceDB::ReadOnlyTxn& txn,
         objects.get(txn, id, info);
         result.push_back(info);
 
-        string t;
-        while(cursor.get(t, id, MDB_NEXT) && t == type)
+        //
+        // The identities of the type are duplicates of the type key,
+        // the key doesn't need to be unmarshaled and compared.
+        //
+        while(cursor.getData(id, MDB_NEXT_DUP))
         {
             objects.get(txn, id, info);
             result.push_back(info);
@@ -201,16 +209,21 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _master(info.name == "Master"),
     _readonly(readonly || !_master),
     _replicaCache(_communicator, topicManager),
-    _nodeCache(_communicator, _replicaCache, _readonly && _master ? string("Master (read-only)") : info.name),
+    _nodeCache(_communicator, _replicaCache, _adapterCache,
+               _readonly && _master ? string("Master (read-only)") : info.name),
     _adapterCache(_communicator),
     _objectCache(_communicator),
     _allocatableObjectCache(_communicator),
     _serverCache(_communicator, _instanceName, _nodeCache, _adapterCache, _objectCache, _allocatableObjectCache),
     _dbLock(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path") + "/icedb.lock"),
     _env(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.Path"), 8,
-         IceDB::getMapSize(_communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.LMDB.MapSize"))),
+         IceDB::getMapSize(_communicator->getProperties()->getPropertyAsInt("IceGrid.Registry.LMDB.MapSize")), 0,
+         IceDB::getSyncFlags(_communicator->getProperties()->getProperty("IceGrid.Registry.LMDB.SyncMode"))),
     _pluginFacade(RegistryPluginFacadeIPtr::dynamicCast(getRegistryPluginFacade())),
-    _lock(0)
+    _lock(0),
+    _objectsCacheGeneration(0),
+    _objectsCache(objectsCacheSize),
+    _objectsByTypeCache(objectsByTypeCacheSize)
 {
     IceDB::ReadWriteTxn txn(_env);
 
@@ -257,7 +270,10 @@ Database::Database(const Ice::ObjectAdapterPtr& registryAdapter,
     _objectCache.setTraceLevels(_traceLevels);
     _allocatableObjectCache.setTraceLevels(_traceLevels);
 
-    _nodeObserverTopic = new NodeObserverTopic(_topicManager, _internalAdapter);
+    _locatorCacheNotifier = new LocatorCacheNotifierI(_communicator, _adapterCache, _traceLevels);
+    _objectCache.setLocatorCacheNotifier(_locatorCacheNotifier);
+
+    _nodeObserverTopic = new NodeObserverTopic(_topicManager, _internalAdapter, _locatorCacheNotifier, _traceLevels);
     _registryObserverTopic = new RegistryObserverTopic(_topicManager);
 
     _serverCache.setNodeObserverTopic(_nodeObserverTopic);
@@ -307,6 +323,8 @@ Database::destroy()
     _applicationObserverTopic->destroy();
     _adapterObserverTopic->destroy();
     _objectObserverTopic->destroy();
+
+    _locatorCacheNotifier->destroy();
 }
 
 ObserverTopicPtr
@@ -508,6 +526,7 @@ Database::syncObjects(const ObjectInfoSeq& objects, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            invalidateObjectsCache();
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -970,6 +989,12 @@ Database::getServer(const string& id) const
     return _serverCache.get(id);
 }
 
+AdapterCache&
+Database::getAdapterCache()
+{
+    return _adapterCache;
+}
+
 AllocatableObjectCache&
 Database::getAllocatableObjectCache()
 {
@@ -1009,12 +1034,14 @@ Database::setAdapterDirectProxy(const string& adapterId, const string& replicaGr
         info.replicaGroupId = replicaGroupId;
 
         bool updated = false;
+        string oldReplicaGroupId;
         try
         {
             IceDB::ReadWriteTxn txn(_env);
 
             AdapterInfo oldInfo;
             bool found = _adapters.get(txn, adapterId, oldInfo);
+            oldReplicaGroupId = oldInfo.replicaGroupId;
             if(proxy)
             {
                 updated = found;
@@ -1073,6 +1100,16 @@ Database::setAdapterDirectProxy(const string& adapterId, const string& replicaGr
         {
             serial = _adapterObserverTopic->adapterRemoved(dbSerial, adapterId);
         }
+
+        _locatorCacheNotifier->adapterUpdated(adapterId, proxy);
+        if(!replicaGroupId.empty())
+        {
+            _locatorCacheNotifier->adapterUpdated(replicaGroupId, 0);
+        }
+        if(!oldReplicaGroupId.empty() && oldReplicaGroupId != replicaGroupId)
+        {
+            _locatorCacheNotifier->adapterUpdated(oldReplicaGroupId, 0);
+        }
     }
     _adapterObserverTopic->waitForSyncedSubscribers(serial);
 }
@@ -1130,6 +1167,7 @@ Database::removeAdapter(const string& adapterId)
 
         AdapterInfoSeq infos;
         Ice::Long dbSerial = 0;
+        string replicaGroupId;
         try
         {
             IceDB::ReadWriteTxn txn(_env);
@@ -1138,6 +1176,7 @@ Database::removeAdapter(const string& adapterId)
             if(_adapters.get(txn, adapterId, info))
             {
                 deleteAdapter(txn, info);
+                replicaGroupId = info.replicaGroupId;
             }
             else
             {
@@ -1184,6 +1223,12 @@ Database::removeAdapter(const string& adapterId)
                 serial = _adapterObserverTopic->adapterUpdated(dbSerial, *p);
             }
         }
+
+        _locatorCacheNotifier->adapterUpdated(adapterId, 0);
+        if(!replicaGroupId.empty())
+        {
+            _locatorCacheNotifier->adapterUpdated(replicaGroupId, 0);
+        }
     }
     _adapterObserverTopic->waitForSyncedSubscribers(serial);
 }
@@ -1472,6 +1517,7 @@ Database::addObject(const ObjectInfo& info)
             dbSerial = updateSerial(txn, objectsDbName);
 
             txn.commit();
+            invalidateObjectsCache();
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1521,6 +1567,7 @@ Database::addOrUpdateObject(const ObjectInfo& info, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            invalidateObjectsCache();
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1531,6 +1578,7 @@ Database::addOrUpdateObject(const ObjectInfo& info, Ice::Long dbSerial)
         if(update)
         {
             serial = _objectObserverTopic->objectUpdated(dbSerial, info);
+            _locatorCacheNotifier->objectUpdated(id);
         }
         else
         {
@@ -1574,6 +1622,7 @@ Database::removeObject(const Ice::Identity& id, Ice::Long dbSerial)
             dbSerial = updateSerial(txn, objectsDbName, dbSerial);
 
             txn.commit();
+            invalidateObjectsCache();
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1582,6 +1631,7 @@ Database::removeObject(const Ice::Identity& id, Ice::Long dbSerial)
         }
 
         serial = _objectObserverTopic->objectRemoved(dbSerial, id);
+        _locatorCacheNotifier->objectUpdated(id);
 
         if(_traceLevels->object > 0)
         {
@@ -1624,6 +1674,7 @@ Database::updateObject(const Ice::ObjectPrx& proxy)
             dbSerial = updateSerial(txn, objectsDbName);
 
             txn.commit();
+            invalidateObjectsCache();
         }
         catch(const IceDB::LMDBException& ex)
         {
@@ -1632,6 +1683,7 @@ Database::updateObject(const Ice::ObjectPrx& proxy)
         }
 
         serial = _objectObserverTopic->objectUpdated(dbSerial, info);
+        _locatorCacheNotifier->objectUpdated(id);
         if(_traceLevels->object > 0)
         {
             Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
@@ -1659,6 +1711,7 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             addObject(txn, *p, false);
         }
         txn.commit();
+        invalidateObjectsCache();
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1666,6 +1719,10 @@ Database::addOrUpdateRegistryWellKnownObjects(const ObjectInfoSeq& objects)
         throw;
     }
 
+    for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
+    {
+        _locatorCacheNotifier->objectUpdated(p->proxy->ice_getIdentity());
+    }
     return _objectObserverTopic->wellKnownObjectsAddedOrUpdated(objects);
 }
 
@@ -1686,6 +1743,7 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
             }
         }
         txn.commit();
+        invalidateObjectsCache();
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1693,6 +1751,10 @@ Database::removeRegistryWellKnownObjects(const ObjectInfoSeq& objects)
         throw;
     }
 
+    for(ObjectInfoSeq::const_iterator p = objects.begin(); p != objects.end(); ++p)
+    {
+        _locatorCacheNotifier->objectUpdated(p->proxy->ice_getIdentity());
+    }
     return _objectObserverTopic->wellKnownObjectsRemoved(objects);
 }
 
@@ -1710,9 +1772,8 @@ Database::getObjectProxy(const Ice::Identity& id)
     {
     }
 
-    IceDB::ReadOnlyTxn txn(_env);
     ObjectInfo info;
-    if(!_objects.get(txn, id, info))
+    if(!getDatabaseObjectInfo(id, info))
     {
         throw ObjectNotRegisteredException(id);
     }
@@ -1775,8 +1836,7 @@ Database::getObjectsByType(const string& type, const Ice::ConnectionPtr& con, co
         }
     }
 
-    IceDB::ReadOnlyTxn txn(_env);
-    vector<ObjectInfo> infos = findByType(txn, _objects, _objectsByType, type);
+    vector<ObjectInfo> infos = getDatabaseObjectInfosByType(type);
     for(unsigned int i = 0; i < infos.size(); ++i)
     {
         proxies.push_back(infos[i].proxy);
@@ -1808,9 +1868,8 @@ Database::getObjectInfo(const Ice::Identity& id)
     {
     }
 
-    IceDB::ReadOnlyTxn txn(_env);
     ObjectInfo info;
-    if(!_objects.get(txn, id, info))
+    if(!getDatabaseObjectInfo(id, info))
     {
         throw ObjectNotRegisteredException(id);
     }
@@ -1842,8 +1901,7 @@ Database::getObjectInfosByType(const string& type)
 {
     ObjectInfoSeq infos = _objectCache.getAllByType(type);
 
-    IceDB::ReadOnlyTxn txn(_env);
-    ObjectInfoSeq dbInfos = findByType(txn, _objects, _objectsByType, type);
+    ObjectInfoSeq dbInfos = getDatabaseObjectInfosByType(type);
     for(unsigned int i = 0; i < dbInfos.size(); ++i)
     {
         infos.push_back(dbInfos[i]);
@@ -2678,6 +2736,76 @@ Database::finishUpdating(const string& name)
     notifyAll();
 }
 
+bool
+Database::getDatabaseObjectInfo(const Ice::Identity& id, ObjectInfo& info)
+{
+    Ice::Long generation;
+    {
+        IceUtil::Mutex::Lock sync(_objectsCacheMutex);
+        if(_objectsCache.get(id, info))
+        {
+            return true;
+        }
+        generation = _objectsCacheGeneration;
+    }
+
+    IceDB::ReadOnlyTxn txn(_env);
+    if(!_objects.get(txn, id, info))
+    {
+        return false;
+    }
+
+    //
+    // Don't cache the object if the database was updated since the
+    // lookup started, the transaction might have read stale data.
+    //
+    IceUtil::Mutex::Lock sync(_objectsCacheMutex);
+    if(generation == _objectsCacheGeneration)
+    {
+        _objectsCache.put(id, info);
+    }
+    return true;
+}
+
+vector<ObjectInfo>
+Database::getDatabaseObjectInfosByType(const string& type)
+{
+    Ice::Long generation;
+    {
+        IceUtil::Mutex::Lock sync(_objectsCacheMutex);
+        vector<ObjectInfo> infos;
+        if(_objectsByTypeCache.get(type, infos))
+        {
+            return infos;
+        }
+        generation = _objectsCacheGeneration;
+    }
+
+    IceDB::ReadOnlyTxn txn(_env);
+    vector<ObjectInfo> infos = findByType(txn, _objects, _objectsByType, type);
+
+    if(infos.empty())
+    {
+        return infos;
+    }
+
+    IceUtil::Mutex::Lock sync(_objectsCacheMutex);
+    if(generation == _objectsCacheGeneration)
+    {
+        _objectsByTypeCache.put(type, infos);
+    }
+    return infos;
+}
+
+void
+Database::invalidateObjectsCache()
+{
+    IceUtil::Mutex::Lock sync(_objectsCacheMutex);
+    ++_objectsCacheGeneration;
+    _objectsCache.clear();
+    _objectsByTypeCache.clear();
+}
+
 Ice::Long
 Database::getSerial(const IceDB::Txn& txn, const string& dbName)
 {
@@ -19,9 +19,12 @@
 #include <IceGrid/AdapterCache.h>
 #include <IceGrid/Topics.h>
 #include <IceGrid/PluginFacadeI.h>
+#include <IceGrid/LocatorCacheNotifierI.h>
 
 #include <IceDB/IceDB.h>
 
+#include <list>
+
 namespace IceGrid
 {
 
@@ -52,6 +55,67 @@ typedef IceDB::Dbi<std::string, std::string, IceDB::IceContext, Ice::OutputStrea
 
 typedef IceDB::Dbi<std::string, Ice::Long, IceDB::IceContext, Ice::OutputStream> StringLongMap;
 
+//
+// A cache of the most recently used values, the least recently used
+// value is evicted once the cache is full. The cache isn't
+// synchronized.
+//
+template<typename K, typename V> class LRUCache
+{
+public:
+
+    LRUCache(size_t size) : _size(size)
+    {
+    }
+
+    bool
+    get(const K& key, V& value)
+    {
+        typename std::map<K, typename EntryList::iterator>::iterator p = _index.find(key);
+        if(p == _index.end())
+        {
+            return false;
+        }
+        _entries.splice(_entries.begin(), _entries, p->second);
+        value = p->second->second;
+        return true;
+    }
+
+    void
+    put(const K& key, const V& value)
+    {
+        typename std::map<K, typename EntryList::iterator>::iterator p = _index.find(key);
+        if(p != _index.end())
+        {
+            _entries.erase(p->second);
+            _index.erase(p);
+        }
+
+        _entries.push_front(std::make_pair(key, value));
+        _index.insert(std::make_pair(key, _entries.begin()));
+        while(_entries.size() > _size)
+        {
+            _index.erase(_entries.back().first);
+            _entries.pop_back();
+        }
+    }
+
+    void
+    clear()
+    {
+        _entries.clear();
+        _index.clear();
+    }
+
+private:
+
+    typedef std::list<std::pair<K, V> > EntryList;
+
+    const size_t _size;
+    EntryList _entries;
+    std::map<K, typename EntryList::iterator> _index;
+};
+
 class Database : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
@@ -105,6 +169,9 @@ public:
     ServerCache& getServerCache();
     ServerEntryPtr getServer(const std::string&) const;
 
+    AdapterCache& getAdapterCache();
+    const LocatorCacheNotifierIPtr& getLocatorCacheNotifier() const { return _locatorCacheNotifier; }
+
     AllocatableObjectCache& getAllocatableObjectCache();
     AllocatableObjectEntryPtr getAllocatableObject(const Ice::Identity&) const;
 
@@ -193,6 +260,10 @@ private:
     void addObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
     void deleteObject(const IceDB::ReadWriteTxn&, const ObjectInfo&, bool);
 
+    bool getDatabaseObjectInfo(const Ice::Identity&, ObjectInfo&);
+    std::vector<ObjectInfo> getDatabaseObjectInfosByType(const std::string&);
+    void invalidateObjectsCache();
+
     friend struct AddComponent;
 
     static const std::string _applicationDbName;
@@ -222,6 +293,8 @@ private:
     AdapterObserverTopicPtr _adapterObserverTopic;
     ObjectObserverTopicPtr _objectObserverTopic;
 
+    LocatorCacheNotifierIPtr _locatorCacheNotifier;
+
     IceUtilInternal::FileLock _dbLock;
     IceDB::Env _env;
 
@@ -243,6 +316,16 @@ private:
     AdminSessionI* _lock;
     std::string _lockUserId;
 
+    //
+    // Read-through cache of the most recently looked up objects from
+    // the objects database, cleared each time this database is
+    // updated. Lookups which don't find any object aren't cached.
+    //
+    IceUtil::Mutex _objectsCacheMutex;
+    Ice::Long _objectsCacheGeneration;
+    LRUCache<Ice::Identity, ObjectInfo> _objectsCache;
+    LRUCache<std::string, std::vector<ObjectInfo> > _objectsByTypeCache;
+
     struct UpdateInfo
     {
         std::string name;
@@ -6,119 +6,262 @@
 #include <Ice/Properties.h>
 
 #include <IceUtil/FileUtil.h>
+#include <IceUtil/StringUtil.h>
 
 #include <IceGrid/FileCache.h>
 #include <IceGrid/Exception.h>
 
-#include <deque>
-#include <fstream>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <unistd.h>
+#   include <fcntl.h>
+#   include <poll.h>
+#endif
+
+#if defined(__linux__)
+#   include <sys/inotify.h>
+#endif
 
 using namespace std;
 using namespace IceGrid;
 
-FileCache::FileCache(const Ice::CommunicatorPtr& com) :
-    _messageSizeMax(com->getProperties()->getPropertyAsIntWithDefault("Ice.MessageSizeMax", 1024) * 1024 - 256)
+namespace
+{
+
+//
+// The maximum number of files kept open by the cache.
+//
+const size_t maxOpenFiles = 32;
+
+//
+// The size of the blocks read from the files.
+//
+const size_t blockSize = 16 * 1024;
+
+void
+throwReadError(const string& file)
 {
+    throw FileNotAvailableException("unrecoverable error occured while reading file `" + file + "'");
 }
 
-Ice::Long
-FileCache::getOffsetFromEnd(const string& file, int originalCount)
+#if defined(__linux__)
+const uint32_t fileEvents = IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF;
+const uint32_t directoryEvents = IN_CREATE | IN_MOVED_TO;
+
+pair<string, string>
+splitPath(const string& path)
 {
-    ifstream is(IceUtilInternal::streamFilename(file).c_str()); // file is a UTF-8 string
-    if(is.fail())
+    string::size_type pos = path.rfind('/');
+    if(pos == string::npos)
     {
-        throw FileNotAvailableException("failed to open file `" + file + "'");
+        return make_pair(string("."), path);
     }
+    return make_pair(pos == 0 ? string("/") : path.substr(0, pos), path.substr(pos + 1));
+}
+#endif
 
-    if(originalCount < 0)
+class FollowThread : public IceUtil::Thread
+{
+public:
+
+    FollowThread(const FileCachePtr& cache) : IceUtil::Thread("IceGrid file follow thread"), _cache(cache)
     {
-        return 0;
     }
 
-    is.seekg(0, ios::end);
-    streampos endOfFile = is.tellg();
-    if(originalCount == 0)
+    virtual void
+    run()
     {
-        return endOfFile;
+        _cache->runFollow();
     }
 
-    streamoff blockSize = 16 * 1024; // Start reading a block of 16K from the end of the file.
-    streampos lastBlockOffset = endOfFile;
-    int totalCount = 0;
-    string line;
-    deque<pair<streampos, string> > lines;
-    do
-    {
-        lines.clear();
+private:
 
-        //
-        // Move the current position of the stream to the new block to
-        // read.
-        //
-        is.clear();
-        if(lastBlockOffset - blockSize > streamoff(0))
+    const FileCachePtr _cache;
+};
+
+}
+
+namespace IceGrid
+{
+
+//
+// A file kept open by the cache. The reads of the file are serialized
+// with the file mutex and use the file buffer.
+//
+class CachedFile : public IceUtil::Shared, public IceUtil::Mutex
+{
+public:
+
+    CachedFile(const string& p, int f) : path(p), fd(f), lastUse(0)
+    {
+#ifndef _WIN32
+        struct stat buf;
+        if(::fstat(fd, &buf) == 0)
         {
-            is.seekg(lastBlockOffset - blockSize);
-            getline(is, line); // Ignore the first line as it's most likely not complete.
+            device = buf.st_dev;
+            inode = buf.st_ino;
         }
         else
         {
-            is.seekg(0, ios::beg); // We've reach the begining of the file.
+            device = 0;
+            inode = 0;
         }
+#endif
+    }
 
-        //
-        // Read the block and count the number of lines in the block
-        // If we found the "first last N lines", we start throwing out
-        // the lines read at the begining of the file.
-        //
-        int count = originalCount - totalCount; // Number of lines left to find.
-        while(is.good() && is.tellg() <= streamoff(lastBlockOffset))
-        {
-            streampos beg = is.tellg();
-            getline(is, line);
-            if(is.eof() && line.empty()) // Don't count the last line if it's empty.
-            {
-                continue;
-            }
+    ~CachedFile()
+    {
+        IceUtilInternal::close(fd);
+    }
 
-            lines.push_back(make_pair(beg, line));
-            ++totalCount;
-            if(lines.size() == static_cast<unsigned int>(count + 1))
-            {
-                --totalCount;
-                lines.pop_front();
-            }
+    Ice::Long
+    size() const
+    {
+#ifdef _WIN32
+        Ice::Long sz = _lseeki64(fd, 0, SEEK_END);
+        if(sz < 0)
+        {
+            throwReadError(path);
+        }
+        return sz;
+#else
+        struct stat buf;
+        if(::fstat(fd, &buf) != 0)
+        {
+            throwReadError(path);
         }
+        return static_cast<Ice::Long>(buf.st_size);
+#endif
+    }
 
-        if(lastBlockOffset - blockSize < streamoff(0))
+    size_t
+    readAt(char* data, size_t sz, Ice::Long offset) const
+    {
+#ifdef _WIN32
+        if(_lseeki64(fd, offset, SEEK_SET) < 0)
         {
-            break; // We're done if the block started at the begining of the file.
+            throwReadError(path);
         }
-        else if(totalCount < originalCount)
+        int n = ::_read(fd, data, static_cast<unsigned int>(sz));
+#else
+        ssize_t n;
+        do
         {
-            //
-            // Otherwise, it we still didn't find the required number of lines,
-            // read another block of text before this block.
-            //
-            lastBlockOffset -= blockSize; // Position of the block we just read.
-            blockSize *= 2; // Read a bigger block.
+            n = ::pread(fd, data, sz, static_cast<off_t>(offset));
         }
+        while(n < 0 && errno == EINTR);
+#endif
+        if(n < 0)
+        {
+            throwReadError(path);
+        }
+        return static_cast<size_t>(n);
     }
-    while(totalCount < originalCount && !is.bad());
 
-    if(is.bad())
+    const string path;
+    const int fd;
+#ifndef _WIN32
+    dev_t device;
+    ino_t inode;
+#endif
+    Ice::Long lastUse; // Protected by the file cache mutex.
+    vector<char> buffer; // Protected by the file mutex.
+};
+
+//
+// A file followed by an observer. The members are protected by the
+// file cache mutex.
+//
+class FileFollower : public Ice::LocalObject
+{
+public:
+
+    FileFollower(const string& p, Ice::Long ps, int sz, const FileObserverPrx& obsv) :
+        path(p), pos(ps), size(sz), observer(obsv), sending(false), changed(true), rotated(false)
     {
-        throw FileNotAvailableException("unrecoverable error occured while reading file `" + file + "'");
     }
 
-    if(lines.empty())
+    const string path;
+    Ice::Long pos;
+    const int size;
+    const FileObserverPrx observer;
+    bool sending;
+    bool changed;
+    bool rotated;
+};
+
+}
+
+FileCache::FileCache(const Ice::CommunicatorPtr& com) :
+    _messageSizeMax(com->getProperties()->getPropertyAsIntWithDefault("Ice.MessageSizeMax", 1024) * 1024 - 256),
+    _useCount(0),
+    _destroyed(false)
+#if defined(__linux__)
+    , _inotifyFd(-1)
+#else
+    , _notified(false)
+#endif
+{
+#if defined(__linux__)
+    _wakeupFd[0] = -1;
+    _wakeupFd[1] = -1;
+#endif
+}
+
+FileCache::~FileCache()
+{
+    // Out of line to avoid weak vtable
+}
+
+Ice::Long
+FileCache::getOffsetFromEnd(const string& file, int originalCount)
+{
+    CachedFilePtr f = getFile(file);
+
+    if(originalCount < 0)
     {
         return 0;
     }
-    else
+
+    IceUtil::Mutex::Lock sync(*f);
+    Ice::Long endOfFile = f->size();
+    if(originalCount == 0)
+    {
+        return endOfFile;
+    }
+
+    //
+    // Count the newlines backward from the end of the file. The last
+    // character of the file is skipped: either it terminates the last
+    // line or it belongs to the last line.
+    //
+    vector<char>& buffer = f->buffer;
+    buffer.resize(blockSize);
+    Ice::Long pos = endOfFile - 1;
+    int count = 0;
+    while(pos > 0)
     {
-        return lines[0].first;
+        size_t n = static_cast<size_t>(min(pos, static_cast<Ice::Long>(blockSize)));
+        Ice::Long start = pos - static_cast<Ice::Long>(n);
+        if(f->readAt(&buffer[0], n, start) != n)
+        {
+            throwReadError(file); // The file was truncated.
+        }
+
+        for(size_t i = n; i > 0; --i)
+        {
+            if(buffer[i - 1] == '\n' && ++count == originalCount)
+            {
+                return start + static_cast<Ice::Long>(i);
+            }
+        }
+        pos = start;
     }
+    return 0;
 }
 
 bool
@@ -136,22 +279,19 @@ FileCache::read(const string& file, Ice::Long offset, int size, Ice::Long& newOf
         throw FileNotAvailableException("maximum bytes per read request is too low");
     }
 
-    ifstream is(IceUtilInternal::streamFilename(file).c_str()); // file is a UTF-8 string
-    if(is.fail())
-    {
-        throw FileNotAvailableException("failed to open file `" + file + "'");
-    }
+    CachedFilePtr f = getFile(file);
+    IceUtil::Mutex::Lock sync(*f);
 
     //
     // Check if the requested offset is past the end of the file, if
     // that's the case return an empty sequence of lines and indicate
     // the EOF.
     //
-    is.seekg(0, ios::end);
-    if(offset >= is.tellg())
+    lines = Ice::StringSeq();
+    Ice::Long endOfFile = f->size();
+    if(offset >= endOfFile)
     {
-        newOffset = is.tellg();
-        lines = Ice::StringSeq();
+        newOffset = endOfFile;
         return true;
     }
 
@@ -159,24 +299,64 @@ FileCache::read(const string& file, Ice::Long offset, int size, Ice::Long& newOf
     // Read lines from the file until we read enough or reached EOF.
     //
     newOffset = offset;
-    lines = Ice::StringSeq();
-    is.seekg(static_cast<streamoff>(offset), ios::beg);
+    vector<char>& buffer = f->buffer;
+    buffer.resize(blockSize);
+    Ice::Long bufferOffset = offset; // The file offset of the buffer.
+    size_t bufferSize = 0;
+    size_t bufferPos = 0;
     int totalSize = 0;
     string line;
-
-    for(int i = 0; is.good(); ++i)
+    while(true)
     {
-        getline(is, line);
+        //
+        // Read the next line, 5 bytes are reserved for the encoding of
+        // the string size (worst case). We don't need to read more than
+        // the room left plus one character to find out if the line fits.
+        //
+        int room = size - totalSize - 5;
+        size_t limit = room < 0 ? 0 : static_cast<size_t>(room) + 1;
+        bool eol = false;
+        line.clear();
+        while(line.size() < limit)
+        {
+            if(bufferPos == bufferSize)
+            {
+                bufferOffset += static_cast<Ice::Long>(bufferSize);
+                if(bufferOffset >= endOfFile)
+                {
+                    break;
+                }
+                size_t n = static_cast<size_t>(min(endOfFile - bufferOffset, static_cast<Ice::Long>(blockSize)));
+                bufferSize = f->readAt(&buffer[0], n, bufferOffset);
+                bufferPos = 0;
+                if(bufferSize == 0)
+                {
+                    break; // The file was truncated.
+                }
+            }
+
+            const char* start = &buffer[bufferPos];
+            size_t n = min(bufferSize - bufferPos, limit - line.size());
+            const char* nl = static_cast<const char*>(memchr(start, '\n', n));
+            if(nl)
+            {
+                line.append(start, static_cast<size_t>(nl - start));
+                bufferPos += static_cast<size_t>(nl - start) + 1;
+                eol = true;
+                break;
+            }
+            line.append(start, n);
+            bufferPos += n;
+        }
 
-        int lineSize = static_cast<int>(line.size()) + 5; // 5 bytes for the encoding of the string size (worst case)
-        if(lineSize + totalSize > size)
+        if(static_cast<int>(line.size()) > room)
         {
-            if(totalSize + 5 < size)
+            if(room > 0)
             {
                 // There's some room left for a part of the string, return a partial string
-                line = line.substr(0, size - totalSize - 5);
+                line.resize(static_cast<size_t>(room));
                 lines.push_back(line);
-                newOffset += line.size();
+                newOffset += static_cast<Ice::Long>(line.size());
             }
             else
             {
@@ -185,28 +365,529 @@ FileCache::read(const string& file, Ice::Long offset, int size, Ice::Long& newOf
             return false; // We didn't reach the end of file, we've just reached the size limit!
         }
 
-        totalSize += lineSize;
+        totalSize += static_cast<int>(line.size()) + 5;
         lines.push_back(line);
 
         //
-        // If there was a partial read update the offset using the current line size,
-        // otherwise we have read a new complete line and we can use tellg to update
-        // the offset.
+        // If the line isn't terminated by a newline, we've reached the
+        // end of the file. Otherwise, the new offset is the offset of
+        // the next line.
         //
-        if(!is.good())
+        if(!eol)
         {
-            newOffset += line.size();
+            newOffset += static_cast<Ice::Long>(line.size());
+            return true;
         }
-        else
+        newOffset = bufferOffset + static_cast<Ice::Long>(bufferPos);
+    }
+}
+
+void
+FileCache::follow(const string& file, Ice::Long pos, int size, const FileObserverPrx& observer)
+{
+    if(size > _messageSizeMax)
+    {
+        size = _messageSizeMax;
+    }
+
+    if(size <= 5)
+    {
+        throw FileNotAvailableException("maximum bytes per read request is too low");
+    }
+
+    getFile(file); // Raises FileNotAvailableException if the file can't be opened.
+
+    Lock sync(*this);
+    if(_destroyed)
+    {
+        throw FileNotAvailableException("the file `" + file + "' can't be followed, the service is shutting down");
+    }
+
+    map<Ice::Identity, FileFollowerPtr>::iterator p = _followers.find(observer->ice_getIdentity());
+    if(p != _followers.end())
+    {
+        string path = p->second->path;
+        _followers.erase(p);
+        unwatch(path);
+    }
+
+#if defined(__linux__)
+    if(_inotifyFd < 0)
+    {
+        _inotifyFd = inotify_init();
+        if(_inotifyFd < 0)
+        {
+            throw FileNotAvailableException("failed to watch file `" + file + "':\n" +
+                                            IceUtilInternal::lastErrorToString());
+        }
+        fcntl(_inotifyFd, F_SETFD, FD_CLOEXEC);
+        fcntl(_inotifyFd, F_SETFL, O_NONBLOCK);
+        if(::pipe(_wakeupFd) != 0)
+        {
+            IceUtilInternal::close(_inotifyFd);
+            _inotifyFd = -1;
+            throw FileNotAvailableException("failed to watch file `" + file + "':\n" +
+                                            IceUtilInternal::lastErrorToString());
+        }
+        for(int i = 0; i < 2; ++i)
         {
-            newOffset = is.tellg();
+            fcntl(_wakeupFd[i], F_SETFD, FD_CLOEXEC);
+            fcntl(_wakeupFd[i], F_SETFL, O_NONBLOCK);
         }
     }
 
-    if(is.bad())
+    int wd = inotify_add_watch(_inotifyFd, file.c_str(), fileEvents);
+    if(wd < 0)
     {
-        throw FileNotAvailableException("unrecoverable error occured while reading file `" + file + "'");
+        throw FileNotAvailableException("failed to watch file `" + file + "':\n" +
+                                        IceUtilInternal::lastErrorToString());
     }
+    _watches[wd] = file;
 
-    return is.eof();
+    //
+    // The directory of the file is also watched to find out when the
+    // file is replaced (log rotation).
+    //
+    string directory = splitPath(file).first;
+    wd = inotify_add_watch(_inotifyFd, directory.c_str(), directoryEvents);
+    if(wd >= 0)
+    {
+        _directoryWatches[wd] = directory;
+    }
+#endif
+
+    _followers[observer->ice_getIdentity()] = new FileFollower(file, pos, size, observer);
+    if(!_thread)
+    {
+        _thread = new FollowThread(this);
+        _thread->start();
+    }
+    wakeup();
+}
+
+void
+FileCache::unfollow(const FileObserverPrx& observer)
+{
+    Lock sync(*this);
+    map<Ice::Identity, FileFollowerPtr>::iterator p = _followers.find(observer->ice_getIdentity());
+    if(p != _followers.end())
+    {
+        string path = p->second->path;
+        _followers.erase(p);
+        unwatch(path);
+    }
+}
+
+void
+FileCache::destroy()
+{
+    IceUtil::ThreadPtr thread;
+    {
+        Lock sync(*this);
+        _destroyed = true;
+        _followers.clear();
+        thread = _thread;
+        _thread = 0;
+        wakeup();
+    }
+
+    if(thread)
+    {
+        thread->getThreadControl().join();
+    }
+
+    Lock sync(*this);
+    _files.clear();
+#if defined(__linux__)
+    if(_inotifyFd >= 0)
+    {
+        IceUtilInternal::close(_inotifyFd);
+        IceUtilInternal::close(_wakeupFd[0]);
+        IceUtilInternal::close(_wakeupFd[1]);
+        _inotifyFd = -1;
+        _watches.clear();
+        _directoryWatches.clear();
+    }
+#endif
+}
+
+void
+FileCache::runFollow()
+{
+    while(true)
+    {
+#if defined(__linux__)
+        struct pollfd fds[2];
+        fds[0].fd = _inotifyFd;
+        fds[0].events = POLLIN;
+        fds[1].fd = _wakeupFd[0];
+        fds[1].events = POLLIN;
+        if(::poll(fds, 2, -1) < 0 && errno != EINTR)
+        {
+            return;
+        }
+
+        char data[1024];
+        while(::read(_wakeupFd[0], data, sizeof(data)) > 0)
+        {
+        }
+
+        //
+        // The inotify events are aligned on the size of the event
+        // structure, the buffer is aligned accordingly.
+        //
+        struct inotify_event events[64];
+        vector<pair<int, string> > changes;
+        ssize_t n;
+        while((n = ::read(_inotifyFd, events, sizeof(events))) > 0)
+        {
+            const char* p = reinterpret_cast<const char*>(events);
+            const char* end = p + n;
+            while(p < end)
+            {
+                const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(p);
+                changes.push_back(make_pair(event->wd, event->len > 0 ? string(event->name) : string()));
+                p += sizeof(struct inotify_event) + event->len;
+            }
+        }
+#else
+        {
+            Lock sync(*this);
+            if(!_destroyed && !_notified)
+            {
+                timedWait(IceUtil::Time::seconds(1));
+            }
+            _notified = false;
+        }
+#endif
+
+        vector<FileFollowerPtr> send;
+        {
+            Lock sync(*this);
+            if(_destroyed)
+            {
+                return;
+            }
+
+#if defined(__linux__)
+            set<string> changed;
+            for(vector<pair<int, string> >::const_iterator p = changes.begin(); p != changes.end(); ++p)
+            {
+                map<int, string>::const_iterator q = _watches.find(p->first);
+                if(q != _watches.end())
+                {
+                    changed.insert(q->second);
+                    continue;
+                }
+
+                //
+                // A file was created or moved to the directory of
+                // followed files.
+                //
+                q = _directoryWatches.find(p->first);
+                if(q != _directoryWatches.end())
+                {
+                    for(map<Ice::Identity, FileFollowerPtr>::const_iterator r = _followers.begin();
+                        r != _followers.end(); ++r)
+                    {
+                        if(splitPath(r->second->path) == make_pair(q->second, p->second))
+                        {
+                            changed.insert(r->second->path);
+                        }
+                    }
+                }
+            }
+
+            //
+            // Check if the changed files were replaced.
+            //
+            for(set<string>::const_iterator p = changed.begin(); p != changed.end(); ++p)
+            {
+                rewatch(*p);
+            }
+#endif
+
+            for(map<Ice::Identity, FileFollowerPtr>::const_iterator p = _followers.begin(); p != _followers.end(); ++p)
+            {
+                FileFollowerPtr follower = p->second;
+#if defined(__linux__)
+                if(changed.find(follower->path) != changed.end())
+                {
+                    follower->changed = true;
+                }
+#else
+                follower->changed = true; // Check all the files for new lines.
+#endif
+                if(follower->changed && !follower->sending)
+                {
+                    follower->changed = false;
+                    follower->sending = true;
+                    send.push_back(follower);
+                }
+            }
+        }
+
+        for(vector<FileFollowerPtr>::const_iterator p = send.begin(); p != send.end(); ++p)
+        {
+            sendLines(*p);
+        }
+    }
+}
+
+void
+FileCache::linesAppended(const FileFollowerPtr& follower)
+{
+    Lock sync(*this);
+    follower->sending = false;
+    if(follower->changed)
+    {
+        wakeup();
+    }
+}
+
+void
+FileCache::linesAppendedException(const Ice::Exception&, const FileFollowerPtr& follower)
+{
+    removeFollower(follower);
+}
+
+CachedFilePtr
+FileCache::getFile(const string& file)
+{
+    Lock sync(*this);
+    map<string, CachedFilePtr>::iterator p = _files.find(file);
+    if(p != _files.end())
+    {
+#ifndef _WIN32
+        //
+        // If the file was removed or replaced (log rotation), it's
+        // opened again.
+        //
+        IceUtilInternal::structstat buf;
+        if(IceUtilInternal::stat(file, &buf) == 0 && buf.st_dev == p->second->device && buf.st_ino == p->second->inode)
+        {
+            p->second->lastUse = ++_useCount;
+            return p->second;
+        }
+        _files.erase(p);
+#else
+        p->second->lastUse = ++_useCount;
+        return p->second;
+#endif
+    }
+
+    int fd = IceUtilInternal::open(file, O_RDONLY | O_BINARY); // file is a UTF-8 string
+    if(fd < 0)
+    {
+        throw FileNotAvailableException("failed to open file `" + file + "'");
+    }
+
+    if(_files.size() >= maxOpenFiles)
+    {
+        //
+        // Close the least recently used file, it's only closed once
+        // the reads in progress complete.
+        //
+        map<string, CachedFilePtr>::iterator lru = _files.begin();
+        for(map<string, CachedFilePtr>::iterator q = _files.begin(); q != _files.end(); ++q)
+        {
+            if(q->second->lastUse < lru->second->lastUse)
+            {
+                lru = q;
+            }
+        }
+        _files.erase(lru);
+    }
+
+    CachedFilePtr f = new CachedFile(file, fd);
+    f->lastUse = ++_useCount;
+    _files.insert(make_pair(file, f));
+    return f;
+}
+
+void
+FileCache::sendLines(const FileFollowerPtr& follower)
+{
+    Ice::Long pos;
+    {
+        Lock sync(*this);
+        if(follower->rotated)
+        {
+            follower->pos = 0;
+            follower->rotated = false;
+        }
+        pos = follower->pos;
+    }
+
+    Ice::StringSeq lines;
+    Ice::Long newPos;
+    bool eof;
+    try
+    {
+        eof = read(follower->path, pos, follower->size, newPos, lines);
+    }
+    catch(const FileNotAvailableException&)
+    {
+        //
+        // The file was removed or is being replaced, the follower
+        // resumes reading it once it's created again.
+        //
+        Lock sync(*this);
+        follower->sending = false;
+        return;
+    }
+
+    {
+        Lock sync(*this);
+        if(!follower->rotated)
+        {
+            follower->pos = newPos;
+        }
+        if(lines.empty())
+        {
+            follower->sending = false;
+            return;
+        }
+        if(!eof)
+        {
+            follower->changed = true; // More lines are available.
+        }
+    }
+
+    try
+    {
+        follower->observer->begin_linesAppended(lines,
+                                                newCallback_FileObserver_linesAppended(FileCachePtr(this),
+                                                    &FileCache::linesAppended,
+                                                    &FileCache::linesAppendedException),
+                                                follower);
+    }
+    catch(const Ice::LocalException&)
+    {
+        removeFollower(follower);
+    }
+}
+
+void
+FileCache::removeFollower(const FileFollowerPtr& follower)
+{
+    Lock sync(*this);
+    map<Ice::Identity, FileFollowerPtr>::iterator p = _followers.find(follower->observer->ice_getIdentity());
+    if(p != _followers.end() && p->second == follower)
+    {
+        _followers.erase(p);
+        unwatch(follower->path);
+    }
+}
+
+void
+FileCache::unwatch(const string& path)
+{
+    //
+    // Called with the mutex locked. Stop watching the file if it's no
+    // longer followed.
+    //
+#if defined(__linux__)
+    string directory = splitPath(path).first;
+    bool directoryFollowed = false;
+    for(map<Ice::Identity, FileFollowerPtr>::const_iterator p = _followers.begin(); p != _followers.end(); ++p)
+    {
+        if(p->second->path == path)
+        {
+            return;
+        }
+        directoryFollowed = directoryFollowed || splitPath(p->second->path).first == directory;
+    }
+
+    for(map<int, string>::iterator p = _watches.begin(); p != _watches.end(); ++p)
+    {
+        if(p->second == path)
+        {
+            inotify_rm_watch(_inotifyFd, p->first);
+            _watches.erase(p);
+            break;
+        }
+    }
+
+    if(!directoryFollowed)
+    {
+        for(map<int, string>::iterator p = _directoryWatches.begin(); p != _directoryWatches.end(); ++p)
+        {
+            if(p->second == directory)
+            {
+                inotify_rm_watch(_inotifyFd, p->first);
+                _directoryWatches.erase(p);
+                break;
+            }
+        }
+    }
+#else
+    (void)path;
+#endif
+}
+
+#if defined(__linux__)
+void
+FileCache::rewatch(const string& path)
+{
+    //
+    // Called with the mutex locked. If the path now refers to another
+    // file, this file is watched instead and its followers start
+    // reading it from the beginning. Nothing changes if the file no
+    // longer exists, its directory watch tells us when it's created
+    // again.
+    //
+    int wd = -1;
+    for(map<int, string>::const_iterator p = _watches.begin(); p != _watches.end(); ++p)
+    {
+        if(p->second == path)
+        {
+            wd = p->first;
+            break;
+        }
+    }
+
+    int newWd = inotify_add_watch(_inotifyFd, path.c_str(), fileEvents);
+    if(newWd < 0 || newWd == wd)
+    {
+        return;
+    }
+
+    if(wd >= 0)
+    {
+        inotify_rm_watch(_inotifyFd, wd);
+        _watches.erase(wd);
+    }
+    _watches[newWd] = path;
+
+    for(map<Ice::Identity, FileFollowerPtr>::const_iterator p = _followers.begin(); p != _followers.end(); ++p)
+    {
+        if(p->second->path == path)
+        {
+            p->second->rotated = true;
+            p->second->changed = true;
+        }
+    }
+}
+#endif
+
+void
+FileCache::wakeup()
+{
+    //
+    // Called with the mutex locked.
+    //
+#if defined(__linux__)
+    if(_wakeupFd[1] >= 0)
+    {
+        char c = 0;
+        if(::write(_wakeupFd[1], &c, 1) < 0)
+        {
+            // Ignore, the pipe is full and the thread is already woken up.
+        }
+    }
+#else
+    _notified = true;
+    notify();
+#endif
 }
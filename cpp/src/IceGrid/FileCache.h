@@ -6,24 +6,78 @@
 #define ICE_GRID_FILE_CACHE_H
 
 #include <IceUtil/Shared.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Thread.h>
 #include <Ice/BuiltinSequences.h>
 #include <Ice/CommunicatorF.h>
+#include <IceGrid/Admin.h>
 
 namespace IceGrid
 {
 
-class FileCache : public IceUtil::Shared
+class CachedFile;
+typedef IceUtil::Handle<CachedFile> CachedFilePtr;
+
+class FileFollower;
+typedef IceUtil::Handle<FileFollower> FileFollowerPtr;
+
+//
+// The file cache reads the log files for the admin clients. The
+// descriptors of the recently read files are kept open and the files
+// are read with pread into a buffer reused by the reads of the same
+// file.
+//
+// The lines appended to the followed files are sent to the file
+// observers by the follow thread. On Linux, the followed files and
+// their directories are watched with inotify: a follower starts again
+// from the beginning of the file when the file is replaced. On other
+// platforms, the followed files are checked every second.
+//
+class FileCache : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
 
     FileCache(const Ice::CommunicatorPtr&);
+    virtual ~FileCache();
 
     Ice::Long getOffsetFromEnd(const std::string&, int);
     bool read(const std::string&, Ice::Long, int, Ice::Long&, Ice::StringSeq&);
 
+    void follow(const std::string&, Ice::Long, int, const FileObserverPrx&);
+    void unfollow(const FileObserverPrx&);
+
+    void destroy();
+
+    void runFollow();
+    void linesAppended(const FileFollowerPtr&);
+    void linesAppendedException(const Ice::Exception&, const FileFollowerPtr&);
+
 private:
 
+    CachedFilePtr getFile(const std::string&);
+    void sendLines(const FileFollowerPtr&);
+    void removeFollower(const FileFollowerPtr&);
+    void unwatch(const std::string&);
+    void wakeup();
+
     const int _messageSizeMax;
+
+    std::map<std::string, CachedFilePtr> _files;
+    Ice::Long _useCount;
+
+    std::map<Ice::Identity, FileFollowerPtr> _followers;
+    IceUtil::ThreadPtr _thread;
+    bool _destroyed;
+#if defined(__linux__)
+    void rewatch(const std::string&);
+
+    int _inotifyFd;
+    int _wakeupFd[2];
+    std::map<int, std::string> _watches;
+    std::map<int, std::string> _directoryWatches;
+#else
+    bool _notified;
+#endif
 };
 typedef IceUtil::Handle<FileCache> FileCachePtr;
 
@@ -30,7 +30,7 @@ InternalRegistryI::InternalRegistryI(const RegistryIPtr& registry,
     _database(database),
     _reaper(reaper),
     _wellKnownObjects(wellKnownObjects),
-    _fileCache(new FileCache(database->getCommunicator())),
+    _fileCache(registry->getFileCache()),
     _session(session)
 {
     Ice::PropertiesPtr properties = database->getCommunicator()->getProperties();
@@ -246,6 +246,19 @@ InternalRegistryI::read(const string& filename, Ice::Long pos, int size, Ice::Lo
     return _fileCache->read(getFilePath(filename), pos, size, newPos, lines);
 }
 
+void
+InternalRegistryI::follow(const string& filename, Ice::Long pos, int size, const FileObserverPrx& observer,
+                          const Ice::Current&) const
+{
+    _fileCache->follow(getFilePath(filename), pos, size, observer);
+}
+
+void
+InternalRegistryI::unfollow(const FileObserverPrx& observer, const Ice::Current&) const
+{
+    _fileCache->unfollow(observer);
+}
+
 string
 InternalRegistryI::getFilePath(const string& filename) const
 {
@@ -54,6 +54,8 @@ public:
 
     virtual Ice::Long getOffsetFromEnd(const std::string&, int, const Ice::Current&) const;
     virtual bool read(const std::string&, Ice::Long, int, Ice::Long&, Ice::StringSeq&, const Ice::Current&) const;
+    virtual void follow(const std::string&, Ice::Long, int, const FileObserverPrx&, const Ice::Current&) const;
+    virtual void unfollow(const FileObserverPrx&, const Ice::Current&) const;
 
 private:
 
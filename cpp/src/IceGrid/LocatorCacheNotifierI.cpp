@@ -0,0 +1,253 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Communicator.h>
+#include <Ice/Connection.h>
+#include <Ice/LoggerUtil.h>
+#include <IceGrid/LocatorCacheNotifierI.h>
+#include <IceGrid/AdapterCache.h>
+#include <IceGrid/TraceLevels.h>
+
+using namespace std;
+using namespace IceGrid;
+
+namespace
+{
+
+//
+// The delay before sending the queued changes, the changes made in
+// the meantime are sent with the same batch.
+//
+const IceUtil::Time flushDelay = IceUtil::Time::milliSeconds(100);
+
+}
+
+LocatorCacheNotifierI::LocatorCacheNotifierI(const Ice::CommunicatorPtr& communicator,
+                                             AdapterCache& adapterCache,
+                                             const TraceLevelsPtr& traceLevels) :
+    _communicator(communicator),
+    _adapterCache(adapterCache),
+    _traceLevels(traceLevels),
+    _timer(new IceUtil::Timer()),
+    _sweepSize(100),
+    _scheduled(false)
+{
+}
+
+void
+LocatorCacheNotifierI::subscribe(const Ice::Identity& id, const Ice::Current& current)
+{
+    if(!current.con)
+    {
+        throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "locator cache updates with a collocated locator");
+    }
+
+    Ice::LocatorCacheObserverPrx observer = Ice::LocatorCacheObserverPrx::uncheckedCast(
+        current.con->createProxy(id)->ice_encodingVersion(current.encoding)->ice_batchOneway());
+
+    Lock sync(*this);
+    if(!_timer)
+    {
+        throw Ice::ObjectNotExistException(__FILE__, __LINE__);
+    }
+
+    //
+    // The subscribers are removed when a notification fails. If the
+    // notifications are rare, we also periodically remove the
+    // subscribers whose connection is closed.
+    //
+    if(_subscribers.size() >= 2 * _sweepSize)
+    {
+        map<SubscriberKey, Ice::LocatorCacheObserverPrx>::iterator p = _subscribers.begin();
+        while(p != _subscribers.end())
+        {
+            try
+            {
+                p->first.first->throwException();
+                ++p;
+            }
+            catch(const Ice::LocalException&)
+            {
+                _subscribers.erase(p++);
+            }
+        }
+        _sweepSize = max(_subscribers.size(), static_cast<size_t>(100));
+    }
+
+    _subscribers[make_pair(current.con, id)] = observer;
+
+    if(_traceLevels->locator > 1)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->locatorCat);
+        out << "subscribed locator cache observer `" << _communicator->identityToString(id) << "'\n";
+        out << current.con->toString();
+    }
+}
+
+void
+LocatorCacheNotifierI::unsubscribe(const Ice::Identity& id, const Ice::Current& current)
+{
+    Lock sync(*this);
+    if(_subscribers.erase(make_pair(current.con, id)) > 0 && _traceLevels->locator > 1)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->locatorCat);
+        out << "unsubscribed locator cache observer `" << _communicator->identityToString(id) << "'";
+    }
+}
+
+void
+LocatorCacheNotifierI::adapterUpdated(const string& id, const Ice::ObjectPrx& proxy)
+{
+    Lock sync(*this);
+    _adapters[id] = proxy;
+    schedule();
+}
+
+void
+LocatorCacheNotifierI::serverAdapterUpdated(const string& id, const Ice::ObjectPrx& proxy)
+{
+    //
+    // The endpoints cached for the replica group of the adapter must
+    // also be discarded.
+    //
+    string replicaGroupId;
+    try
+    {
+        ServerAdapterEntryPtr entry = ServerAdapterEntryPtr::dynamicCast(_adapterCache.get(id));
+        if(entry)
+        {
+            replicaGroupId = entry->getReplicaGroupId();
+        }
+    }
+    catch(const AdapterNotExistException&)
+    {
+    }
+
+    Lock sync(*this);
+    _adapters[id] = proxy;
+    if(!replicaGroupId.empty())
+    {
+        _adapters[replicaGroupId] = 0;
+    }
+    schedule();
+}
+
+void
+LocatorCacheNotifierI::objectUpdated(const Ice::Identity& id)
+{
+    Lock sync(*this);
+    _objects.insert(id);
+    schedule();
+}
+
+void
+LocatorCacheNotifierI::destroy()
+{
+    IceUtil::TimerPtr timer;
+    {
+        Lock sync(*this);
+        timer = _timer;
+        _timer = 0;
+        _subscribers.clear();
+    }
+    if(timer)
+    {
+        timer->destroy();
+    }
+}
+
+void
+LocatorCacheNotifierI::runTimerTask()
+{
+    map<string, Ice::ObjectPrx> adapters;
+    set<Ice::Identity> objects;
+    vector<pair<SubscriberKey, Ice::LocatorCacheObserverPrx> > subscribers;
+    {
+        Lock sync(*this);
+        _scheduled = false;
+        adapters.swap(_adapters);
+        objects.swap(_objects);
+        subscribers.assign(_subscribers.begin(), _subscribers.end());
+    }
+
+    set<Ice::ConnectionPtr> connections;
+    vector<SubscriberKey> failed;
+    for(vector<pair<SubscriberKey, Ice::LocatorCacheObserverPrx> >::const_iterator p = subscribers.begin();
+        p != subscribers.end(); ++p)
+    {
+        try
+        {
+            for(map<string, Ice::ObjectPrx>::const_iterator q = adapters.begin(); q != adapters.end(); ++q)
+            {
+                p->second->adapterUpdated(q->first, q->second);
+            }
+            for(set<Ice::Identity>::const_iterator q = objects.begin(); q != objects.end(); ++q)
+            {
+                p->second->objectUpdated(*q);
+            }
+            connections.insert(p->first.first);
+        }
+        catch(const Ice::LocalException&)
+        {
+            failed.push_back(p->first);
+        }
+    }
+
+    for(set<Ice::ConnectionPtr>::const_iterator p = connections.begin(); p != connections.end(); ++p)
+    {
+        try
+        {
+            (*p)->begin_flushBatchRequests(Ice::CompressBatchBasedOnProxy);
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Ignore, the subscriber is removed with the next notification.
+        }
+    }
+
+    if(!failed.empty())
+    {
+        Lock sync(*this);
+        for(vector<SubscriberKey>::const_iterator p = failed.begin(); p != failed.end(); ++p)
+        {
+            _subscribers.erase(*p);
+        }
+    }
+
+    if(_traceLevels->locator > 2)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->locatorCat);
+        out << "sent " << adapters.size() << " adapter and " << objects.size() << " object update(s) to "
+            << subscribers.size() - failed.size() << " locator cache observer(s)";
+        if(!failed.empty())
+        {
+            out << ", removed " << failed.size() << " unreachable observer(s)";
+        }
+    }
+}
+
+void
+LocatorCacheNotifierI::schedule()
+{
+    //
+    // Called with the mutex locked.
+    //
+    if(_timer && !_scheduled && !_subscribers.empty())
+    {
+        try
+        {
+            _timer->schedule(this, flushDelay);
+            _scheduled = true;
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            // The timer is being destroyed.
+        }
+    }
+    else if(_subscribers.empty())
+    {
+        _adapters.clear();
+        _objects.clear();
+    }
+}
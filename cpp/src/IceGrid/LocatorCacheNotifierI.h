@@ -0,0 +1,70 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_GRID_LOCATOR_CACHE_NOTIFIER_I_H
+#define ICE_GRID_LOCATOR_CACHE_NOTIFIER_I_H
+
+#include <Ice/Locator.h>
+#include <IceUtil/Timer.h>
+#include <set>
+
+namespace IceGrid
+{
+
+class TraceLevels;
+typedef IceUtil::Handle<TraceLevels> TraceLevelsPtr;
+
+class AdapterCache;
+
+//
+// The locator cache notifier pushes the changes of the adapter
+// endpoints and well-known objects to the clients which subscribed
+// with the `LocatorCacheNotifier' facet of the locator.
+//
+// The changes are queued and sent by the notifier timer shortly
+// after: a change is sent only once if updated several times in the
+// meantime. The notifications are sent as batch oneway requests over
+// the connections of the subscribers and these connections are
+// flushed once all the changes are queued.
+//
+class LocatorCacheNotifierI : public Ice::LocatorCacheNotifier, public IceUtil::TimerTask, public IceUtil::Mutex
+{
+public:
+
+    LocatorCacheNotifierI(const Ice::CommunicatorPtr&, AdapterCache&, const TraceLevelsPtr&);
+
+    virtual void subscribe(const Ice::Identity&, const Ice::Current&);
+    virtual void unsubscribe(const Ice::Identity&, const Ice::Current&);
+
+    void adapterUpdated(const std::string&, const Ice::ObjectPrx&);
+    void serverAdapterUpdated(const std::string&, const Ice::ObjectPrx&);
+    void objectUpdated(const Ice::Identity&);
+
+    void destroy();
+
+    virtual void runTimerTask();
+
+private:
+
+    void schedule();
+
+    typedef std::pair<Ice::ConnectionPtr, Ice::Identity> SubscriberKey;
+
+    const Ice::CommunicatorPtr _communicator;
+    AdapterCache& _adapterCache;
+    const TraceLevelsPtr _traceLevels;
+    IceUtil::TimerPtr _timer;
+
+    std::map<SubscriberKey, Ice::LocatorCacheObserverPrx> _subscribers;
+    size_t _sweepSize;
+
+    std::map<std::string, Ice::ObjectPrx> _adapters;
+    std::set<Ice::Identity> _objects;
+    bool _scheduled;
+};
+typedef IceUtil::Handle<LocatorCacheNotifierI> LocatorCacheNotifierIPtr;
+
+}
+
+#endif
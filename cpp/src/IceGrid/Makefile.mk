@@ -27,6 +27,7 @@ local_registry_srcs     = Internal.ice \
                           DescriptorHelper.cpp \
                           FileUserAccountMapperI.cpp \
                           InternalRegistryI.cpp \
+                          LocatorCacheNotifierI.cpp \
                           LocatorI.cpp \
                           LocatorRegistryI.cpp \
                           NodeCache.cpp \
@@ -11,6 +11,7 @@
 #include <IceGrid/NodeSessionI.h>
 #include <IceGrid/ServerCache.h>
 #include <IceGrid/ReplicaCache.h>
+#include <IceGrid/AdapterCache.h>
 #include <IceGrid/DescriptorHelper.h>
 
 using namespace std;
@@ -22,10 +23,11 @@ namespace IceGrid
 struct ToInternalServerDescriptor : std::unary_function<CommunicatorDescriptorPtr&, void>
 {
     ToInternalServerDescriptor(const InternalServerDescriptorPtr& descriptor, const InternalNodeInfoPtr& node,
-                               int iceVersion) :
+                               int iceVersion, const AdapterCache& adapterCache) :
         _desc(descriptor),
         _node(node),
-        _iceVersion(iceVersion)
+        _iceVersion(iceVersion),
+        _adapterCache(adapterCache)
     {
     }
 
@@ -68,6 +70,7 @@ struct ToInternalServerDescriptor : std::unary_function<CommunicatorDescriptorPt
         //
         // Add the adapters and their configuration.
         //
+        bool latency = false;
         for(AdapterDescriptorSeq::const_iterator q = desc->adapters.begin(); q != desc->adapters.end(); ++q)
         {
             _desc->adapters.push_back(new InternalAdapterDescriptor(q->id,
@@ -81,6 +84,7 @@ struct ToInternalServerDescriptor : std::unary_function<CommunicatorDescriptorPt
             if(!q->replicaGroupId.empty())
             {
                 props.push_back(createProperty(q->name + ".ReplicaGroupId", q->replicaGroupId));
+                latency = latency || _adapterCache.hasLatencyLoadSample(q->replicaGroupId);
             }
 
             //
@@ -96,6 +100,19 @@ struct ToInternalServerDescriptor : std::unary_function<CommunicatorDescriptorPt
             }
         }
 
+        //
+        // The node reports the latency and the number of outstanding
+        // requests of the adapters of replica groups using the latency
+        // load sample, it gets them from the dispatch metrics of the
+        // IceGrid metrics view. The view is only enabled for these
+        // servers since it adds a metrics update to each dispatch.
+        //
+        if(latency && (_iceVersion == 0 || _iceVersion >= 30500))
+        {
+            props.push_back(createProperty("# Replicated object adapters load"));
+            props.push_back(createProperty("IceMX.Metrics.IceGrid.Map.Dispatch.GroupBy", "parent"));
+        }
+
         _desc->logs.insert(_desc->logs.end(), desc->logs.begin(), desc->logs.end());
 
         const string dbsPath = _node->dataDir + "/servers/" + _desc->id + "/dbs/";
@@ -171,6 +188,7 @@ struct ToInternalServerDescriptor : std::unary_function<CommunicatorDescriptorPt
     InternalServerDescriptorPtr _desc;
     InternalNodeInfoPtr _node;
     int _iceVersion;
+    const AdapterCache& _adapterCache;
 };
 
 class LoadCB : public virtual IceUtil::Shared
@@ -302,10 +320,12 @@ private:
 
 }
 
-NodeCache::NodeCache(const Ice::CommunicatorPtr& communicator, ReplicaCache& replicaCache, const string& replicaName) :
+NodeCache::NodeCache(const Ice::CommunicatorPtr& communicator, ReplicaCache& replicaCache,
+                     AdapterCache& adapterCache, const string& replicaName) :
     _communicator(communicator),
     _replicaName(replicaName),
-    _replicaCache(replicaCache)
+    _replicaCache(replicaCache),
+    _adapterCache(adapterCache)
 {
 }
 
@@ -1050,6 +1070,7 @@ NodeEntry::getInternalServerDescriptor(const ServerInfo& info) const
     // logs, adapters, db envs and properties to the internal server
     // descriptor.
     //
-    forEachCommunicator(ToInternalServerDescriptor(server, _session->getInfo(), iceVersion))(info.descriptor);
+    forEachCommunicator(ToInternalServerDescriptor(server, _session->getInfo(), iceVersion,
+                                                   _cache.getAdapterCache()))(info.descriptor);
     return server;
 }
@@ -26,6 +26,7 @@ typedef IceUtil::Handle<ServerEntry> ServerEntryPtr;
 typedef std::vector<ServerEntryPtr> ServerEntrySeq;
 
 class ReplicaCache;
+class AdapterCache;
 
 class NodeEntry : private IceUtil::Monitor<IceUtil::RecMutex>
 {
@@ -87,19 +88,21 @@ class NodeCache : public CacheByString<NodeEntry>
 {
 public:
 
-    NodeCache(const Ice::CommunicatorPtr&, ReplicaCache&, const std::string&);
+    NodeCache(const Ice::CommunicatorPtr&, ReplicaCache&, AdapterCache&, const std::string&);
 
     NodeEntryPtr get(const std::string&, bool = false) const;
 
     const Ice::CommunicatorPtr& getCommunicator() const { return _communicator; }
     const std::string& getReplicaName() const { return _replicaName; }
     ReplicaCache& getReplicaCache() const { return _replicaCache; }
+    AdapterCache& getAdapterCache() const { return _adapterCache; }
 
 private:
 
     const Ice::CommunicatorPtr _communicator;
     const std::string _replicaName;
     ReplicaCache& _replicaCache;
+    AdapterCache& _adapterCache;
 };
 
 };
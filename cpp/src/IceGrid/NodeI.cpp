@@ -730,6 +730,19 @@ NodeI::read(const string& filename, Ice::Long pos, int size, Ice::Long& newPos,
     return _fileCache->read(getFilePath(filename), pos, size, newPos, lines);
 }
 
+void
+NodeI::follow(const string& filename, Ice::Long pos, int size, const FileObserverPrx& observer,
+              const Ice::Current&) const
+{
+    _fileCache->follow(getFilePath(filename), pos, size, observer);
+}
+
+void
+NodeI::unfollow(const FileObserverPrx& observer, const Ice::Current&) const
+{
+    _fileCache->unfollow(observer);
+}
+
 void
 NodeI::shutdown()
 {
@@ -743,6 +756,8 @@ NodeI::shutdown()
         }
     }
     _serversByApplication.clear();
+
+    _fileCache->destroy();
 }
 
 Ice::CommunicatorPtr
@@ -1327,6 +1342,41 @@ NodeI::getApplicationServers(const string& application) const
     return servers;
 }
 
+AdapterLoadSeq
+NodeI::getAdapterLoads()
+{
+    //
+    // Return the loads of the replicated adapters from the last metrics
+    // received from the servers. The metrics are requested again if
+    // they weren't requested for a second, the keep alive threads of
+    // the registry replicas share the same metrics.
+    //
+    set<ServerIPtr> servers;
+    bool refresh = false;
+    {
+        IceUtil::Mutex::Lock sync(_serversLock);
+        for(map<string, set<ServerIPtr> >::const_iterator p = _serversByApplication.begin();
+            p != _serversByApplication.end(); ++p)
+        {
+            servers.insert(p->second.begin(), p->second.end());
+        }
+
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(now - _adapterLoadsTime >= IceUtil::Time::seconds(1))
+        {
+            _adapterLoadsTime = now;
+            refresh = true;
+        }
+    }
+
+    AdapterLoadSeq loads;
+    for(set<ServerIPtr>::const_iterator p = servers.begin(); p != servers.end(); ++p)
+    {
+        (*p)->getAdapterLoads(loads, refresh);
+    }
+    return loads;
+}
+
 string
 NodeI::getFilePath(const string& filename) const
 {
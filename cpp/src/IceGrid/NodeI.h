@@ -102,6 +102,8 @@ public:
 
     virtual Ice::Long getOffsetFromEnd(const std::string&, int, const Ice::Current&) const;
     virtual bool read(const std::string&, Ice::Long, int, Ice::Long&, Ice::StringSeq&, const Ice::Current&) const;
+    virtual void follow(const std::string&, Ice::Long, int, const FileObserverPrx&, const Ice::Current&) const;
+    virtual void unfollow(const FileObserverPrx&, const Ice::Current&) const;
 
     void shutdown();
 
@@ -112,6 +114,7 @@ public:
     TraceLevelsPtr getTraceLevels() const;
     UserAccountMapperPrx getUserAccountMapper() const;
     PlatformInfo& getPlatformInfo() const;
+    AdapterLoadSeq getAdapterLoads();
     FileCachePtr getFileCache() const;
     NodePrx getProxy() const;
     const PropertyDescriptorSeq& getPropertiesOverride() const;
@@ -187,6 +190,7 @@ private:
 
     IceUtil::Mutex _serversLock;
     std::map<std::string, std::set<ServerIPtr> > _serversByApplication;
+    IceUtil::Time _adapterLoadsTime;
     std::set<std::string> _patchInProgress;
 };
 typedef IceUtil::Handle<NodeI> NodeIPtr;
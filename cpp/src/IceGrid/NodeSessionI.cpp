@@ -195,6 +195,30 @@ NodeSessionI::keepAlive(const LoadInfo& load, const Ice::Current&)
     }
 }
 
+void
+NodeSessionI::updateAdapterLoads(const AdapterLoadSeq& loads, const Ice::Current&)
+{
+    {
+        Lock sync(*this);
+        if(_destroy)
+        {
+            throw Ice::ObjectNotExistException(__FILE__, __LINE__);
+        }
+    }
+
+    if(_traceLevels->adapter > 2)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->adapterCat);
+        out << "node `" << _info->name << "' adapter loads:";
+        for(AdapterLoadSeq::const_iterator p = loads.begin(); p != loads.end(); ++p)
+        {
+            out << "\n" << p->id << " (latency = " << p->latency << "ms, outstanding = " << p->outstanding << ")";
+        }
+    }
+
+    _database->getAdapterCache().updateLoads(loads);
+}
+
 void
 NodeSessionI::setReplicaObserver(const ReplicaObserverPrx& observer, const Ice::Current&)
 {
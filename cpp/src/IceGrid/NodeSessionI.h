@@ -54,6 +54,7 @@ public:
     NodeSessionI(const DatabasePtr&, const NodePrx&, const InternalNodeInfoPtr&, int, const LoadInfo&);
 
     virtual void keepAlive(const LoadInfo&, const Ice::Current&);
+    virtual void updateAdapterLoads(const AdapterLoadSeq&, const Ice::Current&);
     virtual void setReplicaObserver(const ReplicaObserverPrx&, const Ice::Current&);
     virtual int getTimeout(const Ice::Current&) const;
     virtual NodeObserverPrx getObserver(const Ice::Current&) const;
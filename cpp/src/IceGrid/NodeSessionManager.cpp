@@ -207,6 +207,15 @@ NodeSessionKeepAliveThread::keepAlive(const NodeSessionPrx& session)
     try
     {
         session->keepAlive(_node->getPlatformInfo().getLoadInfo());
+
+        //
+        // Registries which don't support the adapter loads ignore them.
+        //
+        AdapterLoadSeq loads = _node->getAdapterLoads();
+        if(!loads.empty())
+        {
+            session->begin_updateAdapterLoads(loads);
+        }
         return true;
     }
     catch(const Ice::LocalException& ex)
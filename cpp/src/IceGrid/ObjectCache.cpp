@@ -135,6 +135,11 @@ ObjectCache::remove(const Ice::Identity& id)
         Ice::Trace out(_traceLevels->logger, _traceLevels->objectCat);
         out << "removed object `" << _communicator->identityToString(id) << "'";
     }
+
+    if(_locatorCacheNotifier)
+    {
+        _locatorCacheNotifier->objectUpdated(id);
+    }
 }
 
 vector<ObjectEntryPtr>
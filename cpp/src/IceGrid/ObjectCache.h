@@ -9,6 +9,7 @@
 #include <Ice/CommunicatorF.h>
 #include <IceGrid/Cache.h>
 #include <IceGrid/Internal.h>
+#include <IceGrid/LocatorCacheNotifierI.h>
 
 namespace IceGrid
 {
@@ -53,6 +54,8 @@ public:
 
     const Ice::CommunicatorPtr& getCommunicator() const { return _communicator; }
 
+    void setLocatorCacheNotifier(const LocatorCacheNotifierIPtr& notifier) { _locatorCacheNotifier = notifier; }
+
 private:
 
     class TypeEntry
@@ -73,6 +76,7 @@ private:
 
     const Ice::CommunicatorPtr _communicator;
     std::map<std::string, TypeEntry> _types;
+    LocatorCacheNotifierIPtr _locatorCacheNotifier;
 
     static std::pointer_to_unary_function<int, unsigned int> _rand;
 };
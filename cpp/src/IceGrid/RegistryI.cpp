@@ -172,6 +172,7 @@ RegistryI::RegistryI(const CommunicatorPtr& communicator,
     _readonly(readonly),
     _initFromReplica(initFromReplica),
     _collocatedNodeName(collocatedNodeName),
+    _fileCache(new FileCache(communicator)),
     _platform("IceGrid.Registry", communicator, traceLevels)
 {
 }
@@ -685,11 +686,19 @@ RegistryI::setupLocator(const RegistryPrx& registry, const QueryPrx& query)
     Identity locatorId;
     locatorId.category = _instanceName;
 
+    //
+    // The locator cache notifier is a facet of the locator objects, the
+    // clients subscribe over their locator connection.
+    //
+    Ice::ObjectPtr notifier = _database->getLocatorCacheNotifier();
+
     locatorId.name = "Locator";
     _clientAdapter->add(locator, locatorId);
+    _clientAdapter->addFacet(notifier, locatorId, "LocatorCacheNotifier");
 
     locatorId.name = "Locator-" + _replicaName;
     _clientAdapter->add(locator, locatorId);
+    _clientAdapter->addFacet(notifier, locatorId, "LocatorCacheNotifier");
 
     return LocatorPrx::uncheckedCast(_registryAdapter->addWithUUID(locator));
 }
@@ -913,6 +922,8 @@ RegistryI::stop()
         out << "unexpected exception while shutting down registry communicator:\n" << ex;
     }
 
+    _fileCache->destroy();
+
     if(_reaper)
     {
         _reaper->terminate();
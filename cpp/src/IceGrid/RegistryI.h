@@ -39,6 +39,9 @@ typedef IceUtil::Handle<ClientSessionFactory> ClientSessionFactoryPtr;
 class AdminSessionFactory;
 typedef IceUtil::Handle<AdminSessionFactory> AdminSessionFactoryPtr;
 
+class FileCache;
+typedef IceUtil::Handle<FileCache> FileCachePtr;
+
 std::string getInstanceName(const Ice::CommunicatorPtr&);
 
 class RegistryI : public Registry
@@ -74,6 +77,7 @@ public:
     Ice::ObjectPrx createAdminCallbackProxy(const Ice::Identity&) const;
 
     const Ice::ObjectAdapterPtr& getRegistryAdapter() { return _registryAdapter; }
+    const FileCachePtr& getFileCache() const { return _fileCache; }
 
     Ice::LocatorPrx getLocator();
 
@@ -102,6 +106,7 @@ private:
     const bool _readonly;
     const std::string _initFromReplica;
     const std::string _collocatedNodeName;
+    const FileCachePtr _fileCache;
 
     DatabasePtr _database;
     Ice::ObjectAdapterPtr _clientAdapter;
@@ -367,6 +367,41 @@ private:
 };
 typedef IceUtil::Handle<ResetPropertiesCB> ResetPropertiesCBPtr;
 
+class AdapterLoadCB : public IceUtil::Shared
+{
+public:
+
+    AdapterLoadCB(const ServerIPtr& server, const map<string, string>& adapters, const TraceLevelsPtr& traceLevels) :
+        _server(server),
+        _adapters(adapters),
+        _traceLevels(traceLevels)
+    {
+    }
+
+    void
+    response(const IceMX::MetricsView& view, Ice::Long)
+    {
+        _server->updateAdapterLoads(_adapters, view);
+    }
+
+    void
+    exception(const Ice::Exception& ex)
+    {
+        if(_traceLevels->server > 2)
+        {
+            Ice::Trace out(_traceLevels->logger, _traceLevels->serverCat);
+            out << "couldn't get the adapter metrics of server `" << _server->getId() << "':\n" << ex;
+        }
+    }
+
+private:
+
+    const ServerIPtr _server;
+    const map<string, string> _adapters;
+    const TraceLevelsPtr _traceLevels;
+};
+typedef IceUtil::Handle<AdapterLoadCB> AdapterLoadCBPtr;
+
 struct EnvironmentEval : std::unary_function<string, string>
 {
 
@@ -705,7 +740,7 @@ StartCommand::nextState()
 void
 StartCommand::execute()
 {
-    _server->activate();
+    _server->queueActivation();
 }
 
 void
@@ -836,7 +871,7 @@ ServerI::~ServerI()
 void
 ServerI::waitForApplicationUpdateCompleted(const Ice::AsyncResultPtr&)
 {
-    activate();
+    queueActivation();
 }
 
 void
@@ -930,6 +965,128 @@ ServerI::getProcess() const
     }
 }
 
+void
+ServerI::getAdapterLoads(AdapterLoadSeq& loads, bool refresh)
+{
+    Ice::ObjectPrx process;
+    InternalServerDescriptorPtr desc;
+    {
+        Lock sync(*this);
+        if(_state != Active || !_process)
+        {
+            _adapterLoads.clear();
+            _adapterCounters.clear();
+            return;
+        }
+
+        for(map<string, AdapterLoad>::const_iterator p = _adapterLoads.begin(); p != _adapterLoads.end(); ++p)
+        {
+            loads.push_back(p->second);
+        }
+        if(!refresh)
+        {
+            return;
+        }
+        process = _process;
+        desc = _desc;
+    }
+
+    //
+    // Get the dispatch metrics of the communicators with the IceGrid
+    // metrics view, the registry only enables it for the communicators
+    // with adapters of replica groups using the latency load sample.
+    // The loads are updated once the metrics are received.
+    //
+    for(PropertyDescriptorSeqDict::const_iterator p = desc->properties.begin(); p != desc->properties.end(); ++p)
+    {
+        if(getProperty(p->second, "IceMX.Metrics.IceGrid.Map.Dispatch.GroupBy") != "parent")
+        {
+            continue;
+        }
+
+        map<string, string> adapters;
+        for(PropertyDescriptorSeq::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+        {
+            const string adapterId = ".AdapterId";
+            if(q->name.size() > adapterId.size() &&
+               q->name.compare(q->name.size() - adapterId.size(), adapterId.size(), adapterId) == 0)
+            {
+                adapters[q->name.substr(0, q->name.size() - adapterId.size())] = q->value;
+            }
+        }
+
+        string facet;
+        if(p->first == "config")
+        {
+            facet = "Metrics";
+        }
+        else
+        {
+            assert(p->first.find("config_") == 0);
+            const string service = p->first.substr(7);
+            PropertyDescriptorSeqDict::const_iterator config = desc->properties.find("config");
+            if(config != desc->properties.end() &&
+               getPropertyAsInt(config->second, "IceBox.UseSharedCommunicator." + service) > 0)
+            {
+                facet = "IceBox.SharedCommunicator.Metrics";
+            }
+            else
+            {
+                facet = "IceBox.Service." + service + ".Metrics";
+            }
+        }
+
+        AdapterLoadCBPtr cb = new AdapterLoadCB(this, adapters, _node->getTraceLevels());
+        IceMX::MetricsAdminPrx metrics = IceMX::MetricsAdminPrx::uncheckedCast(process, facet);
+        metrics->begin_getMetricsView("IceGrid", IceMX::newCallback_MetricsAdmin_getMetricsView(
+                                          cb, &AdapterLoadCB::response, &AdapterLoadCB::exception));
+    }
+}
+
+void
+ServerI::updateAdapterLoads(const map<string, string>& adapters, const IceMX::MetricsView& view)
+{
+    IceMX::MetricsView::const_iterator p = view.find("Dispatch");
+    if(p == view.end())
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    if(_state != Active)
+    {
+        return;
+    }
+
+    //
+    // The dispatch metrics are grouped by object adapter name. The
+    // latency is the average lifetime of the dispatches since the
+    // previous metrics, in milliseconds.
+    //
+    for(IceMX::MetricsMap::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+    {
+        map<string, string>::const_iterator a = adapters.find((*q)->id);
+        if(a == adapters.end())
+        {
+            continue;
+        }
+
+        AdapterLoad load;
+        load.id = a->second;
+        load.latency = -1.0f;
+        load.outstanding = (*q)->current;
+
+        map<string, pair<Ice::Long, Ice::Long> >::const_iterator c = _adapterCounters.find(load.id);
+        if(c != _adapterCounters.end() && (*q)->total > c->second.first)
+        {
+            load.latency = static_cast<float>((*q)->totalLifetime - c->second.second) /
+                static_cast<float>((*q)->total - c->second.first) / 1000.0f;
+        }
+        _adapterCounters[load.id] = make_pair((*q)->total, (*q)->totalLifetime);
+        _adapterLoads[load.id] = load;
+    }
+}
+
 void
 ServerI::setEnabled(bool enabled, const ::Ice::Current&)
 {
@@ -1056,6 +1213,19 @@ ServerI::read(const string& filename, Ice::Long pos, int size, Ice::Long& newPos
     return _node->getFileCache()->read(getFilePath(filename), pos, size, newPos, lines);
 }
 
+void
+ServerI::follow(const string& filename, Ice::Long pos, int size, const FileObserverPrx& observer,
+                const Ice::Current&) const
+{
+    _node->getFileCache()->follow(getFilePath(filename), pos, size, observer);
+}
+
+void
+ServerI::unfollow(const FileObserverPrx& observer, const Ice::Current&) const
+{
+    _node->getFileCache()->unfollow(observer);
+}
+
 bool
 ServerI::isAdapterActivatable(const string& id) const
 {
@@ -1608,6 +1778,12 @@ ServerI::activationTimedOut()
     }
 }
 
+void
+ServerI::queueActivation()
+{
+    _node->getActivator()->queueActivation(this);
+}
+
 void
 ServerI::activate()
 {
@@ -9,6 +9,7 @@
 #include <IceUtil/Timer.h>
 #include <IceGrid/Activator.h>
 #include <IceGrid/Internal.h>
+#include <Ice/Metrics.h>
 #include <set>
 
 #ifndef _WIN32
@@ -82,6 +83,8 @@ public:
 
     virtual Ice::Long getOffsetFromEnd(const std::string&, int, const Ice::Current&) const;
     virtual bool read(const std::string&, Ice::Long, int, Ice::Long&, Ice::StringSeq&, const Ice::Current&) const;
+    virtual void follow(const std::string&, Ice::Long, int, const FileObserverPrx&, const Ice::Current&) const;
+    virtual void unfollow(const FileObserverPrx&, const Ice::Current&) const;
 
     bool isAdapterActivatable(const std::string&) const;
     const std::string& getId() const;
@@ -101,6 +104,7 @@ public:
     void adapterDeactivated(const std::string&);
     void activationTimedOut();
 
+    void queueActivation();
     void activate();
     void kill();
     void deactivate();
@@ -116,6 +120,9 @@ public:
 
     PropertyDescriptorSeqDict getProperties(const InternalServerDescriptorPtr&);
 
+    void getAdapterLoads(AdapterLoadSeq&, bool);
+    void updateAdapterLoads(const std::map<std::string, std::string>&, const IceMX::MetricsView&);
+
     void updateRuntimePropertiesCallback(const InternalServerDescriptorPtr&);
     void updateRuntimePropertiesCallback(const Ice::Exception&, const InternalServerDescriptorPtr&);
 
@@ -168,6 +175,8 @@ private:
     std::string _stdOutFile;
     Ice::StringSeq _logs;
     PropertyDescriptorSeq _properties;
+    std::map<std::string, AdapterLoad> _adapterLoads;
+    std::map<std::string, std::pair<Ice::Long, Ice::Long> > _adapterCounters;
 
     DestroyCommandPtr _destroy;
     StopCommandPtr _stop;
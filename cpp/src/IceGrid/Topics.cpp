@@ -5,6 +5,7 @@
 #include <Ice/Ice.h>
 #include <IceGrid/Topics.h>
 #include <IceGrid/DescriptorHelper.h>
+#include <IceGrid/TraceLevels.h>
 
 using namespace std;
 using namespace IceGrid;
@@ -22,6 +23,25 @@ Ice::EncodingVersion encodings[] = {
     { 1, 1 }
 };
 
+class FlushUpdatesTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    FlushUpdatesTimerTask(const NodeObserverTopicPtr& topic) : _topic(topic)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _topic->flushUpdates();
+    }
+
+private:
+
+    const NodeObserverTopicPtr _topic;
+};
+
 }
 
 ObserverTopic::ObserverTopic(const IceStorm::TopicManagerPrx& topicManager, const string& name, Ice::Long dbSerial) :
@@ -357,10 +377,21 @@ RegistryObserverTopic::initObserver(const Ice::ObjectPrx& obsv)
 }
 
 NodeObserverTopic::NodeObserverTopic(const IceStorm::TopicManagerPrx& topicManager,
-                                     const Ice::ObjectAdapterPtr& adapter) :
-    ObserverTopic(topicManager, "NodeObserver")
+                                     const Ice::ObjectAdapterPtr& adapter,
+                                     const LocatorCacheNotifierIPtr& locatorCacheNotifier,
+                                     const TraceLevelsPtr& traceLevels) :
+    ObserverTopic(topicManager, "NodeObserver"),
+    _locatorCacheNotifier(locatorCacheNotifier),
+    _traceLevels(traceLevels),
+    _updateWindow(IceUtil::Time::milliSeconds(topicManager->ice_getCommunicator()->getProperties()->getPropertyAsInt(
+                                                  "IceGrid.Registry.ObserverUpdateWindow"))),
+    _superseded(0)
 {
     _publishers = getPublishers<NodeObserverPrx>();
+    if(_updateWindow > IceUtil::Time())
+    {
+        _timer = new IceUtil::Timer();
+    }
     try
     {
         const_cast<NodeObserverPrx&>(_externalPublisher) = NodeObserverPrx::uncheckedCast(adapter->addWithUUID(this));
@@ -461,23 +492,32 @@ NodeObserverTopic::updateServer(const string& node, const ServerDynamicInfo& ser
         _serverStatus.erase(server.id);
     }
 
-    try
+    if(queueUpdate())
     {
-        for(vector<NodeObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
+        //
+        // The update supersedes the update of the server which is
+        // still pending, if any.
+        //
+        ServerDynamicInfo& pending = _pendingServers[make_pair(node, server.id)];
+        if(!pending.id.empty())
         {
-            (*q)->updateServer(node, server);
+            ++_superseded;
         }
+        else
+        {
+            _pendingOrder.push_back(make_pair(make_pair(node, server.id), true));
+        }
+        pending = server;
+        return;
     }
-    catch(const Ice::LocalException& ex)
-    {
-        Ice::Warning out(_logger);
-        out << "unexpected exception while publishing `updateServer' update:\n" << ex;
-    }
+    publishUpdateServer(node, server);
 }
 
 void
 NodeObserverTopic::updateAdapter(const string& node, const AdapterDynamicInfo& adapter, const Ice::Current&)
 {
+    _locatorCacheNotifier->serverAdapterUpdated(adapter.id, adapter.proxy);
+
     Lock sync(*this);
     if(_topics.empty())
     {
@@ -517,18 +557,21 @@ NodeObserverTopic::updateAdapter(const string& node, const AdapterDynamicInfo& a
         adapters.push_back(adapter);
     }
 
-    try
+    if(queueUpdate())
     {
-        for(vector<NodeObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
+        AdapterDynamicInfo& pending = _pendingAdapters[make_pair(node, adapter.id)];
+        if(!pending.id.empty())
         {
-            (*q)->updateAdapter(node, adapter);
+            ++_superseded;
         }
+        else
+        {
+            _pendingOrder.push_back(make_pair(make_pair(node, adapter.id), false));
+        }
+        pending = adapter;
+        return;
     }
-    catch(const Ice::LocalException& ex)
-    {
-        Ice::Warning out(_logger);
-        out << "unexpected exception while publishing `updateAdapter' update:\n" << ex;
-    }
+    publishUpdateAdapter(node, adapter);
 }
 
 void
@@ -553,7 +596,38 @@ NodeObserverTopic::nodeDown(const string& name)
         _serverStatus.erase(p->id);
     }
 
+    AdapterDynamicInfoSeq adapters;
+    adapters.swap(_nodes[name].adapters);
+
     _nodes.erase(name);
+
+    //
+    // The pending updates of the node are dropped, the observers
+    // discard the state of the node when notified that it's down.
+    //
+    for(map<UpdateKey, ServerDynamicInfo>::iterator p = _pendingServers.lower_bound(make_pair(name, string()));
+        p != _pendingServers.end() && p->first.first == name;)
+    {
+        _pendingServers.erase(p++);
+    }
+    for(map<UpdateKey, AdapterDynamicInfo>::iterator p = _pendingAdapters.lower_bound(make_pair(name, string()));
+        p != _pendingAdapters.end() && p->first.first == name;)
+    {
+        _pendingAdapters.erase(p++);
+    }
+    vector<pair<UpdateKey, bool> >::iterator q = _pendingOrder.begin();
+    while(q != _pendingOrder.end())
+    {
+        if(q->first.first == name)
+        {
+            q = _pendingOrder.erase(q);
+        }
+        else
+        {
+            ++q;
+        }
+    }
+
     try
     {
         for(vector<NodeObserverPrx>::const_iterator p = _publishers.begin(); p != _publishers.end(); ++p)
@@ -566,6 +640,16 @@ NodeObserverTopic::nodeDown(const string& name)
         Ice::Warning out(_logger);
         out << "unexpected exception while publishing `nodeDown' update:\n" << ex;
     }
+
+    //
+    // The endpoints of the adapters of the node can't be trusted
+    // anymore, the clients must look them up again.
+    //
+    sync.release();
+    for(AdapterDynamicInfoSeq::const_iterator p = adapters.begin(); p != adapters.end(); ++p)
+    {
+        _locatorCacheNotifier->serverAdapterUpdated(p->id, 0);
+    }
 }
 
 void
@@ -600,6 +684,128 @@ NodeObserverTopic::isServerEnabled(const string& server) const
     }
 }
 
+void
+NodeObserverTopic::flushUpdates()
+{
+    Lock sync(*this);
+    if(_topics.empty())
+    {
+        return;
+    }
+
+    //
+    // The updates are published in the order of the first update of
+    // each server or adapter, an update superseded by a later update
+    // keeps the place of the update it supersedes.
+    //
+    for(vector<pair<UpdateKey, bool> >::const_iterator p = _pendingOrder.begin(); p != _pendingOrder.end(); ++p)
+    {
+        if(p->second)
+        {
+            map<UpdateKey, ServerDynamicInfo>::const_iterator q = _pendingServers.find(p->first);
+            assert(q != _pendingServers.end());
+            publishUpdateServer(p->first.first, q->second);
+        }
+        else
+        {
+            map<UpdateKey, AdapterDynamicInfo>::const_iterator q = _pendingAdapters.find(p->first);
+            assert(q != _pendingAdapters.end());
+            publishUpdateAdapter(p->first.first, q->second);
+        }
+    }
+
+    if(_traceLevels->node > 2)
+    {
+        Ice::Trace out(_traceLevels->logger, _traceLevels->nodeCat);
+        out << "published " << _pendingServers.size() << " server and " << _pendingAdapters.size()
+            << " adapter update(s) to the node observers";
+        if(_superseded > 0)
+        {
+            out << ", dropped " << _superseded << " superseded update(s)";
+        }
+        out << ", held back for "
+            << (IceUtil::Time::now(IceUtil::Time::Monotonic) - _pendingSince).toMilliSeconds() << "ms";
+    }
+
+    _pendingServers.clear();
+    _pendingAdapters.clear();
+    _pendingOrder.clear();
+    _pendingSince = IceUtil::Time();
+    _superseded = 0;
+}
+
+void
+NodeObserverTopic::destroy()
+{
+    ObserverTopic::destroy();
+    if(_timer)
+    {
+        _timer->destroy();
+    }
+}
+
+void
+NodeObserverTopic::publishUpdateServer(const string& node, const ServerDynamicInfo& server)
+{
+    try
+    {
+        for(vector<NodeObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
+        {
+            (*q)->updateServer(node, server);
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing `updateServer' update:\n" << ex;
+    }
+}
+
+void
+NodeObserverTopic::publishUpdateAdapter(const string& node, const AdapterDynamicInfo& adapter)
+{
+    try
+    {
+        for(vector<NodeObserverPrx>::const_iterator q = _publishers.begin(); q != _publishers.end(); ++q)
+        {
+            (*q)->updateAdapter(node, adapter);
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Warning out(_logger);
+        out << "unexpected exception while publishing `updateAdapter' update:\n" << ex;
+    }
+}
+
+bool
+NodeObserverTopic::queueUpdate()
+{
+    //
+    // Called with the mutex locked. Returns true if the update must
+    // be queued, the first queued update schedules the flush of the
+    // updates at the end of the window.
+    //
+    if(!_timer)
+    {
+        return false;
+    }
+
+    if(_pendingServers.empty() && _pendingAdapters.empty())
+    {
+        try
+        {
+            _timer->schedule(new FlushUpdatesTimerTask(this), _updateWindow);
+        }
+        catch(const IceUtil::IllegalArgumentException&)
+        {
+            return false; // The timer is being destroyed.
+        }
+        _pendingSince = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    }
+    return true;
+}
+
 ApplicationObserverTopic::ApplicationObserverTopic(const IceStorm::TopicManagerPrx& topicManager,
                                                    const map<string, ApplicationInfo>& applications, Ice::Long serial) :
     ObserverTopic(topicManager, "ApplicationObserver", serial),
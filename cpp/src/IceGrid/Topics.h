@@ -6,9 +6,11 @@
 #define ICEGRID_TOPICS_H
 
 #include <IceUtil/Mutex.h>
+#include <IceUtil/Timer.h>
 #include <IceStorm/IceStorm.h>
 #include <IceGrid/Internal.h>
 #include <IceGrid/Registry.h>
+#include <IceGrid/LocatorCacheNotifierI.h>
 #include <set>
 
 namespace IceGrid
@@ -80,11 +82,22 @@ private:
 };
 typedef IceUtil::Handle<RegistryObserverTopic> RegistryObserverTopicPtr;
 
+class TraceLevels;
+typedef IceUtil::Handle<TraceLevels> TraceLevelsPtr;
+
+//
+// If IceGrid.Registry.ObserverUpdateWindow is set, the server and
+// adapter updates are held back for the duration of the window and
+// only the latest update of each server or adapter is published when
+// the window expires. The updates are published in the order of the
+// first update of each server or adapter.
+//
 class NodeObserverTopic : public ObserverTopic, public NodeObserver
 {
 public:
 
-    NodeObserverTopic(const IceStorm::TopicManagerPrx&, const Ice::ObjectAdapterPtr&);
+    NodeObserverTopic(const IceStorm::TopicManagerPrx&, const Ice::ObjectAdapterPtr&,
+                      const LocatorCacheNotifierIPtr&, const TraceLevelsPtr&);
 
     virtual void nodeInit(const NodeDynamicInfoSeq&, const Ice::Current&);
     virtual void nodeUp(const NodeDynamicInfo&, const Ice::Current&);
@@ -99,12 +112,31 @@ public:
 
     bool isServerEnabled(const std::string&) const;
 
+    void flushUpdates();
+    void destroy();
+
 private:
 
+    void publishUpdateServer(const std::string&, const ServerDynamicInfo&);
+    void publishUpdateAdapter(const std::string&, const AdapterDynamicInfo&);
+    bool queueUpdate();
+
+    typedef std::pair<std::string, std::string> UpdateKey; // The node name and the server or adapter ID.
+
     const NodeObserverPrx _externalPublisher;
+    const LocatorCacheNotifierIPtr _locatorCacheNotifier;
+    const TraceLevelsPtr _traceLevels;
+    const IceUtil::Time _updateWindow;
+    IceUtil::TimerPtr _timer;
     std::vector<NodeObserverPrx> _publishers;
     std::map<std::string, NodeDynamicInfo> _nodes;
     std::map<std::string, bool> _serverStatus;
+
+    std::map<UpdateKey, ServerDynamicInfo> _pendingServers;
+    std::map<UpdateKey, AdapterDynamicInfo> _pendingAdapters;
+    std::vector<std::pair<UpdateKey, bool> > _pendingOrder; // The order of the first updates, true for a server.
+    IceUtil::Time _pendingSince;
+    Ice::Long _superseded;
 };
 typedef IceUtil::Handle<NodeObserverTopic> NodeObserverTopicPtr;
 
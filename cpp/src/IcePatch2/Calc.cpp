@@ -8,6 +8,11 @@
 #include <Ice/ConsoleUtil.h>
 #include <IcePatch2Lib/Util.h>
 #include <iterator>
+#include <sstream>
+
+#ifndef _WIN32
+#   include <unistd.h>
+#endif
 
 using namespace std;
 using namespace Ice;
@@ -104,6 +109,9 @@ usage(const string& appName)
         "-z, --compress          Always compress files.\n"
         "-Z, --no-compress       Never compress files.\n"
         "-i, --case-insensitive  Files must not differ in case only.\n"
+        "-c, --chunks            Compute the chunk manifest for chunk-based patching.\n"
+        "-I, --incremental       Only process files modified since the last run.\n"
+        "-j, --jobs N            Process files with N threads (default: number of CPUs).\n"
         "-V, --verbose           Verbose mode.\n"
         ;
 }
@@ -128,6 +136,9 @@ main(int argc, char* argv[])
     int compress = 1;
     bool verbose;
     bool caseInsensitive;
+    bool chunks;
+    bool incremental;
+    int jobs;
 
     IceUtilInternal::Options opts;
     opts.addOpt("h", "help");
@@ -136,6 +147,9 @@ main(int argc, char* argv[])
     opts.addOpt("Z", "no-compress");
     opts.addOpt("V", "verbose");
     opts.addOpt("i", "case-insensitive");
+    opts.addOpt("c", "chunks");
+    opts.addOpt("I", "incremental");
+    opts.addOpt("j", "jobs", IceUtilInternal::Options::NeedArg);
 
     vector<string> args;
     try
@@ -177,6 +191,33 @@ main(int argc, char* argv[])
     }
     verbose = opts.isSet("verbose");
     caseInsensitive = opts.isSet("case-insensitive");
+    chunks = opts.isSet("chunks");
+    incremental = opts.isSet("incremental");
+
+    if(opts.isSet("jobs"))
+    {
+        istringstream is(opts.optArg("jobs"));
+        if(!(is >> jobs) || !is.eof() || jobs <= 0)
+        {
+            consoleErr << appName << ": invalid number of jobs `" << opts.optArg("jobs") << "'" << endl;
+            usage(appName);
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+#ifdef _WIN32
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        jobs = static_cast<int>(sysInfo.dwNumberOfProcessors);
+#else
+        jobs = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        if(jobs <= 0)
+        {
+            jobs = 1;
+        }
+    }
 
     if(args.empty())
     {
@@ -232,29 +273,56 @@ main(int argc, char* argv[])
         }
 
         LargeFileInfoSeq infoSeq;
+        FileStatDict stats;
 
         if(fileSeq.empty())
         {
+            //
+            // In incremental mode, the checksums of the files whose
+            // size and modification time didn't change since the
+            // checksum file was written are reused.
+            //
+            LargeFileInfoSeq oldInfoSeq;
+            FileStatDict oldStats;
+            if(incremental)
+            {
+                IceUtilInternal::structstat buf;
+                if(IceUtilInternal::stat(absDataDir + '/' + checksumFile, &buf) != -1)
+                {
+                    loadFileInfoSeq(absDataDir, oldInfoSeq, &oldStats);
+                }
+            }
+
             CalcCB calcCB;
-            if(!getFileInfoSeq(absDataDir, compress, verbose ? &calcCB : 0, infoSeq))
+            if(!getFileInfoSeq(absDataDir, compress, verbose ? &calcCB : 0, infoSeq, jobs, &stats,
+                               incremental ? &oldInfoSeq : 0, &oldStats))
             {
                 return EXIT_FAILURE;
             }
         }
         else
         {
-            loadFileInfoSeq(absDataDir, infoSeq);
+            loadFileInfoSeq(absDataDir, infoSeq, &stats);
+            const LargeFileInfoSeq oldInfoSeq = infoSeq;
+            const FileStatDict oldStats = stats;
 
             for(StringSeq::iterator p = fileSeq.begin(); p != fileSeq.end(); ++p)
             {
                 LargeFileInfoSeq partialInfoSeq;
+                FileStatDict partialStats;
 
                 CalcCB calcCB;
-                if(!getFileInfoSeqSubDir(absDataDir, *p, compress, verbose ? &calcCB : 0, partialInfoSeq))
+                if(!getFileInfoSeqSubDir(absDataDir, *p, compress, verbose ? &calcCB : 0, partialInfoSeq, jobs,
+                                         &partialStats, incremental ? &oldInfoSeq : 0, &oldStats))
                 {
                     return EXIT_FAILURE;
                 }
 
+                for(FileStatDict::const_iterator q = partialStats.begin(); q != partialStats.end(); ++q)
+                {
+                    stats[q->first] = q->second;
+                }
+
                 LargeFileInfoSeq newInfoSeq;
                 newInfoSeq.reserve(infoSeq.size());
 
@@ -303,7 +371,45 @@ main(int argc, char* argv[])
             }
         }
 
-        saveFileInfoSeq(absDataDir, infoSeq);
+        saveFileInfoSeq(absDataDir, infoSeq, &stats);
+
+        if(chunks)
+        {
+            //
+            // Chunks are only recomputed for files whose checksum
+            // changed since the chunk manifest was last saved.
+            //
+            FileChunksDict oldChunksDict;
+            loadFileChunksDict(absDataDir, oldChunksDict);
+
+            FileChunksDict chunksDict;
+            for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
+            {
+                if(p->size < 0) // Directory?
+                {
+                    continue;
+                }
+
+                FileChunks& fileChunks = chunksDict[p->path];
+
+                FileChunksDict::iterator q = oldChunksDict.find(p->path);
+                if(q != oldChunksDict.end() && q->second.checksum == p->checksum)
+                {
+                    fileChunks.chunks.swap(q->second.chunks);
+                }
+                else
+                {
+                    if(verbose)
+                    {
+                        consoleOut << "chunks: " << p->path << endl;
+                    }
+                    getChunkInfoSeq(absDataDir + '/' + p->path, fileChunks.chunks);
+                }
+                fileChunks.checksum = p->checksum;
+            }
+
+            saveFileChunksDict(absDataDir, chunksDict);
+        }
     }
     catch(const exception& ex)
     {
@@ -0,0 +1,181 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <IceUtil/DisableWarnings.h>
+#include <IceUtil/StringUtil.h>
+#include <IcePatch2/FileCache.h>
+#include <IcePatch2/FileServer.h>
+
+#ifdef _WIN32
+#   include <io.h>
+#   include <windows.h>
+#else
+#   include <unistd.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IcePatch2;
+
+namespace
+{
+
+const IceUtil::Time checkInterval = IceUtil::Time::seconds(1);
+
+}
+
+IcePatch2::CachedFile::CachedFile(const string& absolutePath, const string& path) :
+    _path(path)
+{
+    _fd = IceUtilInternal::open(absolutePath, O_RDONLY|O_BINARY);
+    if(_fd == -1)
+    {
+        throw FileAccessException(string("cannot open `") + path + "' for reading: " +
+                                  IceUtilInternal::errorToString(errno));
+    }
+
+#ifdef _WIN32
+    if(IceUtilInternal::stat(absolutePath, &_stat) == -1)
+#else
+    if(fstat(_fd, &_stat) == -1)
+#endif
+    {
+        IceUtilInternal::close(_fd);
+        throw FileAccessException(string("cannot stat `") + path + "':\n" + IceUtilInternal::lastErrorToString());
+    }
+}
+
+IcePatch2::CachedFile::~CachedFile()
+{
+    IceUtilInternal::close(_fd);
+}
+
+Int
+IcePatch2::CachedFile::read(Long pos, Int num, Byte* buffer) const
+{
+    size_t count = 0;
+    while(count < static_cast<size_t>(num))
+    {
+        Long offset = pos + static_cast<Long>(count);
+#ifdef _WIN32
+        OVERLAPPED overlapped;
+        memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD r = 0;
+        if(!ReadFile(reinterpret_cast<HANDLE>(_get_osfhandle(_fd)), buffer + count,
+                     static_cast<DWORD>(static_cast<size_t>(num) - count), &r, &overlapped))
+        {
+            if(GetLastError() == ERROR_HANDLE_EOF)
+            {
+                break;
+            }
+            throw FileAccessException("cannot read `" + _path + "': " + IceUtilInternal::lastErrorToString());
+        }
+#else
+        ssize_t r = pread(_fd, buffer + count, static_cast<size_t>(num) - count, static_cast<off_t>(offset));
+        if(r == -1)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            throw FileAccessException("cannot read `" + _path + "': " + IceUtilInternal::errorToString(errno));
+        }
+#endif
+        if(r == 0)
+        {
+            break;
+        }
+        count += static_cast<size_t>(r);
+    }
+    return static_cast<Int>(count);
+}
+
+bool
+IcePatch2::CachedFile::isCurrent(const IceUtilInternal::structstat& buf) const
+{
+    return buf.st_size == _stat.st_size && buf.st_mtime == _stat.st_mtime &&
+        buf.st_ino == _stat.st_ino && buf.st_dev == _stat.st_dev;
+}
+
+IcePatch2::FileCache::FileCache(const string& dataDir, size_t size) :
+    _dataDir(dataDir),
+    _size(size)
+{
+}
+
+CachedFilePtr
+IcePatch2::FileCache::get(const string& path)
+{
+    string absolutePath = _dataDir + '/' + path;
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        map<string, CachedFileList::iterator>::iterator p = _index.find(path);
+        if(p != _index.end() && now - p->second->checked < checkInterval)
+        {
+            _files.splice(_files.begin(), _files, p->second);
+            return p->second->file;
+        }
+    }
+
+    //
+    // The file wasn't checked recently, a file rewritten or replaced
+    // since it was opened is opened again.
+    //
+    IceUtilInternal::structstat buf;
+    if(IceUtilInternal::stat(absolutePath, &buf) == -1)
+    {
+        throw FileAccessException(string("cannot stat `") + path + "':\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        map<string, CachedFileList::iterator>::iterator p = _index.find(path);
+        if(p != _index.end())
+        {
+            if(p->second->file->isCurrent(buf))
+            {
+                p->second->checked = now;
+                _files.splice(_files.begin(), _files, p->second);
+                return p->second->file;
+            }
+            _files.erase(p->second);
+            _index.erase(p);
+        }
+    }
+
+    //
+    // Open the file without holding the lock, requests for files which
+    // are already opened aren't blocked by the file system.
+    //
+    CachedFilePtr file = new CachedFile(absolutePath, path);
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    map<string, CachedFileList::iterator>::iterator p = _index.find(path);
+    if(p != _index.end())
+    {
+        //
+        // Another thread opened the same file concurrently, the most
+        // recently opened file replaces it.
+        //
+        _files.erase(p->second);
+        _index.erase(p);
+    }
+
+    Entry entry;
+    entry.path = path;
+    entry.file = file;
+    entry.checked = now;
+    _files.push_front(entry);
+    _index.insert(make_pair(path, _files.begin()));
+    while(_files.size() > _size)
+    {
+        _index.erase(_files.back().path);
+        _files.pop_back();
+    }
+    return file;
+}
@@ -0,0 +1,100 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_PATCH2_FILE_CACHE_H
+#define ICE_PATCH2_FILE_CACHE_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <IceUtil/FileUtil.h>
+#include <Ice/Config.h>
+
+#include <list>
+#include <map>
+
+namespace IcePatch2
+{
+
+//
+// A file opened for reading by the file server. The data is read with
+// positional reads, so the file can be read concurrently by several
+// threads, and a file truncated in the meantime only results in a
+// short read.
+//
+class CachedFile : public IceUtil::Shared
+{
+public:
+
+    CachedFile(const std::string&, const std::string&);
+    ~CachedFile();
+
+    //
+    // Reads up to the given number of bytes at the given position into
+    // the buffer and returns the number of bytes read, which is smaller
+    // than the given number at the end of the file.
+    //
+    Ice::Int read(Ice::Long, Ice::Int, Ice::Byte*) const;
+
+    const std::string& path() const
+    {
+        return _path;
+    }
+
+    Ice::Long size() const
+    {
+        return static_cast<Ice::Long>(_stat.st_size);
+    }
+
+    //
+    // Returns true if the given attributes still describe the opened
+    // file, false if the file was rewritten or replaced.
+    //
+    bool isCurrent(const IceUtilInternal::structstat&) const;
+
+private:
+
+    const std::string _path;
+    int _fd;
+    IceUtilInternal::structstat _stat;
+};
+typedef IceUtil::Handle<CachedFile> CachedFilePtr;
+
+//
+// A cache of the most recently used files. This avoids opening and
+// closing a file for each chunk of the file requested by a client.
+// A cached file is checked at most once per second, it's reopened if
+// its size, modification time or inode changed since it was opened.
+//
+class FileCache : public IceUtil::Shared
+{
+public:
+
+    FileCache(const std::string&, size_t);
+
+    CachedFilePtr get(const std::string&);
+
+private:
+
+    struct Entry
+    {
+        std::string path;
+        CachedFilePtr file;
+        IceUtil::Time checked;
+    };
+    typedef std::list<Entry> CachedFileList;
+
+    const std::string _dataDir;
+    const size_t _size;
+
+    IceUtil::Mutex _mutex;
+    CachedFileList _files;
+    std::map<std::string, CachedFileList::iterator> _index;
+};
+typedef IceUtil::Handle<FileCache> FileCachePtr;
+
+}
+
+#endif
@@ -5,24 +5,102 @@
 #include <IceUtil/DisableWarnings.h>
 #include <IceUtil/FileUtil.h>
 #include <IceUtil/StringUtil.h>
+#include <Ice/IncomingAsync.h>
 #include <IcePatch2/FileServerI.h>
 
-#ifdef _WIN32
-#   include <io.h>
-#else
-#   include <unistd.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace IcePatch2;
 using namespace IcePatch2Internal;
 
-IcePatch2::FileServerI::FileServerI(const std::string& dataDir, const LargeFileInfoSeq& infoSeq) :
-    _dataDir(dataDir), _tree0(FileTree0())
+namespace
+{
+
+//
+// Sends the reply of a request for file data. The data is read from
+// the file directly into the reply, instead of being read into a
+// buffer which is then copied into the reply. The sequence size is
+// written with its 5-byte encoding and rewritten with the number of
+// bytes read, which is smaller than the given number at the end of
+// the file. A chunk must be read entirely.
+//
+template<class T> void
+sendFileData(const T& cb, const CachedFilePtr& file, Long pos, Int num, bool chunk)
+{
+    IceInternal::IncomingAsync* incoming = dynamic_cast<IceInternal::IncomingAsync*>(cb.get());
+    assert(incoming);
+
+    OutputStream* os = incoming->startWriteParams();
+    try
+    {
+        OutputStream::size_type sizePos = os->b.size();
+        os->write(Byte(255));
+        os->write(Int(0));
+        Int count = 0;
+        if(file && num > 0 && pos >= 0)
+        {
+            OutputStream::size_type start = os->b.size();
+            os->b.resize(start + static_cast<size_t>(num));
+            count = file->read(pos, num, os->b.begin() + start);
+            os->b.resize(start + static_cast<size_t>(count));
+        }
+
+        //
+        // The file was modified since the chunk manifest was computed.
+        //
+        if(chunk && count != num)
+        {
+            throw FileAccessException("size mismatch for chunk of `" + file->path() + "'");
+        }
+        os->rewrite(count, sizePos + 1);
+    }
+    catch(...)
+    {
+        //
+        // Discard the reply, the exception is sent instead.
+        //
+        os->endEncapsulation();
+        os->b.clear();
+        throw;
+    }
+    incoming->endWriteParams();
+    incoming->completed();
+}
+
+}
+
+IcePatch2::FileServerI::FileServerI(const std::string& dataDir, const LargeFileInfoSeq& infoSeq,
+                                     const FileChunksDict& chunksDict, size_t cacheSize) :
+    _dataDir(dataDir), _tree0(FileTree0()), _cache(cacheSize > 0 ? new FileCache(dataDir, cacheSize) : 0)
 {
     FileTree0& tree0 = const_cast<FileTree0&>(_tree0);
     getFileTree0(infoSeq, tree0);
+
+    //
+    // Index the chunks of each file. Chunks computed for an older
+    // version of a file are ignored, clients will fall back to
+    // download the compressed file instead.
+    //
+    for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
+    {
+        FileChunksDict::const_iterator q = chunksDict.find(p->path);
+        if(q == chunksDict.end() || q->second.checksum != p->checksum || q->second.chunks.empty())
+        {
+            continue;
+        }
+
+        _chunks[p->path] = q->second.chunks;
+
+        ChunkLocation location;
+        location.path = p->path;
+        location.pos = 0;
+        for(ChunkInfoSeq::const_iterator r = q->second.chunks.begin(); r != q->second.chunks.end(); ++r)
+        {
+            location.size = r->size;
+            _chunkLocations.insert(make_pair(r->checksum, location));
+            location.pos += r->size;
+        }
+    }
 }
 
 FileInfoSeq
@@ -71,16 +149,7 @@ IcePatch2::FileServerI::getFileCompressed_async(const AMD_FileServer_getFileComp
 {
     try
     {
-        vector<Byte> buffer;
-        getFileCompressedInternal(pa, pos, num, buffer, false);
-        if(buffer.empty())
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(0, 0));
-        }
-        else
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(&buffer[0], &buffer[0] + buffer.size()));
-        }
+        sendFileData(cb, getFileCompressedInternal(pa, pos, num, false), pos, num, false);
     }
     catch(const std::exception& ex)
     {
@@ -94,17 +163,44 @@ IcePatch2::FileServerI::getLargeFileCompressed_async(const AMD_FileServer_getLar
 {
     try
     {
-        vector<Byte> buffer;
-        getFileCompressedInternal(pa, pos, num, buffer, true);
-        if(buffer.empty())
-        {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(0, 0));
-        }
-        else
+        sendFileData(cb, getFileCompressedInternal(pa, pos, num, true), pos, num, false);
+    }
+    catch(const std::exception& ex)
+    {
+        cb->ice_exception(ex);
+    }
+}
+
+ChunkInfoSeq
+IcePatch2::FileServerI::getChunkInfoSeq(const string& pa, Int first, Int num, const Current&) const
+{
+    map<string, ChunkInfoSeq>::const_iterator p = _chunks.find(simplify(pa));
+    if(p == _chunks.end() || first < 0 || num <= 0 || first >= static_cast<Int>(p->second.size()))
+    {
+        return ChunkInfoSeq();
+    }
+
+    ChunkInfoSeq::const_iterator begin = p->second.begin() + first;
+    ChunkInfoSeq::const_iterator end = p->second.end();
+    if(num < static_cast<Int>(end - begin))
+    {
+        end = begin + num;
+    }
+    return ChunkInfoSeq(begin, end);
+}
+
+void
+IcePatch2::FileServerI::getChunk_async(const AMD_FileServer_getChunkPtr& cb, const ByteSeq& checksum,
+                                       const Current&) const
+{
+    try
+    {
+        map<ByteSeq, ChunkLocation>::const_iterator p = _chunkLocations.find(checksum);
+        if(p == _chunkLocations.end())
         {
-            cb->ice_response(make_pair<const Byte*, const Byte*>(&buffer[0], &buffer[0] + buffer.size()));
+            throw FileAccessException("unknown chunk `" + bytesToString(checksum) + "'");
         }
-
+        sendFileData(cb, getFile(p->second.path), p->second.pos, p->second.size, true);
     }
     catch(const std::exception& ex)
     {
@@ -112,9 +208,9 @@ IcePatch2::FileServerI::getLargeFileCompressed_async(const AMD_FileServer_getLar
     }
 }
 
-void
+CachedFilePtr
 IcePatch2::FileServerI::getFileCompressedInternal(const std::string& pa, Ice::Long pos, Ice::Int num,
-                                                  vector<Byte>& buffer, bool largeFile) const
+                                                  bool largeFile) const
 {
     if(IceUtilInternal::isAbsolutePath(pa))
     {
@@ -132,62 +228,25 @@ IcePatch2::FileServerI::getFileCompressedInternal(const std::string& pa, Ice::Lo
 
     if(num <= 0 || pos < 0)
     {
-        return;
-    }
-
-    string absolutePath = _dataDir + '/' + path + ".bz2";
-    int fd = IceUtilInternal::open(absolutePath, O_RDONLY|O_BINARY);
-    if(fd == -1)
-    {
-        throw FileAccessException(string("cannot open `") + path + "' for reading: " +
-                                  IceUtilInternal::errorToString(errno));
-    }
-
-    if(!largeFile)
-    {
-        IceUtilInternal::structstat buf;
-        if(IceUtilInternal::stat(absolutePath, &buf) == -1)
-        {
-            throw FileAccessException(string("cannot stat `") + path + "':\n" + IceUtilInternal::lastErrorToString());
-        }
-
-        if(buf.st_size > 0x7FFFFFFF)
-        {
-            ostringstream os;
-            os << "cannot encode size `" << buf.st_size << "' for file `" << path << "' as Ice::Int" << endl;
-            throw FileAccessException(os.str());
-        }
+        return 0;
     }
 
-    if(
-#if defined(_MSC_VER)
-        _lseek(fd, static_cast<off_t>(pos), SEEK_SET)
-#else
-        lseek(fd, static_cast<off_t>(pos), SEEK_SET)
-#endif
-        != static_cast<off_t>(pos))
+    CachedFilePtr file = getFile(path + ".bz2");
+    if(!largeFile && file->size() > 0x7FFFFFFF)
     {
-        IceUtilInternal::close(fd);
-
-        ostringstream posStr;
-        posStr << pos;
-
-        throw FileAccessException("cannot seek position " + posStr.str() + " in file `" + path + "': " +
-                                  IceUtilInternal::errorToString(errno));
+        ostringstream os;
+        os << "cannot encode size `" << file->size() << "' for file `" << path << "' as Ice::Int" << endl;
+        throw FileAccessException(os.str());
     }
+    return file;
+}
 
-    buffer.resize(num);
-#ifdef _WIN32
-    int r;
-    if((r = _read(fd, &buffer[0], static_cast<unsigned int>(num))) == -1)
-#else
-    ssize_t r;
-    if((r = read(fd, &buffer[0], static_cast<size_t>(num))) == -1)
-#endif
+CachedFilePtr
+IcePatch2::FileServerI::getFile(const string& path) const
+{
+    if(_cache)
     {
-        IceUtilInternal::close(fd);
-        throw FileAccessException("cannot read `" + path + "': " + IceUtilInternal::errorToString(errno));
+        return _cache->get(path);
     }
-
-    IceUtilInternal::close(fd);
+    return new CachedFile(_dataDir + '/' + path, path);
 }
@@ -7,6 +7,7 @@
 
 #include <IcePatch2Lib/Util.h>
 #include <IcePatch2/FileServer.h>
+#include <IcePatch2/FileCache.h>
 
 namespace IcePatch2
 {
@@ -15,7 +16,7 @@ class FileServerI : public FileServer
 {
 public:
 
-    FileServerI(const std::string&, const LargeFileInfoSeq&);
+    FileServerI(const std::string&, const LargeFileInfoSeq&, const IcePatch2Internal::FileChunksDict&, size_t);
 
     FileInfoSeq getFileInfoSeq(Ice::Int, const Ice::Current&) const;
 
@@ -38,17 +39,32 @@ public:
                                       Ice::Int,
                                       const Ice::Current&) const;
 
+    ChunkInfoSeq getChunkInfoSeq(const std::string&, Ice::Int, Ice::Int, const Ice::Current&) const;
+
+    void getChunk_async(const AMD_FileServer_getChunkPtr&, const Ice::ByteSeq&, const Ice::Current&) const;
+
 private:
 
-    void
+    CachedFilePtr
     getFileCompressedInternal(const std::string&,
                               Ice::Long,
                               Ice::Int,
-                              std::vector<Ice::Byte>&,
                               bool) const;
 
+    CachedFilePtr getFile(const std::string&) const;
+
+    struct ChunkLocation
+    {
+        std::string path;
+        Ice::Long pos;
+        Ice::Int size;
+    };
+
     const std::string _dataDir;
     const IcePatch2Internal::FileTree0 _tree0;
+    std::map<std::string, ChunkInfoSeq> _chunks;
+    std::map<Ice::ByteSeq, ChunkLocation> _chunkLocations;
+    const FileCachePtr _cache;
 };
 
 }
@@ -94,6 +94,7 @@ IcePatch2::PatcherService::start(int argc, char* argv[], int& status)
     }
 
     LargeFileInfoSeq infoSeq;
+    FileChunksDict chunksDict;
 
     try
     {
@@ -109,6 +110,7 @@ IcePatch2::PatcherService::start(int argc, char* argv[], int& status)
         }
 
         loadFileInfoSeq(dataDir, infoSeq);
+        loadFileChunksDict(dataDir, chunksDict);
     }
     catch(const exception& ex)
     {
@@ -131,7 +133,17 @@ IcePatch2::PatcherService::start(int argc, char* argv[], int& status)
     Identity id;
     id.category = instanceName;
     id.name = "server";
-    adapter->add(new FileServerI(dataDir, infoSeq), id);
+    //
+    // The number of files kept open by the file server, 0
+    // disables the cache.
+    //
+    Int cacheSize = properties->getPropertyAsIntWithDefault("IcePatch2.FileCacheSize", 100);
+    if(cacheSize < 0)
+    {
+        cacheSize = 0;
+    }
+
+    adapter->add(new FileServerI(dataDir, infoSeq, chunksDict, static_cast<size_t>(cacheSize)), id);
 
     adapter->activate();
 
@@ -4,11 +4,20 @@
 
 #include <IceUtil/StringUtil.h>
 #include <IceUtil/FileUtil.h>
+#include <Ice/SHA1.h>
 #include <IcePatch2/ClientUtil.h>
 #include <IcePatch2Lib/Util.h>
 #include <list>
+#include <set>
+#include <deque>
 #include <iterator>
 
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceUtil;
@@ -70,6 +79,7 @@ private:
     bool removeFiles(const LargeFileInfoSeq&);
     bool updateFiles(const LargeFileInfoSeq&);
     bool updateFilesInternal(const LargeFileInfoSeq&, const DecompressorPtr&);
+    bool updateFileChunks(const LargeFileInfo&);
     bool updateFlags(const LargeFileInfoSeq&);
 
     const PatcherFeedbackPtr _feedback;
@@ -87,8 +97,52 @@ private:
 
     FILE* _log;
     bool _useSmallFileAPI;
+    bool _chunkSync;
 };
 
+//
+// The number of chunk descriptions retrieved with each
+// getChunkInfoSeq call, and the number of getChunk calls
+// outstanding while patching a file chunk by chunk.
+//
+const Int chunkInfoSeqSize = 4096;
+const size_t chunkWindowSize = 4;
+
+void
+readChunk(int fd, const string& path, Long pos, Int size, ByteSeq& bytes)
+{
+    if(
+#if defined(_MSC_VER)
+        _lseek(fd, static_cast<off_t>(pos), SEEK_SET)
+#else
+        lseek(fd, static_cast<off_t>(pos), SEEK_SET)
+#endif
+        != static_cast<off_t>(pos))
+    {
+        throw runtime_error("cannot seek in `" + path + "':\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    bytes.resize(size);
+    Int offset = 0;
+    while(offset < size)
+    {
+#ifdef _WIN32
+        int r = _read(fd, &bytes[offset], static_cast<unsigned int>(size - offset));
+#else
+        ssize_t r = read(fd, &bytes[offset], static_cast<size_t>(size - offset));
+#endif
+        if(r == -1)
+        {
+            throw runtime_error("cannot read `" + path + "':\n" + IceUtilInternal::lastErrorToString());
+        }
+        else if(r == 0)
+        {
+            throw runtime_error("unexpected end of file in `" + path + "'");
+        }
+        offset += static_cast<Int>(r);
+    }
+}
+
 Decompressor::Decompressor(const string& dataDir) :
     _dataDir(dataDir),
     _destroy(false)
@@ -200,7 +254,8 @@ PatcherI::PatcherI(const CommunicatorPtr& communicator, const PatcherFeedbackPtr
     _chunkSize(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.ChunkSize", 100)),
     _remove(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.Remove", 1)),
     _log(0),
-    _useSmallFileAPI(false)
+    _useSmallFileAPI(false),
+    _chunkSync(communicator->getProperties()->getPropertyAsIntWithDefault("IcePatch2Client.ChunkSync", 1) > 0)
 {
     const char* clientProxyProperty = "IcePatch2Client.Proxy";
     string clientProxy = communicator->getProperties()->getProperty(clientProxyProperty);
@@ -229,7 +284,8 @@ PatcherI::PatcherI(const FileServerPrx& server,
     _thorough(thorough),
     _chunkSize(chunkSize),
     _remove(remove),
-    _useSmallFileAPI(false)
+    _useSmallFileAPI(false),
+    _chunkSync(true)
 {
     init(server);
 }
@@ -644,11 +700,30 @@ PatcherI::removeFiles(const LargeFileInfoSeq& files)
         return true;
     }
 
+    //
+    // Regular files that are updated are not removed when chunk-based
+    // patching is enabled, as their contents is reused to patch them.
+    //
+    set<string> updatePaths;
+    if(_chunkSync)
+    {
+        for(LargeFileInfoSeq::const_iterator p = _updateFiles.begin(); p != _updateFiles.end(); ++p)
+        {
+            if(p->size > 0)
+            {
+                updatePaths.insert(p->path);
+            }
+        }
+    }
+
     for(LargeFileInfoSeq::const_reverse_iterator p = files.rbegin(); p != files.rend(); ++p)
     {
         try
         {
-            remove(_dataDir + '/' + p->path);
+            if(p->size < 0 || updatePaths.find(p->path) == updatePaths.end())
+            {
+                remove(_dataDir + '/' + p->path);
+            }
             if(fputc('-', _log) == EOF || ! writeFileInfo(_log, *p))
             {
                 throw runtime_error("error writing log file:\n" + IceUtilInternal::lastErrorToString());
@@ -738,10 +813,45 @@ PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorP
         }
     }
 
+    //
+    // Files with a local version are first patched chunk by chunk, if
+    // the server provides the chunks. The other files are downloaded
+    // compressed.
+    //
+    LargeFileInfoSeq downloadFiles;
+    downloadFiles.reserve(files.size());
+
+    for(LargeFileInfoSeq::const_iterator p = files.begin(); p != files.end(); ++p)
+    {
+        if(_chunkSync && p->size > 0 && updateFileChunks(*p))
+        {
+            if(fputc('+', _log) == EOF || !writeFileInfo(_log, *p))
+            {
+                throw runtime_error("error writing log file:\n" + IceUtilInternal::lastErrorToString());
+            }
+
+            if(!_feedback->patchStart(p->path, p->size, updated, total))
+            {
+                return false;
+            }
+
+            updated += p->size;
+
+            if(!_feedback->patchProgress(p->size, p->size, updated, total) || !_feedback->patchEnd())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            downloadFiles.push_back(*p);
+        }
+    }
+
     AsyncResultPtr curCB;
     AsyncResultPtr nxtCB;
 
-    for(LargeFileInfoSeq::const_iterator p = files.begin(); p != files.end(); ++p)
+    for(LargeFileInfoSeq::const_iterator p = downloadFiles.begin(); p != downloadFiles.end(); ++p)
     {
         if(p->size < 0) // Directory?
         {
@@ -821,12 +931,12 @@ PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorP
                         {
                             LargeFileInfoSeq::const_iterator q = p + 1;
 
-                            while(q != files.end() && q->size <= 0)
+                            while(q != downloadFiles.end() && q->size <= 0)
                             {
                                 ++q;
                             }
 
-                            if(q != files.end())
+                            if(q != downloadFiles.end())
                             {
                                 nxtCB = _useSmallFileAPI ?
                                     _serverNoCompress->begin_getFileCompressed(q->path, 0, _chunkSize) :
@@ -917,6 +1027,158 @@ PatcherI::updateFilesInternal(const LargeFileInfoSeq& files, const DecompressorP
     return true;
 }
 
+bool
+PatcherI::updateFileChunks(const LargeFileInfo& info)
+{
+    const string path = simplify(_dataDir + '/' + info.path);
+
+    //
+    // We need the previous version of the file to patch it chunk by chunk.
+    //
+    IceUtilInternal::structstat buf;
+    if(IceUtilInternal::stat(path, &buf) == -1 || !S_ISREG(buf.st_mode) || buf.st_size == 0)
+    {
+        return false;
+    }
+
+    ChunkInfoSeq chunks;
+    try
+    {
+        while(true)
+        {
+            ChunkInfoSeq seq = _serverCompress->getChunkInfoSeq(info.path, static_cast<Int>(chunks.size()),
+                                                                chunkInfoSeqSize);
+            chunks.insert(chunks.end(), seq.begin(), seq.end());
+            if(static_cast<Int>(seq.size()) < chunkInfoSeqSize)
+            {
+                break;
+            }
+        }
+    }
+    catch(const Ice::OperationNotExistException&)
+    {
+        //
+        // The server is too old to support chunk-based patching.
+        //
+        _chunkSync = false;
+        return false;
+    }
+
+    if(chunks.empty())
+    {
+        return false;
+    }
+
+    //
+    // Chunks of the new file that are also in the local file are
+    // copied from the local file, the others are downloaded.
+    //
+    ChunkInfoSeq localChunks;
+    getChunkInfoSeq(path, localChunks);
+
+    map<ByteSeq, Long> localPositions;
+    Long pos = 0;
+    for(ChunkInfoSeq::const_iterator p = localChunks.begin(); p != localChunks.end(); ++p)
+    {
+        localPositions.insert(make_pair(p->checksum, pos));
+        pos += p->size;
+    }
+
+    const string pathTemp = path + ".chunktemp";
+    int fd = IceUtilInternal::open(path, O_RDONLY|O_BINARY);
+    if(fd == -1)
+    {
+        throw runtime_error("cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    FILE* fp = IceUtilInternal::fopen(pathTemp, "wb");
+    if(fp == 0)
+    {
+        IceUtilInternal::close(fd);
+        throw runtime_error("cannot open `" + pathTemp + "' for writing:\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    bool valid = false;
+    try
+    {
+        IceInternal::SHA1 hasher;
+        hasher.update(reinterpret_cast<const Byte*>(info.path.c_str()), info.path.size());
+
+        deque<AsyncResultPtr> results;
+        ChunkInfoSeq::const_iterator next = chunks.begin();
+
+        try
+        {
+            for(ChunkInfoSeq::const_iterator p = chunks.begin(); p != chunks.end(); ++p)
+            {
+                while(results.size() < chunkWindowSize && next != chunks.end())
+                {
+                    if(localPositions.find(next->checksum) == localPositions.end())
+                    {
+                        results.push_back(_serverCompress->begin_getChunk(next->checksum));
+                    }
+                    ++next;
+                }
+
+                ByteSeq bytes;
+                map<ByteSeq, Long>::const_iterator q = localPositions.find(p->checksum);
+                if(q != localPositions.end())
+                {
+                    readChunk(fd, path, q->second, p->size, bytes);
+                }
+                else
+                {
+                    assert(!results.empty());
+                    bytes = _serverCompress->end_getChunk(results.front());
+                    results.pop_front();
+
+                    if(static_cast<Int>(bytes.size()) != p->size)
+                    {
+                        throw FileAccessException("size mismatch for chunk of `" + info.path + "'");
+                    }
+                }
+
+                if(!bytes.empty() && fwrite(&bytes[0], bytes.size(), 1, fp) != 1)
+                {
+                    throw runtime_error("cannot write `" + pathTemp + "':\n" + IceUtilInternal::lastErrorToString());
+                }
+                hasher.update(&bytes[0], bytes.size());
+            }
+
+            ByteSeq checksum;
+            hasher.finalize(checksum);
+            valid = checksum == info.checksum;
+        }
+        catch(const FileAccessException&)
+        {
+            //
+            // The chunk manifest of the server is out of date, we
+            // download the compressed file instead.
+            //
+        }
+    }
+    catch(...)
+    {
+        fclose(fp);
+        IceUtilInternal::close(fd);
+        IceUtilInternal::remove(pathTemp);
+        throw;
+    }
+
+    fclose(fp);
+    IceUtilInternal::close(fd);
+
+    if(!valid)
+    {
+        IceUtilInternal::remove(pathTemp);
+        return false;
+    }
+
+    rename(pathTemp, path);
+    setFileFlags(path, info);
+    return true;
+}
+
 bool
 PatcherI::updateFlags(const LargeFileInfoSeq& files)
 {
@@ -14,6 +14,7 @@
 #include <IceUtil/StringUtil.h>
 #include <IceUtil/FileUtil.h>
 #include <Ice/SHA1.h>
+#include <Ice/UniquePtr.h>
 #include <IceUtil/Exception.h>
 #include <IcePatch2Lib/Util.h>
 #include <IcePatch2/FileServer.h>
@@ -28,6 +29,7 @@
 #endif
 
 #include <iterator>
+#include <deque>
 
 // Ignore macOS OpenSSL deprecation warnings
 #ifdef __APPLE__
@@ -36,6 +38,7 @@
 
 const char* IcePatch2Internal::checksumFile = "IcePatch2.sum";
 const char* IcePatch2Internal::logFile = "IcePatch2.log";
+const char* IcePatch2Internal::chunkFile = "IcePatch2.chunks";
 
 using namespace std;
 using namespace Ice;
@@ -73,18 +76,26 @@ IcePatch2Internal::toLargeFileInfo(const FileInfo& info)
 }
 
 bool
-IcePatch2Internal::writeFileInfo(FILE* fp, const LargeFileInfo& info)
+IcePatch2Internal::writeFileInfo(FILE* fp, const LargeFileInfo& info, const FileStat* stat)
 {
-    int rc = fprintf(fp, "%s\t%s\t" ICE_INT64_FORMAT "\t%d\n",
+    int rc = fprintf(fp, "%s\t%s\t" ICE_INT64_FORMAT "\t%d",
                      escapeString(info.path, "", IceUtilInternal::Compat).c_str(),
                      bytesToString(info.checksum).c_str(),
                      info.size,
                      static_cast<int>(info.executable));
-    return rc > 0;
+    if(rc > 0 && stat)
+    {
+        //
+        // The file size and modification time are written after the
+        // file info, readers which don't expect them ignore them.
+        //
+        rc = fprintf(fp, "\t" ICE_INT64_FORMAT "\t" ICE_INT64_FORMAT, stat->size, stat->time);
+    }
+    return rc > 0 && fputc('\n', fp) != EOF;
 }
 
 bool
-IcePatch2Internal::readFileInfo(FILE* fp, LargeFileInfo& info)
+IcePatch2Internal::readFileInfo(FILE* fp, LargeFileInfo& info, FileStat* stat)
 {
     string data;
     char buf[BUFSIZ];
@@ -122,6 +133,19 @@ IcePatch2Internal::readFileInfo(FILE* fp, LargeFileInfo& info)
     is >> info.size;
     is >> info.executable;
 
+    if(stat)
+    {
+        //
+        // The file size and modification time are only saved by
+        // icepatch2calc, -1 if they are missing.
+        //
+        if(!(is >> stat->size >> stat->time))
+        {
+            stat->size = -1;
+            stat->time = -1;
+        }
+    }
+
     return true;
 }
 
@@ -325,7 +349,8 @@ IcePatch2Internal::ignoreSuffix(const string& path)
     return suffix == "md5" // For legacy IcePatch.
         || suffix == "tot" // For legacy IcePatch.
         || suffix == "bz2"
-        || suffix == "bz2temp";
+        || suffix == "bz2temp"
+        || suffix == "chunktemp";
 }
 
 string
@@ -741,11 +766,74 @@ IcePatch2Internal::setFileFlags(const string&, const LargeFileInfo&)
 namespace
 {
 
+//
+// The entries of a previously computed checksum file, used to skip
+// the files which were not modified since the file was written.
+//
+struct FileInfoReuse
+{
+    time_t time;
+    map<string, LargeFileInfo> infos;
+    FileStatDict stats;
+};
+
+static bool
+reuseFileInfo(const FileInfoReuse* reuse, const string& path, const string& relPath,
+              const IceUtilInternal::structstat& buf, int compress, LargeFileInfo& info)
+{
+    if(!reuse)
+    {
+        return false;
+    }
+
+    map<string, LargeFileInfo>::const_iterator p = reuse->infos.find(relPath);
+    if(p == reuse->infos.end() || p->second.size < 0)
+    {
+        return false;
+    }
+
+    //
+    // The file must still have the size and modification time it had
+    // when its checksum was computed. A file modified during the second
+    // the checksum file was written can be modified again without
+    // changing its modification time, its checksum is computed again.
+    //
+    FileStatDict::const_iterator q = reuse->stats.find(relPath);
+    if(q == reuse->stats.end() || q->second.size != static_cast<Ice::Long>(buf.st_size) ||
+       q->second.time != static_cast<Ice::Long>(buf.st_mtime) || q->second.time >= static_cast<Ice::Long>(reuse->time))
+    {
+        return false;
+    }
+
+    if(buf.st_size != 0 && compress > 0)
+    {
+        //
+        // The compressed file must still match the file, otherwise
+        // the file must be compressed again.
+        //
+        IceUtilInternal::structstat bufBZ2;
+        if(compress >= 2 || p->second.size == 0 || IceUtilInternal::stat(path + ".bz2", &bufBZ2) == -1 ||
+           buf.st_mtime >= bufBZ2.st_mtime || bufBZ2.st_size != p->second.size)
+        {
+            return false;
+        }
+    }
+    else if(p->second.size != 0)
+    {
+        return false;
+    }
+
+    info.checksum = p->second.checksum;
+    info.size = p->second.size;
+    return true;
+}
+
 static bool
 getFileInfoSeqInternal(const string& basePath, const string& relPath, int compress, GetFileInfoSeqCB* cb,
-                       LargeFileInfoSeq& infoSeq)
+                       const FileInfoReuse* reuse, LargeFileInfoSeq& infoSeq, FileStatDict* stats,
+                       StringSeq* subPaths)
 {
-    if(relPath == checksumFile || relPath == logFile)
+    if(relPath == checksumFile || relPath == logFile || relPath == chunkFile)
     {
         return true;
     }
@@ -830,7 +918,15 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
             StringSeq content = readDirectory(path);
             for(StringSeq::const_iterator p = content.begin(); p != content.end() ; ++p)
             {
-                if(!getFileInfoSeqInternal(basePath, simplify(relPath + '/' + *p), compress, cb, infoSeq))
+                if(subPaths)
+                {
+                    //
+                    // The caller processes the directory entries.
+                    //
+                    subPaths->push_back(simplify(relPath + '/' + *p));
+                }
+                else if(!getFileInfoSeqInternal(basePath, simplify(relPath + '/' + *p), compress, cb, reuse, infoSeq,
+                                                stats, 0))
                 {
                     return false;
                 }
@@ -847,6 +943,19 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
             info.executable = buf.st_mode & S_IXUSR;
 #endif
 
+            if(stats)
+            {
+                FileStat& stat = (*stats)[relPath];
+                stat.size = static_cast<Ice::Long>(buf.st_size);
+                stat.time = static_cast<Ice::Long>(buf.st_mtime);
+            }
+
+            if(reuseFileInfo(reuse, path, relPath, buf, compress, info))
+            {
+                infoSeq.push_back(info);
+                return true;
+            }
+
             IceUtilInternal::structstat bufBZ2;
             const string pathBZ2 = path + ".bz2";
             bool doCompress = false;
@@ -1008,6 +1117,321 @@ getFileInfoSeqInternal(const string& basePath, const string& relPath, int compre
     return true;
 }
 
+//
+// Serializes the calls to the callback made by the threads of the
+// pool.
+//
+class SynchronizedGetFileInfoSeqCB : public GetFileInfoSeqCB
+{
+public:
+
+    SynchronizedGetFileInfoSeqCB(GetFileInfoSeqCB* cb) :
+        _cb(cb)
+    {
+    }
+
+    virtual bool
+    remove(const string& path)
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _cb->remove(path);
+    }
+
+    virtual bool
+    checksum(const string& path)
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _cb->checksum(path);
+    }
+
+    virtual bool
+    compress(const string& path)
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _cb->compress(path);
+    }
+
+private:
+
+    GetFileInfoSeqCB* _cb;
+    IceUtil::Mutex _mutex;
+};
+
+//
+// Walks a directory tree and computes the file infos with a pool of
+// threads. Each thread has its own queue of paths: the entries of a
+// directory are added to the queue of the thread which read the
+// directory and a thread with an empty queue steals paths from the
+// queues of the other threads.
+//
+class GetFileInfoSeqPool : public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    GetFileInfoSeqPool(const string& basePath, int compress, GetFileInfoSeqCB* cb, const FileInfoReuse* reuse,
+                       int size) :
+        _basePath(basePath),
+        _compress(compress),
+        _cb(cb ? new SynchronizedGetFileInfoSeqCB(cb) : 0),
+        _reuse(reuse),
+        _pending(0),
+        _generation(0),
+        _idle(0),
+        _stopped(false)
+    {
+        for(int i = 0; i < size; ++i)
+        {
+            _queues.push_back(new Queue);
+        }
+    }
+
+    ~GetFileInfoSeqPool()
+    {
+        for(vector<Queue*>::const_iterator p = _queues.begin(); p != _queues.end(); ++p)
+        {
+            delete *p;
+        }
+    }
+
+    bool
+    run(const string& relPath, LargeFileInfoSeq& infoSeq, FileStatDict* stats)
+    {
+        push(0, relPath);
+
+        vector<IceUtil::ThreadControl> threads;
+        for(int i = 1; i < static_cast<int>(_queues.size()); ++i)
+        {
+            threads.push_back((new WorkerThread(this, i))->start());
+        }
+
+        work(0);
+
+        for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            p->join();
+        }
+
+        if(!_error.empty())
+        {
+            throw runtime_error(_error);
+        }
+
+        if(_stopped)
+        {
+            return false;
+        }
+
+        for(vector<Queue*>::const_iterator p = _queues.begin(); p != _queues.end(); ++p)
+        {
+            infoSeq.insert(infoSeq.end(), (*p)->infoSeq.begin(), (*p)->infoSeq.end());
+            if(stats)
+            {
+                stats->insert((*p)->stats.begin(), (*p)->stats.end());
+            }
+        }
+        return true;
+    }
+
+private:
+
+    struct Queue
+    {
+        IceUtil::Mutex mutex;
+        deque<string> paths;
+        LargeFileInfoSeq infoSeq;
+        FileStatDict stats;
+    };
+
+    class WorkerThread : public IceUtil::Thread
+    {
+    public:
+
+        WorkerThread(GetFileInfoSeqPool* pool, int index) :
+            _pool(pool),
+            _index(index)
+        {
+        }
+
+        virtual void
+        run()
+        {
+            _pool->work(_index);
+        }
+
+    private:
+
+        GetFileInfoSeqPool* _pool;
+        const int _index;
+    };
+
+    void
+    work(int index)
+    {
+        string relPath;
+        while(pop(index, relPath))
+        {
+            StringSeq subPaths;
+            if(!isStopped())
+            {
+                try
+                {
+                    if(!getFileInfoSeqInternal(_basePath, relPath, _compress, _cb.get(), _reuse,
+                                               _queues[index]->infoSeq, &_queues[index]->stats, &subPaths))
+                    {
+                        stop("");
+                    }
+                }
+                catch(const exception& ex)
+                {
+                    stop(ex.what());
+                }
+            }
+
+            for(StringSeq::const_iterator p = subPaths.begin(); p != subPaths.end(); ++p)
+            {
+                push(index, *p);
+            }
+
+            Lock sync(*this);
+            if(--_pending == 0)
+            {
+                notifyAll();
+            }
+        }
+    }
+
+    void
+    push(int index, const string& relPath)
+    {
+        {
+            IceUtil::Mutex::Lock sync(_queues[index]->mutex);
+            _queues[index]->paths.push_back(relPath);
+        }
+
+        Lock sync(*this);
+        ++_pending;
+        ++_generation;
+        if(_idle > 0)
+        {
+            notify();
+        }
+    }
+
+    bool
+    pop(int index, string& relPath)
+    {
+        while(true)
+        {
+            Ice::Long generation;
+            {
+                Lock sync(*this);
+                generation = _generation;
+            }
+
+            //
+            // Process the most recently added path of our own queue
+            // first, otherwise steal the oldest path of another queue.
+            //
+            {
+                Queue* queue = _queues[index];
+                IceUtil::Mutex::Lock sync(queue->mutex);
+                if(!queue->paths.empty())
+                {
+                    relPath = queue->paths.back();
+                    queue->paths.pop_back();
+                    return true;
+                }
+            }
+
+            for(size_t i = 1; i < _queues.size(); ++i)
+            {
+                Queue* queue = _queues[(index + i) % _queues.size()];
+                IceUtil::Mutex::Lock sync(queue->mutex);
+                if(!queue->paths.empty())
+                {
+                    relPath = queue->paths.front();
+                    queue->paths.pop_front();
+                    return true;
+                }
+            }
+
+            Lock sync(*this);
+            if(_pending == 0)
+            {
+                return false;
+            }
+
+            if(generation == _generation)
+            {
+                ++_idle;
+                wait();
+                --_idle;
+            }
+        }
+    }
+
+    bool
+    isStopped()
+    {
+        Lock sync(*this);
+        return _stopped;
+    }
+
+    void
+    stop(const string& error)
+    {
+        Lock sync(*this);
+        _stopped = true;
+        if(_error.empty())
+        {
+            _error = error;
+        }
+    }
+
+    const string _basePath;
+    const int _compress;
+    const IceInternal::UniquePtr<GetFileInfoSeqCB> _cb;
+    const FileInfoReuse* _reuse;
+    vector<Queue*> _queues;
+    int _pending;
+    Ice::Long _generation;
+    int _idle;
+    bool _stopped;
+    string _error;
+};
+
+static bool
+getFileInfoSeqSubDirInternal(const string& basePath, const string& relPath, int compress, GetFileInfoSeqCB* cb,
+                             LargeFileInfoSeq& infoSeq, int threads, FileStatDict* stats,
+                             const LargeFileInfoSeq* reuseSeq, const FileStatDict* reuseStats)
+{
+    IceInternal::UniquePtr<FileInfoReuse> reuse;
+    if(reuseSeq && reuseStats)
+    {
+        IceUtilInternal::structstat buf;
+        if(IceUtilInternal::stat(simplify(basePath + '/' + checksumFile), &buf) != -1)
+        {
+            reuse.reset(new FileInfoReuse);
+            reuse->time = buf.st_mtime;
+            for(LargeFileInfoSeq::const_iterator p = reuseSeq->begin(); p != reuseSeq->end(); ++p)
+            {
+                reuse->infos[p->path] = *p;
+            }
+            reuse->stats = *reuseStats;
+        }
+    }
+
+    if(threads > 1)
+    {
+        GetFileInfoSeqPool pool(basePath, compress, cb, reuse.get(), threads);
+        return pool.run(relPath, infoSeq, stats);
+    }
+    else
+    {
+        return getFileInfoSeqInternal(basePath, relPath, compress, cb, reuse.get(), infoSeq, stats, 0);
+    }
+}
+
 }
 
 IcePatch2Internal::GetFileInfoSeqCB::~GetFileInfoSeqCB()
@@ -1017,19 +1441,22 @@ IcePatch2Internal::GetFileInfoSeqCB::~GetFileInfoSeqCB()
 
 bool
 IcePatch2Internal::getFileInfoSeq(const string& basePath, int compress, GetFileInfoSeqCB* cb,
-                                  LargeFileInfoSeq& infoSeq)
+                                  LargeFileInfoSeq& infoSeq, int threads, FileStatDict* stats,
+                                  const LargeFileInfoSeq* reuseSeq, const FileStatDict* reuseStats)
 {
-    return getFileInfoSeqSubDir(basePath, ".", compress, cb, infoSeq);
+    return getFileInfoSeqSubDir(basePath, ".", compress, cb, infoSeq, threads, stats, reuseSeq, reuseStats);
 }
 
 bool
 IcePatch2Internal::getFileInfoSeqSubDir(const string& basePa, const string& relPa, int compress, GetFileInfoSeqCB* cb,
-                                        LargeFileInfoSeq& infoSeq)
+                                        LargeFileInfoSeq& infoSeq, int threads, FileStatDict* stats,
+                                        const LargeFileInfoSeq* reuseSeq, const FileStatDict* reuseStats)
 {
     const string basePath = simplify(basePa);
     const string relPath = simplify(relPa);
 
-    if(!getFileInfoSeqInternal(basePath, relPath, compress, cb, infoSeq))
+    if(!getFileInfoSeqSubDirInternal(basePath, relPath, compress, cb, infoSeq, threads, stats, reuseSeq,
+                                     reuseStats))
     {
         return false;
     }
@@ -1041,7 +1468,7 @@ IcePatch2Internal::getFileInfoSeqSubDir(const string& basePa, const string& relP
 }
 
 void
-IcePatch2Internal::saveFileInfoSeq(const string& pa, const LargeFileInfoSeq& infoSeq)
+IcePatch2Internal::saveFileInfoSeq(const string& pa, const LargeFileInfoSeq& infoSeq, const FileStatDict* stats)
 {
     {
         const string path = simplify(pa + '/' + checksumFile);
@@ -1054,7 +1481,17 @@ IcePatch2Internal::saveFileInfoSeq(const string& pa, const LargeFileInfoSeq& inf
         {
             for(LargeFileInfoSeq::const_iterator p = infoSeq.begin(); p != infoSeq.end(); ++p)
             {
-                if(!writeFileInfo(fp, *p))
+                const FileStat* stat = 0;
+                if(stats)
+                {
+                    FileStatDict::const_iterator q = stats->find(p->path);
+                    if(q != stats->end())
+                    {
+                        stat = &q->second;
+                    }
+                }
+
+                if(!writeFileInfo(fp, *p, stat))
                 {
                     throw runtime_error("error writing `" + path + "':\n" + IceUtilInternal::lastErrorToString());
                 }
@@ -1082,7 +1519,7 @@ IcePatch2Internal::saveFileInfoSeq(const string& pa, const LargeFileInfoSeq& inf
 }
 
 void
-IcePatch2Internal::loadFileInfoSeq(const string& pa, LargeFileInfoSeq& infoSeq)
+IcePatch2Internal::loadFileInfoSeq(const string& pa, LargeFileInfoSeq& infoSeq, FileStatDict* stats)
 {
     {
         const string path = simplify(pa + '/' + checksumFile);
@@ -1096,9 +1533,14 @@ IcePatch2Internal::loadFileInfoSeq(const string& pa, LargeFileInfoSeq& infoSeq)
         while(true)
         {
             LargeFileInfo info;
-            if(readFileInfo(fp, info))
+            FileStat stat;
+            if(readFileInfo(fp, info, &stat))
             {
                 infoSeq.push_back(info);
+                if(stats && stat.size >= 0)
+                {
+                    (*stats)[info.path] = stat;
+                }
             }
             else
             {
@@ -1175,7 +1617,19 @@ IcePatch2Internal::loadFileInfoSeq(const string& pa, LargeFileInfoSeq& infoSeq)
 
             infoSeq.swap(newInfoSeq);
 
-            saveFileInfoSeq(pa, infoSeq);
+            if(stats)
+            {
+                for(LargeFileInfoSeq::const_iterator p = remove.begin(); p != remove.end(); ++p)
+                {
+                    stats->erase(p->path);
+                }
+                for(LargeFileInfoSeq::const_iterator p = update.begin(); p != update.end(); ++p)
+                {
+                    stats->erase(p->path);
+                }
+            }
+
+            saveFileInfoSeq(pa, infoSeq, stats);
         }
     }
 }
@@ -1236,3 +1690,241 @@ IcePatch2Internal::getFileTree0(const LargeFileInfoSeq& infoSeq, FileTree0& tree
         fill(tree0.checksum.begin(), tree0.checksum.end(), Byte(0));
     }
 }
+
+namespace
+{
+
+//
+// Chunk size limits. The average chunk size is about minChunkSize
+// plus 64KB, as a boundary is found when the 16 bits of the rolling
+// hash selected by chunkMask are all zero.
+//
+const Int minChunkSize = 16 * 1024;
+const Int maxChunkSize = 256 * 1024;
+const unsigned int chunkMask = 0xFFFF0000;
+
+//
+// The gear table of the rolling hash. The table is filled with a
+// fixed pseudo-random sequence: the server and the clients must
+// compute the same chunk boundaries.
+//
+class GearTable
+{
+public:
+
+    GearTable()
+    {
+        unsigned int x = 0x9E3779B9;
+        for(int i = 0; i < 256; ++i)
+        {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            _table[i] = x;
+        }
+    }
+
+    unsigned int
+    operator[](Byte b) const
+    {
+        return _table[b];
+    }
+
+private:
+
+    unsigned int _table[256];
+};
+
+const GearTable gearTable;
+
+bool
+readChunkInfo(FILE* fp, string& path, FileChunks& fileChunks)
+{
+    string data;
+    char buf[BUFSIZ];
+    while(fgets(buf, static_cast<int>(sizeof(buf)), fp) != 0)
+    {
+        data += buf;
+
+        size_t len = strlen(buf);
+        if(buf[len - 1] == '\n')
+        {
+            break;
+        }
+    }
+    if(data.empty())
+    {
+        return false;
+    }
+
+    istringstream is(data);
+
+    string s;
+    getline(is, s, '\t');
+    try
+    {
+        path = IceUtilInternal::unescapeString(s, 0, s.size(), "");
+    }
+    catch(const IceUtil::IllegalArgumentException& ex)
+    {
+        throw invalid_argument(ex.reason());
+    }
+
+    getline(is, s, '\t');
+    fileChunks.checksum = stringToBytes(s);
+
+    size_t count;
+    is >> count;
+
+    fileChunks.chunks.resize(count);
+    for(ChunkInfoSeq::iterator p = fileChunks.chunks.begin(); p != fileChunks.chunks.end(); ++p)
+    {
+        is >> s;
+        p->checksum = stringToBytes(s);
+        is >> p->size;
+    }
+
+    if(!is)
+    {
+        throw invalid_argument("invalid chunk information for `" + path + "'");
+    }
+
+    return true;
+}
+
+}
+
+void
+IcePatch2Internal::getChunkInfoSeq(const string& pa, ChunkInfoSeq& chunks)
+{
+    const string path = simplify(pa);
+
+    int fd = IceUtilInternal::open(path.c_str(), O_BINARY|O_RDONLY);
+    if(fd == -1)
+    {
+        throw runtime_error("cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    ChunkInfo chunk;
+    chunk.size = 0;
+    unsigned int hash = 0;
+    IceInternal::UniquePtr<IceInternal::SHA1> hasher(new IceInternal::SHA1);
+
+    ByteSeq bytes(1024 * 1024);
+    while(true)
+    {
+#if defined(_MSC_VER)
+        int r = _read(fd, &bytes[0], static_cast<unsigned int>(bytes.size()));
+#else
+        ssize_t r = read(fd, &bytes[0], bytes.size());
+#endif
+        if(r == -1)
+        {
+            IceUtilInternal::close(fd);
+            throw runtime_error("cannot read from `" + path + "':\n" + IceUtilInternal::lastErrorToString());
+        }
+        else if(r == 0)
+        {
+            break;
+        }
+
+        const Byte* start = &bytes[0];
+        const Byte* end = start + r;
+        for(const Byte* p = start; p != end; ++p)
+        {
+            hash = (hash << 1) + gearTable[*p];
+            ++chunk.size;
+
+            if(chunk.size >= maxChunkSize || (chunk.size >= minChunkSize && (hash & chunkMask) == 0))
+            {
+                hasher->update(start, static_cast<size_t>(p + 1 - start));
+                hasher->finalize(chunk.checksum);
+                chunks.push_back(chunk);
+
+                hasher.reset(new IceInternal::SHA1);
+                chunk.size = 0;
+                hash = 0;
+                start = p + 1;
+            }
+        }
+
+        if(start != end)
+        {
+            hasher->update(start, static_cast<size_t>(end - start));
+        }
+    }
+
+    IceUtilInternal::close(fd);
+
+    if(chunk.size > 0)
+    {
+        hasher->finalize(chunk.checksum);
+        chunks.push_back(chunk);
+    }
+}
+
+void
+IcePatch2Internal::saveFileChunksDict(const string& pa, const FileChunksDict& chunksDict)
+{
+    const string path = simplify(pa + '/' + chunkFile);
+    FILE* fp = IceUtilInternal::fopen(path, "w");
+    if(!fp)
+    {
+        throw runtime_error("cannot open `" + path + "' for writing:\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    for(FileChunksDict::const_iterator p = chunksDict.begin(); p != chunksDict.end(); ++p)
+    {
+        bool ok = fprintf(fp, "%s\t%s\t%lu",
+                          escapeString(p->first, "", IceUtilInternal::Compat).c_str(),
+                          bytesToString(p->second.checksum).c_str(),
+                          static_cast<unsigned long>(p->second.chunks.size())) > 0;
+
+        for(ChunkInfoSeq::const_iterator q = p->second.chunks.begin(); ok && q != p->second.chunks.end(); ++q)
+        {
+            ok = fprintf(fp, "\t%s\t%d", bytesToString(q->checksum).c_str(), q->size) > 0;
+        }
+
+        if(!ok || fputc('\n', fp) == EOF)
+        {
+            fclose(fp);
+            throw runtime_error("error writing `" + path + "':\n" + IceUtilInternal::lastErrorToString());
+        }
+    }
+
+    fclose(fp);
+}
+
+bool
+IcePatch2Internal::loadFileChunksDict(const string& pa, FileChunksDict& chunksDict)
+{
+    const string path = simplify(pa + '/' + chunkFile);
+
+    FILE* fp = IceUtilInternal::fopen(path, "r");
+    if(!fp)
+    {
+        if(errno == ENOENT)
+        {
+            return false;
+        }
+        throw runtime_error("cannot open `" + path + "' for reading:\n" + IceUtilInternal::lastErrorToString());
+    }
+
+    try
+    {
+        string filePath;
+        FileChunks fileChunks;
+        while(readChunkInfo(fp, filePath, fileChunks))
+        {
+            chunksDict[filePath] = fileChunks;
+        }
+    }
+    catch(...)
+    {
+        fclose(fp);
+        throw;
+    }
+
+    fclose(fp);
+    return true;
+}
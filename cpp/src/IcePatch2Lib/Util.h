@@ -14,6 +14,7 @@ namespace IcePatch2Internal
 
 ICEPATCH2_API extern const char* checksumFile;
 ICEPATCH2_API extern const char* logFile;
+ICEPATCH2_API extern const char* chunkFile;
 
 ICEPATCH2_API std::string lastError();
 
@@ -158,20 +159,44 @@ public:
     virtual bool compress(const std::string&) = 0;
 };
 
-ICEPATCH2_API bool getFileInfoSeq(const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&);
+//
+// The size and modification time of a file when its checksum was
+// computed. They are saved with the checksums, an incremental
+// computation only reuses the checksum of a file whose size and
+// modification time didn't change.
+//
+struct FileStat
+{
+    Ice::Long size;
+    Ice::Long time;
+};
+typedef std::map<std::string, FileStat> FileStatDict;
 
-ICEPATCH2_API bool getFileInfoSeqSubDir(const std::string&, const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&);
+//
+// The file infos are computed by the given number of threads. The
+// optional file stat dictionary is filled with the size and the
+// modification time of the files. The checksums of the optional
+// previous file info sequence are reused for the files whose size and
+// modification time match the previous file stat dictionary.
+//
+ICEPATCH2_API bool getFileInfoSeq(const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&,
+                                  int = 1, FileStatDict* = 0, const IcePatch2::LargeFileInfoSeq* = 0,
+                                  const FileStatDict* = 0);
+
+ICEPATCH2_API bool getFileInfoSeqSubDir(const std::string&, const std::string&, int, GetFileInfoSeqCB*, IcePatch2::LargeFileInfoSeq&,
+                                        int = 1, FileStatDict* = 0, const IcePatch2::LargeFileInfoSeq* = 0,
+                                        const FileStatDict* = 0);
 
-ICEPATCH2_API void saveFileInfoSeq(const std::string&, const IcePatch2::LargeFileInfoSeq&);
+ICEPATCH2_API void saveFileInfoSeq(const std::string&, const IcePatch2::LargeFileInfoSeq&, const FileStatDict* = 0);
 
-ICEPATCH2_API void loadFileInfoSeq(const std::string&, IcePatch2::LargeFileInfoSeq&);
+ICEPATCH2_API void loadFileInfoSeq(const std::string&, IcePatch2::LargeFileInfoSeq&, FileStatDict* = 0);
 
-ICEPATCH2_API bool readFileInfo(FILE*, IcePatch2::LargeFileInfo&);
+ICEPATCH2_API bool readFileInfo(FILE*, IcePatch2::LargeFileInfo&, FileStat* = 0);
 
 ICEPATCH2_API IcePatch2::FileInfo toFileInfo(const IcePatch2::LargeFileInfo&);
 ICEPATCH2_API IcePatch2::LargeFileInfo toLargeFileInfo(const IcePatch2::FileInfo&);
 
-ICEPATCH2_API bool writeFileInfo(FILE*, const IcePatch2::LargeFileInfo&);
+ICEPATCH2_API bool writeFileInfo(FILE*, const IcePatch2::LargeFileInfo&, const FileStat* = 0);
 
 struct FileTree1
 {
@@ -189,6 +214,26 @@ struct FileTree0
 
 ICEPATCH2_API void getFileTree0(const IcePatch2::LargeFileInfoSeq&, FileTree0&);
 
+//
+// The chunks of a file, along with the checksum of the file contents
+// the chunks were computed for. Chunk boundaries are computed with a
+// rolling hash over the file contents, so that a change only affects
+// the chunks around it.
+//
+struct FileChunks
+{
+    Ice::ByteSeq checksum;
+    IcePatch2::ChunkInfoSeq chunks;
+};
+
+typedef std::map<std::string, FileChunks> FileChunksDict;
+
+ICEPATCH2_API void getChunkInfoSeq(const std::string&, IcePatch2::ChunkInfoSeq&);
+
+ICEPATCH2_API void saveFileChunksDict(const std::string&, const FileChunksDict&);
+
+ICEPATCH2_API bool loadFileChunksDict(const std::string&, FileChunksDict&);
+
 }
 
 #endif
@@ -0,0 +1,377 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <IceStorm/EventFilter.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <sstream>
+
+using namespace std;
+using namespace IceStorm;
+
+IceStorm::EventFilter::EventFilter(const string& filter) :
+    _filter(filter),
+    _pos(0),
+    _nesting(0)
+{
+    if(_filter.size() > maxFilterSize)
+    {
+        ostringstream os;
+        os << "invalid filter: the filter is longer than " << maxFilterSize << " characters";
+        throw BadQoS(os.str());
+    }
+
+    _root = parseOr();
+    skipWhitespace();
+    if(_pos != _filter.size())
+    {
+        error("unexpected `" + _filter.substr(_pos) + "'");
+    }
+}
+
+bool
+IceStorm::EventFilter::match(const EventDataPtr& event) const
+{
+    return match(_root, event);
+}
+
+bool
+IceStorm::EventFilter::indexTerms(vector<Term>& terms) const
+{
+    terms.clear();
+    return indexTerms(_root, terms);
+}
+
+int
+IceStorm::EventFilter::parseOr()
+{
+    //
+    // A chain of || is a single node, only the nesting of negations
+    // and parentheses adds levels to the expression tree.
+    //
+    int first = parseAnd();
+    if(!accept("||"))
+    {
+        return first;
+    }
+
+    Node node;
+    node.kind = Or;
+    node.left = -1;
+    node.right = -1;
+    node.children.push_back(first);
+    do
+    {
+        node.children.push_back(parseAnd());
+    }
+    while(accept("||"));
+    return add(node);
+}
+
+int
+IceStorm::EventFilter::parseAnd()
+{
+    int first = parseUnary();
+    if(!accept("&&"))
+    {
+        return first;
+    }
+
+    Node node;
+    node.kind = And;
+    node.left = -1;
+    node.right = -1;
+    node.children.push_back(first);
+    do
+    {
+        node.children.push_back(parseUnary());
+    }
+    while(accept("&&"));
+    return add(node);
+}
+
+int
+IceStorm::EventFilter::parseUnary()
+{
+    if(accept("!"))
+    {
+        Node node;
+        node.kind = Not;
+        node.left = parseNested(false);
+        node.right = -1;
+        return add(node);
+    }
+    else if(accept("("))
+    {
+        int expr = parseNested(true);
+        if(!accept(")"))
+        {
+            error("missing `)'");
+        }
+        return expr;
+    }
+    return parseTerm();
+}
+
+int
+IceStorm::EventFilter::parseNested(bool expression)
+{
+    //
+    // The expression tree can't be deeper than the nesting of the
+    // negations and parentheses, this limits the recursion of the
+    // parser and of the matching.
+    //
+    if(++_nesting > maxFilterDepth)
+    {
+        error("the filter is nested too deeply");
+    }
+    int n = expression ? parseOr() : parseUnary();
+    --_nesting;
+    return n;
+}
+
+int
+IceStorm::EventFilter::parseTerm()
+{
+    Node node;
+    node.left = -1;
+    node.right = -1;
+
+    string identifier;
+    if(!parseIdentifier(identifier))
+    {
+        error("`operation' or `context' expected");
+    }
+
+    if(identifier == "operation")
+    {
+        node.operation = true;
+    }
+    else if(identifier == "context")
+    {
+        node.operation = false;
+        if(!accept("[") || !parseString(node.key) || !accept("]"))
+        {
+            error("context key expected, for example `context['key']'");
+        }
+    }
+    else
+    {
+        error("unknown identifier `" + identifier + "'");
+    }
+
+    if(accept("=="))
+    {
+        node.kind = Equal;
+    }
+    else if(accept("!="))
+    {
+        node.kind = NotEqual;
+    }
+    else if(!node.operation)
+    {
+        node.kind = Exists;
+        return add(node);
+    }
+    else
+    {
+        error("`==' or `!=' expected after `operation'");
+    }
+
+    if(!parseString(node.value))
+    {
+        error("string expected");
+    }
+    return add(node);
+}
+
+bool
+IceStorm::EventFilter::parseString(string& value)
+{
+    skipWhitespace();
+    if(_pos == _filter.size() || (_filter[_pos] != '\'' && _filter[_pos] != '"'))
+    {
+        return false;
+    }
+
+    char quote = _filter[_pos++];
+    value.clear();
+    while(_pos < _filter.size() && _filter[_pos] != quote)
+    {
+        if(_filter[_pos] == '\\' && _pos + 1 < _filter.size())
+        {
+            ++_pos;
+        }
+        value += _filter[_pos++];
+    }
+    if(_pos == _filter.size())
+    {
+        error("unterminated string");
+    }
+    ++_pos;
+    return true;
+}
+
+bool
+IceStorm::EventFilter::parseIdentifier(string& identifier)
+{
+    skipWhitespace();
+    string::size_type start = _pos;
+    while(_pos < _filter.size() && (isalnum(static_cast<unsigned char>(_filter[_pos])) || _filter[_pos] == '_'))
+    {
+        ++_pos;
+    }
+    identifier = _filter.substr(start, _pos - start);
+    return !identifier.empty();
+}
+
+bool
+IceStorm::EventFilter::accept(const char* token)
+{
+    skipWhitespace();
+    string::size_type len = strlen(token);
+    if(_filter.compare(_pos, len, token) != 0)
+    {
+        return false;
+    }
+
+    //
+    // Don't mistake the "!=" operator for a negation.
+    //
+    if(len == 1 && token[0] == '!' && _pos + 1 < _filter.size() && _filter[_pos + 1] == '=')
+    {
+        return false;
+    }
+    _pos += len;
+    return true;
+}
+
+void
+IceStorm::EventFilter::skipWhitespace()
+{
+    while(_pos < _filter.size() && isspace(static_cast<unsigned char>(_filter[_pos])))
+    {
+        ++_pos;
+    }
+}
+
+int
+IceStorm::EventFilter::add(const Node& node)
+{
+    _nodes.push_back(node);
+    return static_cast<int>(_nodes.size()) - 1;
+}
+
+void
+IceStorm::EventFilter::error(const string& reason) const
+{
+    ostringstream os;
+    os << "invalid filter `" << _filter << "': " << reason << " at position " << _pos;
+    throw BadQoS(os.str());
+}
+
+bool
+IceStorm::EventFilter::match(int n, const EventDataPtr& event) const
+{
+    const Node& node = _nodes[n];
+    switch(node.kind)
+    {
+    case Or:
+    {
+        for(vector<int>::const_iterator p = node.children.begin(); p != node.children.end(); ++p)
+        {
+            if(match(*p, event))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    case And:
+    {
+        for(vector<int>::const_iterator p = node.children.begin(); p != node.children.end(); ++p)
+        {
+            if(!match(*p, event))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    case Not:
+        return !match(node.left, event);
+    case Exists:
+        return event->context.find(node.key) != event->context.end();
+    case Equal:
+    case NotEqual:
+    {
+        bool equal;
+        if(node.operation)
+        {
+            equal = event->op == node.value;
+        }
+        else
+        {
+            Ice::Context::const_iterator p = event->context.find(node.key);
+            equal = p != event->context.end() && p->second == node.value;
+        }
+        return node.kind == Equal ? equal : !equal;
+    }
+    default:
+        assert(false);
+        return false;
+    }
+}
+
+bool
+IceStorm::EventFilter::indexTerms(int n, vector<Term>& terms) const
+{
+    const Node& node = _nodes[n];
+    switch(node.kind)
+    {
+    case Equal:
+    {
+        Term term;
+        term.operation = node.operation;
+        term.key = node.key;
+        term.value = node.value;
+        terms.push_back(term);
+        return true;
+    }
+    case And:
+    {
+        //
+        // Any operand is enough, use the one with the fewest terms.
+        //
+        bool indexed = false;
+        vector<Term> best;
+        for(vector<int>::const_iterator p = node.children.begin(); p != node.children.end(); ++p)
+        {
+            vector<Term> operand;
+            if(indexTerms(*p, operand) && (!indexed || operand.size() < best.size()))
+            {
+                indexed = true;
+                best.swap(operand);
+            }
+        }
+        terms.insert(terms.end(), best.begin(), best.end());
+        return indexed;
+    }
+    case Or:
+    {
+        for(vector<int>::const_iterator p = node.children.begin(); p != node.children.end(); ++p)
+        {
+            if(!indexTerms(*p, terms))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
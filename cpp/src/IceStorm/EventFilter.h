@@ -0,0 +1,117 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef EVENT_FILTER_H
+#define EVENT_FILTER_H
+
+#include <IceStorm/IceStormInternal.h>
+
+namespace IceStorm
+{
+
+//
+// A compiled "filter" QoS. The filter is a predicate over the operation
+// name and the context of an event, for example:
+//
+//   operation == 'tick' && (context['symbol'] == "ZRC" || !context['test'])
+//
+// The terms of a filter are "operation == <string>", "operation !=
+// <string>", "context[<string>] == <string>", "context[<string>] !=
+// <string>" and "context[<string>]" which is true if the context contains
+// the given key. Terms are combined with "!", "&&", "||" and parentheses.
+// Strings are enclosed in single or double quotes, a backslash escapes
+// the next character.
+//
+// A filter is limited to maxFilterSize characters and its nesting of
+// negations and parentheses to maxFilterDepth levels, the parser and
+// the matching of events are recursive. A chain of "&&" or "||" is a
+// single node of the expression tree.
+//
+class EventFilter : public IceUtil::Shared
+{
+public:
+
+    //
+    // An equality term of the filter. If operation is true, key is
+    // empty and value is the operation name.
+    //
+    struct Term
+    {
+        bool operation;
+        std::string key;
+        std::string value;
+    };
+
+    static const std::string::size_type maxFilterSize = 4096;
+    static const int maxFilterDepth = 64;
+
+    //
+    // Raises BadQoS if the filter can't be parsed or exceeds the limits.
+    //
+    EventFilter(const std::string&);
+
+    bool match(const EventDataPtr&) const;
+
+    //
+    // Returns false if the filter can match an event that doesn't
+    // satisfy any of the equality terms of the filter. Otherwise, the
+    // given terms are the equality terms, one of which is satisfied by
+    // every matching event.
+    //
+    bool indexTerms(std::vector<Term>&) const;
+
+    const std::string& filter() const
+    {
+        return _filter;
+    }
+
+private:
+
+    enum Kind
+    {
+        Or,
+        And,
+        Not,
+        Equal,
+        NotEqual,
+        Exists
+    };
+
+    struct Node
+    {
+        Kind kind;
+        int left;
+        int right;
+        std::vector<int> children;
+        bool operation;
+        std::string key;
+        std::string value;
+    };
+
+    int parseOr();
+    int parseAnd();
+    int parseUnary();
+    int parseNested(bool);
+    int parseTerm();
+    bool parseString(std::string&);
+    bool parseIdentifier(std::string&);
+    bool accept(const char*);
+    void skipWhitespace();
+    int add(const Node&);
+    void error(const std::string&) const;
+
+    bool match(int, const EventDataPtr&) const;
+    bool indexTerms(int, std::vector<Term>&) const;
+
+    const std::string _filter;
+    std::string::size_type _pos;
+    int _nesting;
+    std::vector<Node> _nodes;
+    int _root;
+};
+typedef IceUtil::Handle<EventFilter> EventFilterPtr;
+
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include <IceStorm/Observers.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/InstrumentationI.h>
+#include <IceStorm/Shard.h>
 #include <IceUtil/Timer.h>
 
 #include <Ice/InstrumentationI.h>
@@ -50,11 +51,31 @@ PersistentInstance::PersistentInstance(
     const NodePrx& nodeProxy) :
     Instance(instanceName, name, communicator, publishAdapter, topicAdapter, nodeAdapter, nodeProxy),
     _dbLock(communicator->getProperties()->getPropertyWithDefault(name + ".LMDB.Path", name) + "/icedb.lock"),
-    _dbEnv(communicator->getProperties()->getPropertyWithDefault(name + ".LMDB.Path", name), 2,
-           IceDB::getMapSize(communicator->getProperties()->getPropertyAsInt(name + ".LMDB.MapSize")))
+    _dbEnv(communicator->getProperties()->getPropertyWithDefault(name + ".LMDB.Path", name), 3,
+           IceDB::getMapSize(communicator->getProperties()->getPropertyAsInt(name + ".LMDB.MapSize")), 0,
+           IceDB::getSyncFlags(communicator->getProperties()->getProperty(name + ".LMDB.SyncMode"))),
+    _spillPath(communicator->getProperties()->getProperty(name + ".Send.SpillPath")),
+    // default 100MB.
+    _spillSizeMax(static_cast<Ice::Long>(communicator->getProperties()->getPropertyAsIntWithDefault(
+                                             name + ".Send.SpillSizeMax", 100 * 1024)) * 1024),
+    _spillAgeMax(IceUtil::Time::seconds(communicator->getProperties()->getPropertyAsInt(name + ".Send.SpillAgeMax"))),
+    // default 1MB.
+    _spillSegmentSize(static_cast<Ice::Long>(communicator->getProperties()->getPropertyAsIntWithDefault(
+                                                 name + ".Send.SpillSegmentSize", 1024)) * 1024),
+    _logSize(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Election.LogSize", 10000)),
+    // default 1000 subscribers, well below the default Ice.MessageSizeMax.
+    _syncChunkSize(max(communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Election.SyncChunkSize",
+                                                                                    1000), 1))
 {
     try
     {
+        if(!_spillPath.empty() && !IceUtilInternal::directoryExists(_spillPath))
+        {
+            ostringstream os;
+            os << "property `" << name << ".Send.SpillPath' is set to an invalid path: `" << _spillPath << "'";
+            throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, os.str());
+        }
+
         dbContext.communicator = communicator;
         dbContext.encoding.minor = 1;
         dbContext.encoding.major = 1;
@@ -63,6 +84,7 @@ PersistentInstance::PersistentInstance(
 
         _lluMap = LLUMap(txn, "llu", dbContext, MDB_CREATE);
         _subscriberMap = SubscriberMap(txn, "subscribers", dbContext, MDB_CREATE, compareSubscriberRecordKey);
+        _logMap = LogMap(txn, "log", dbContext, MDB_CREATE, compareLogUpdate);
 
         txn.commit();
     }
@@ -132,6 +154,12 @@ Instance::Instance(
         _batchFlusher = new IceUtil::Timer();
         _timer = new IceUtil::Timer();
 
+        int shards = properties->getPropertyAsInt(name + ".Shards");
+        for(int i = 0; i < shards; ++i)
+        {
+            _shards.push_back(new Shard(this, i));
+        }
+
         string policy = properties->getProperty(name + ".Send.QueueSizeMaxPolicy");
         if(policy == "RemoveSubscriber")
         {
@@ -253,6 +281,47 @@ Instance::timer() const
     return _timer;
 }
 
+ShardPtr
+Instance::shard(const string& topic) const
+{
+    if(_shards.empty())
+    {
+        return 0;
+    }
+
+    //
+    // FNV-1a hash of the topic name.
+    //
+    unsigned int hash = 2166136261U;
+    for(string::const_iterator p = topic.begin(); p != topic.end(); ++p)
+    {
+        hash ^= static_cast<unsigned char>(*p);
+        hash *= 16777619U;
+    }
+    return _shards[hash % _shards.size()];
+}
+
+Ice::ObjectAdapterPtr
+Instance::publishAdapter(const string& topic) const
+{
+    ShardPtr s = shard(topic);
+    return s ? s->publishAdapter() : _publishAdapter;
+}
+
+IceUtil::TimerPtr
+Instance::batchFlusher(const string& topic) const
+{
+    ShardPtr s = shard(topic);
+    return s ? s->batchFlusher() : _batchFlusher;
+}
+
+IceUtil::TimerPtr
+Instance::timer(const string& topic) const
+{
+    ShardPtr s = shard(topic);
+    return s ? s->timer() : _timer;
+}
+
 Ice::ObjectPrx
 Instance::topicReplicaProxy() const
 {
@@ -318,6 +387,10 @@ Instance::shutdown()
     }
 
     _topicAdapter->destroy();
+    for(vector<ShardPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        (*p)->shutdown();
+    }
     _publishAdapter->destroy();
 
     if(_timer)
@@ -334,6 +407,13 @@ Instance::destroy()
         _batchFlusher->destroy();
     }
 
+    // The shards hold the instance.
+    for(vector<ShardPtr>::const_iterator p = _shards.begin(); p != _shards.end(); ++p)
+    {
+        (*p)->destroy();
+    }
+    _shards.clear();
+
     // The node instance must be cleared as the node holds the
     // replica (TopicManager) which holds the instance causing a
     // cyclic reference.
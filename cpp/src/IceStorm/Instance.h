@@ -38,6 +38,9 @@ namespace IceStorm
 class TraceLevels;
 typedef IceUtil::Handle<TraceLevels> TraceLevelsPtr;
 
+class Shard;
+typedef IceUtil::Handle<Shard> ShardPtr;
+
 class TopicReaper : public IceUtil::Shared, private IceUtil::Mutex
 {
 public:
@@ -79,6 +82,16 @@ public:
     TraceLevelsPtr traceLevels() const;
     IceUtil::TimerPtr batchFlusher() const;
     IceUtil::TimerPtr timer() const;
+
+    //
+    // The shard of the given topic, null if the topics aren't sharded,
+    // and the publish adapter and timers used by the topic.
+    //
+    ShardPtr shard(const std::string&) const;
+    Ice::ObjectAdapterPtr publishAdapter(const std::string&) const;
+    IceUtil::TimerPtr batchFlusher(const std::string&) const;
+    IceUtil::TimerPtr timer(const std::string&) const;
+
     Ice::ObjectPrx topicReplicaProxy() const;
     Ice::ObjectPrx publisherReplicaProxy() const;
     IceStorm::Instrumentation::TopicManagerObserverPtr observer() const;
@@ -116,12 +129,16 @@ private:
     IceUtil::TimerPtr _batchFlusher;
     IceUtil::TimerPtr _timer;
     IceStorm::Instrumentation::TopicManagerObserverPtr _observer;
-
+    std::vector<ShardPtr> _shards;
 };
 typedef IceUtil::Handle<Instance> InstancePtr;
 
 typedef IceDB::ReadWriteCursor<SubscriberRecordKey, SubscriberRecord, IceDB::IceContext, Ice::OutputStream>
         SubscriberMapRWCursor;
+typedef IceDB::Cursor<IceStormElection::LogUpdate, IceStormElection::LogRecord, IceDB::IceContext, Ice::OutputStream>
+        LogMapCursor;
+typedef IceDB::ReadWriteCursor<IceStormElection::LogUpdate, IceStormElection::LogRecord, IceDB::IceContext,
+                               Ice::OutputStream> LogMapRWCursor;
 
 class PersistentInstance : public Instance
 {
@@ -134,6 +151,14 @@ public:
     const IceDB::Env& dbEnv() const { return _dbEnv; }
     LLUMap lluMap() const { return _lluMap; }
     SubscriberMap subscriberMap() const { return _subscriberMap; }
+    LogMap logMap() const { return _logMap; }
+    int logSize() const { return _logSize; }
+    int syncChunkSize() const { return _syncChunkSize; }
+
+    const std::string& spillPath() const { return _spillPath; }
+    Ice::Long spillSizeMax() const { return _spillSizeMax; }
+    IceUtil::Time spillAgeMax() const { return _spillAgeMax; }
+    Ice::Long spillSegmentSize() const { return _spillSegmentSize; }
 
     virtual void destroy();
 
@@ -143,6 +168,13 @@ private:
     IceDB::Env _dbEnv;
     LLUMap _lluMap;
     SubscriberMap _subscriberMap;
+    LogMap _logMap;
+    const std::string _spillPath;
+    const Ice::Long _spillSizeMax;
+    const IceUtil::Time _spillAgeMax;
+    const Ice::Long _spillSegmentSize;
+    const int _logSize;
+    const int _syncChunkSize;
 };
 typedef IceUtil::Handle<PersistentInstance> PersistentInstancePtr;
 
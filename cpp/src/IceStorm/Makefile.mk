@@ -12,11 +12,14 @@ IceStormService_targetdir       := $(libdir)
 IceStormService_dependencies    := IceGrid Glacier2 IceBox IceDB
 IceStormService_cppflags        := $(if $(lmdb_includedir),-I$(lmdb_includedir))
 IceStormService_devinstall      := no
-IceStormService_sources         := $(addprefix $(currentdir)/,Instance.cpp \
+IceStormService_sources         := $(addprefix $(currentdir)/,EventFilter.cpp \
+                                                             Instance.cpp \
                                                              InstrumentationI.cpp \
                                                              NodeI.cpp \
                                                              Observers.cpp \
                                                              Service.cpp \
+                                                             Shard.cpp \
+                                                             SpillQueue.cpp \
                                                              Subscriber.cpp \
                                                              TopicI.cpp \
                                                              TopicManagerI.cpp \
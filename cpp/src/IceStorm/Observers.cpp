@@ -73,7 +73,8 @@ Observers::getReapedSlaves(std::vector<int>& d)
 }
 
 void
-Observers::init(const set<GroupNodeInfo>& slaves, const LogUpdate& llu, const TopicContentSeq& content)
+Observers::init(const set<GroupNodeInfo>& slaves, const LogUpdate& llu, const TopicContentSeq& content,
+                const map<int, LogRecordSeq>& updates)
 {
     {
         IceUtil::Mutex::Lock sync(_reapedMutex);
@@ -93,7 +94,26 @@ Observers::init(const set<GroupNodeInfo>& slaves, const LogUpdate& llu, const To
 
             ReplicaObserverPrx observer = ReplicaObserverPrx::uncheckedCast(p->observer);
 
-            Ice::AsyncResultPtr result = observer->begin_init(llu, content);
+            Ice::AsyncResultPtr result;
+            map<int, LogRecordSeq>::const_iterator q = updates.find(p->id);
+            if(q != updates.end())
+            {
+                if(_traceLevels->replication > 0)
+                {
+                    Ice::Trace out(_traceLevels->logger, _traceLevels->replicationCat);
+                    out << "init " << p->id << " with " << q->second.size() << " updates";
+                }
+                result = observer->begin_initUpdates(llu, q->second);
+            }
+            else
+            {
+                if(_traceLevels->replication > 0)
+                {
+                    Ice::Trace out(_traceLevels->logger, _traceLevels->replicationCat);
+                    out << "init " << p->id << " with " << content.size() << " topics";
+                }
+                result = observer->begin_init(llu, content);
+            }
             observers.push_back(ObserverInfo(p->id, observer, result));
         }
         catch(const Ice::Exception& ex)
@@ -111,7 +131,31 @@ Observers::init(const set<GroupNodeInfo>& slaves, const LogUpdate& llu, const To
     {
         try
         {
-            p->observer->end_init(p->result);
+            if(p->result->getOperation() == "initUpdates")
+            {
+                try
+                {
+                    p->observer->end_initUpdates(p->result);
+                }
+                catch(const Ice::OperationNotExistException&)
+                {
+                    // The slave doesn't support incremental updates.
+                    p->observer->init(llu, content);
+                }
+                catch(const ObserverInconsistencyException& ex)
+                {
+                    if(_traceLevels->replication > 0)
+                    {
+                        Ice::Trace out(_traceLevels->logger, _traceLevels->replicationCat);
+                        out << "initUpdates on " << p->id << " failed: " << ex.reason << ", sending the content";
+                    }
+                    p->observer->init(llu, content);
+                }
+            }
+            else
+            {
+                p->observer->end_init(p->result);
+            }
             p->result = 0;
         }
         catch(const Ice::Exception& ex)
@@ -36,7 +36,13 @@ public:
     bool check();
     void clear();
 
-    void init(const std::set<IceStormElection::GroupNodeInfo>&, const LogUpdate&, const TopicContentSeq&);
+    //
+    // Initialize the given slaves. The slaves with an entry in the given
+    // map only receive the updates which followed their llu, the other
+    // slaves receive the topic content.
+    //
+    void init(const std::set<IceStormElection::GroupNodeInfo>&, const LogUpdate&, const TopicContentSeq&,
+              const std::map<int, LogRecordSeq>&);
     void createTopic(const LogUpdate&, const std::string&);
     void destroyTopic(const LogUpdate&, const std::string&);
     void addSubscriber(const LogUpdate&, const std::string&, const IceStorm::SubscriberRecord&);
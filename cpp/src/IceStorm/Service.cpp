@@ -477,6 +477,8 @@ ServiceI::validateProperties(const string& name, const PropertiesPtr& properties
         "Election.MasterTimeout",
         "Election.ElectionTimeout",
         "Election.ResponseTimeout",
+        "Election.LogSize",
+        "Election.SyncChunkSize",
         "Publish.AdapterId",
         "Publish.Endpoints",
         "Publish.Locator",
@@ -487,6 +489,11 @@ ServiceI::validateProperties(const string& name, const PropertiesPtr& properties
         "Publish.ThreadPool.SizeMax",
         "Publish.ThreadPool.SizeWarn",
         "Publish.ThreadPool.StackSize",
+        "Shards",
+        "Shard*.Publish.Endpoints",
+        "Shard*.Publish.PublishedEndpoints",
+        "Shard*.Publish.ThreadPool.Size",
+        "Shard*.Publish.ThreadPool.SizeMax",
         "Node.AdapterId",
         "Node.Endpoints",
         "Node.Locator",
@@ -523,9 +530,14 @@ ServiceI::validateProperties(const string& name, const PropertiesPtr& properties
         "Send.Timeout",
         "Send.QueueSizeMax",
         "Send.QueueSizeMaxPolicy",
+        "Send.SpillPath",
+        "Send.SpillSizeMax",
+        "Send.SpillAgeMax",
+        "Send.SpillSegmentSize",
         "Discard.Interval",
         "LMDB.Path",
-        "LMDB.MapSize"
+        "LMDB.MapSize",
+        "LMDB.SyncMode"
     };
 
     vector<string> unknownProps;
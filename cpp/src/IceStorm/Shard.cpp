@@ -0,0 +1,257 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <IceStorm/Shard.h>
+#include <IceStorm/Instance.h>
+#include <IceStorm/TopicI.h>
+#include <IceStorm/NodeI.h>
+#include <Ice/Ice.h>
+
+using namespace std;
+using namespace IceStorm;
+using namespace IceStormElection;
+
+namespace
+{
+
+//
+// Returns true if the given endpoints set a port with -p. The endpoints
+// of the main publish adapter can only be reused by a shard adapter if
+// all their ports are system-assigned (-p 0 or no -p).
+//
+bool
+hasFixedPort(const string& endpoints)
+{
+    bool port = false; // Whether the previous token is -p.
+    string::size_type pos = 0;
+    while(pos < endpoints.size())
+    {
+        if(endpoints[pos] == ':' || isspace(static_cast<unsigned char>(endpoints[pos])))
+        {
+            port = port && endpoints[pos] != ':';
+            ++pos;
+            continue;
+        }
+
+        string::size_type end = pos;
+        char quote = '\0';
+        while(end < endpoints.size() &&
+              (quote != '\0' || (endpoints[end] != ':' && !isspace(static_cast<unsigned char>(endpoints[end])))))
+        {
+            if(quote == '\0' && (endpoints[end] == '"' || endpoints[end] == '\''))
+            {
+                quote = endpoints[end];
+            }
+            else if(quote != '\0' && endpoints[end] == quote)
+            {
+                quote = '\0';
+            }
+            ++end;
+        }
+
+        string token = endpoints.substr(pos, end - pos);
+        if(port)
+        {
+            istringstream is(token);
+            int number;
+            if(!(is >> number) || !is.eof() || number != 0)
+            {
+                return true;
+            }
+        }
+        port = token == "-p";
+        pos = end;
+    }
+    return false;
+}
+
+}
+
+IceStorm::Shard::Shard(const InstancePtr& instance, int id) :
+    _instance(instance),
+    _ownAdapter(false),
+    _delivering(false)
+{
+    Ice::PropertiesPtr properties = instance->properties();
+    Ice::ObjectAdapterPtr publishAdapter = instance->publishAdapter();
+
+    //
+    // Publishers using IceGrid or the replicated publish endpoints can
+    // only reach the main publish adapter, the shard topics are
+    // registered with this adapter in this case.
+    //
+    if(!properties->getProperty(publishAdapter->getName() + ".AdapterId").empty() ||
+       instance->publisherReplicaProxy())
+    {
+        _publishAdapter = publishAdapter;
+    }
+    else
+    {
+        ostringstream os;
+        os << instance->serviceName() << ".Shard" << id << ".Publish";
+        string name = os.str();
+
+        if(properties->getProperty(name + ".ThreadPool.Size").empty())
+        {
+            properties->setProperty(name + ".ThreadPool.Size", "1");
+        }
+        if(properties->getProperty(name + ".ThreadPool.SizeMax").empty())
+        {
+            properties->setProperty(name + ".ThreadPool.SizeMax", "4");
+        }
+
+        //
+        // The shard adapter uses the endpoints of the main publish
+        // adapter unless its endpoints are set. A fixed port can't be
+        // shared, the shard endpoints must be set explicitly in this case.
+        //
+        const string suffixes[] = { ".Endpoints", ".PublishedEndpoints" };
+        for(size_t i = 0; i < sizeof(suffixes) / sizeof(*suffixes); ++i)
+        {
+            string endpoints = properties->getProperty(publishAdapter->getName() + suffixes[i]);
+            if(!endpoints.empty() && properties->getProperty(name + suffixes[i]).empty())
+            {
+                if(hasFixedPort(endpoints))
+                {
+                    ostringstream msg;
+                    msg << "property `" << name << suffixes[i] << "' must be set, the endpoints of `"
+                        << publishAdapter->getName() << suffixes[i] << "' use a fixed port";
+                    throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, msg.str());
+                }
+                properties->setProperty(name + suffixes[i], endpoints);
+            }
+        }
+        _publishAdapter = instance->communicator()->createObjectAdapter(name);
+        _ownAdapter = true;
+        _publishAdapter->activate();
+    }
+
+    _batchFlusher = new IceUtil::Timer();
+    _timer = new IceUtil::Timer();
+}
+
+IceStorm::Shard::Publish::Publish(const TopicImplPtr& t, bool f, const EventDataSeq& e) :
+    topic(t),
+    forwarded(f),
+    events(e),
+    delivered(false)
+{
+}
+
+void
+IceStorm::Shard::publish(const TopicImplPtr& topic, bool forwarded, const EventDataSeq& events)
+{
+    PublishPtr publish = new Publish(topic, forwarded, events);
+
+    Lock sync(*this);
+    _queue.push_back(publish);
+
+    //
+    // The events are delivered with the events queued by other threads
+    // in the meantime. The thread which delivers a batch of events
+    // stops once its own events are delivered and another waiting
+    // thread delivers the next batch, a thread is never kept delivering
+    // the events of other threads.
+    //
+    while(!publish->delivered)
+    {
+        if(_delivering)
+        {
+            wait();
+            continue;
+        }
+
+        _delivering = true;
+        deque<PublishPtr> batch;
+        batch.swap(_queue);
+
+        sync.release();
+        deliver(batch);
+        sync.acquire();
+
+        for(deque<PublishPtr>::const_iterator p = batch.begin(); p != batch.end(); ++p)
+        {
+            (*p)->delivered = true;
+        }
+        _delivering = false;
+        notifyAll();
+    }
+
+    if(publish->exception.get())
+    {
+        publish->exception->ice_throw();
+    }
+}
+
+void
+IceStorm::Shard::shutdown()
+{
+    if(_ownAdapter)
+    {
+        _publishAdapter->destroy();
+    }
+    _timer->destroy();
+}
+
+void
+IceStorm::Shard::destroy()
+{
+    _batchFlusher->destroy();
+}
+
+void
+IceStorm::Shard::deliver(const deque<PublishPtr>& batch)
+{
+    //
+    // The events of each publisher are either queued with the topic
+    // subscribers or the publisher gets the exception which prevented
+    // it, the batch is always completed.
+    //
+    vector<pair<TopicImplPtr, Ice::IdentitySeq> > reap;
+    Ice::ObjectPrx master;
+    Ice::Long generation = -1;
+    deque<PublishPtr>::const_iterator p = batch.begin();
+    try
+    {
+        // Use cached reads.
+        CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
+        for(; p != batch.end(); ++p)
+        {
+            try
+            {
+                Ice::IdentitySeq ids;
+                if((*p)->topic->queue((*p)->forwarded, (*p)->events, unlock.getMaster(), ids))
+                {
+                    reap.push_back(make_pair((*p)->topic, ids));
+                }
+            }
+            catch(const Ice::Exception& ex)
+            {
+                (*p)->exception.reset(ex.ice_clone());
+            }
+            catch(const std::exception& ex)
+            {
+                (*p)->exception.reset(new Ice::UnknownException(__FILE__, __LINE__, ex.what()));
+            }
+        }
+        master = unlock.getMaster();
+        if(master)
+        {
+            generation = unlock.generation();
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        for(; p != batch.end(); ++p)
+        {
+            (*p)->exception.reset(ex.ice_clone());
+        }
+        return;
+    }
+
+    for(vector<pair<TopicImplPtr, Ice::IdentitySeq> >::const_iterator q = reap.begin(); q != reap.end(); ++q)
+    {
+        q->first->reapOnMaster(master, generation, q->second);
+    }
+}
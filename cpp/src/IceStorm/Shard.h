@@ -0,0 +1,97 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef SHARD_H
+#define SHARD_H
+
+#include <IceStorm/IceStormInternal.h>
+#include <IceUtil/Timer.h>
+#include <IceUtil/Monitor.h>
+#include <Ice/UniquePtr.h>
+#include <deque>
+
+namespace IceStorm
+{
+
+class Instance;
+typedef IceUtil::Handle<Instance> InstancePtr;
+
+class TopicImpl;
+typedef IceUtil::Handle<TopicImpl> TopicImplPtr;
+
+//
+// A shard of the topics of the service. When <service>.Shards is set,
+// the topics are assigned to the shards by the hash of their name. Each
+// shard has its own publish object adapter, whose thread pool is the
+// event loop dispatching the events published on the shard topics, and
+// its own timers to flush the subscribers of these topics. The topic
+// link objects remain with the main publish adapter, the link proxies
+// saved by other services must survive a restart. For the same reason
+// the endpoints of a shard adapter are derived from the configured
+// endpoints of the main publish adapter, unless they are set.
+//
+// The events published on persistent topics are queued with the shard
+// and delivered in batches by the dispatch thread which finds the shard
+// idle, the replication state is checked once per batch rather than
+// once per event. A publisher waits until its events are delivered and
+// gets the exception raised by their delivery, if any. The queue is
+// therefore bounded by the number of dispatch threads publishing on the
+// shard.
+//
+class Shard : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    Shard(const InstancePtr&, int);
+
+    Ice::ObjectAdapterPtr publishAdapter() const
+    {
+        return _publishAdapter;
+    }
+
+    IceUtil::TimerPtr batchFlusher() const
+    {
+        return _batchFlusher;
+    }
+
+    IceUtil::TimerPtr timer() const
+    {
+        return _timer;
+    }
+
+    void publish(const TopicImplPtr&, bool, const EventDataSeq&);
+
+    void shutdown();
+    void destroy();
+
+private:
+
+    struct Publish : public IceUtil::Shared
+    {
+        Publish(const TopicImplPtr&, bool, const EventDataSeq&);
+
+        const TopicImplPtr topic;
+        const bool forwarded;
+        const EventDataSeq events;
+        bool delivered;
+        IceInternal::UniquePtr<Ice::Exception> exception;
+    };
+    typedef IceUtil::Handle<Publish> PublishPtr;
+
+    void deliver(const std::deque<PublishPtr>&);
+
+    const InstancePtr _instance;
+    Ice::ObjectAdapterPtr _publishAdapter;
+    bool _ownAdapter;
+    IceUtil::TimerPtr _batchFlusher;
+    IceUtil::TimerPtr _timer;
+
+    std::deque<PublishPtr> _queue;
+    bool _delivering;
+};
+typedef IceUtil::Handle<Shard> ShardPtr;
+
+}
+
+#endif
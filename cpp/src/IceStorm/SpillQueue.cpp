@@ -0,0 +1,411 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <IceUtil/DisableWarnings.h>
+#include <IceUtil/FileUtil.h>
+#include <IceStorm/SpillQueue.h>
+#include <Ice/InputStream.h>
+#include <Ice/OutputStream.h>
+
+#include <fstream>
+#include <iomanip>
+
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+
+//
+// Each event is stored as a record made of the size of the encoded
+// event (an Int), the time at which it was queued in milliseconds (a
+// Long) and the encoded event.
+//
+const Ice::Long headerSize = 4 + 8;
+
+}
+
+IceStorm::SpillQueue::SpillQueue(const Ice::CommunicatorPtr& communicator,
+                                 const string& path,
+                                 Ice::Long sizeMax,
+                                 const IceUtil::Time& ageMax,
+                                 Ice::Long segmentSize) :
+    _communicator(communicator),
+    _path(path),
+    _sizeMax(sizeMax),
+    _ageMax(ageMax),
+    _segmentSize(segmentSize),
+    _head(0),
+    _size(0),
+    _fd(-1),
+    _readFd(-1)
+{
+    //
+    // Nothing is created on disk until events are spilled. If the queue
+    // directory exists, find the segments left by a previous run,
+    // starting with the head segment saved in the head file. Segments are
+    // numbered consecutively.
+    //
+    if(!IceUtilInternal::directoryExists(_path))
+    {
+        return;
+    }
+
+    Ice::Long number = 0;
+    ifstream is(IceUtilInternal::streamFilename(_path + "/head").c_str()); // _path is a UTF-8 string
+    if(is && !(is >> number >> _head))
+    {
+        number = 0;
+        _head = 0;
+    }
+
+    IceUtilInternal::structstat buf;
+    while(IceUtilInternal::stat(segmentPath(number), &buf) == 0)
+    {
+        _segments.push_back(make_pair(number, static_cast<Ice::Long>(buf.st_size)));
+        _size += static_cast<Ice::Long>(buf.st_size);
+        ++number;
+    }
+
+    if(_segments.empty())
+    {
+        _head = 0;
+    }
+    _size -= _head;
+    if(_size < 0)
+    {
+        _size = 0;
+    }
+}
+
+IceStorm::SpillQueue::~SpillQueue()
+{
+    closeHead();
+    closeTail();
+}
+
+bool
+IceStorm::SpillQueue::push(const EventDataSeq& events, bool dropOldest)
+{
+    if(events.empty())
+    {
+        return true;
+    }
+
+    if(_fd < 0)
+    {
+        //
+        // Always append to a new segment, the last segment left by a
+        // previous run might end with a partially written record.
+        //
+        if(IceUtilInternal::mkdir(_path, 0777) != 0 && errno != EEXIST)
+        {
+            throwFileException(_path);
+        }
+        openTail(_segments.empty() ? 0 : _segments.back().first + 1);
+    }
+
+    Ice::OutputStream out(_communicator);
+    Ice::Long now = IceUtil::Time::now().toMilliSeconds();
+    for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+    {
+        Ice::OutputStream data(_communicator);
+        data.write(*p);
+        out.write(static_cast<Ice::Int>(data.b.size()));
+        out.write(now);
+        out.writeBlob(&data.b[0], data.b.size());
+    }
+
+    Ice::Long size = static_cast<Ice::Long>(out.b.size());
+    if(_size + size > _sizeMax)
+    {
+        if(!dropOldest)
+        {
+            return false;
+        }
+        if(_size > 0)
+        {
+            while(_size + size > _sizeMax && _size > 0)
+            {
+                //
+                // The head segment is dropped as a whole. If it's also
+                // the tail segment, the events are appended to a new
+                // segment.
+                //
+                if(_segments.size() == 1)
+                {
+                    openTail(_segments.back().first + 1);
+                }
+                _size -= _segments.front().second - _head;
+                removeHead();
+            }
+            saveHead();
+        }
+    }
+
+    const Ice::Byte* p = &out.b[0];
+    Ice::Long remaining = size;
+    while(remaining > 0)
+    {
+#ifdef _WIN32
+        int n = ::_write(_fd, p, static_cast<unsigned int>(remaining));
+#else
+        ssize_t n = ::write(_fd, p, static_cast<size_t>(remaining));
+#endif
+        if(n < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            throwFileException(segmentPath(_segments.back().first));
+        }
+        p += n;
+        remaining -= n;
+    }
+    _segments.back().second += size;
+    _size += size;
+
+    if(_segments.back().second >= _segmentSize)
+    {
+        openTail(_segments.back().first + 1);
+    }
+    return true;
+}
+
+void
+IceStorm::SpillQueue::pop(EventDataSeq& events, size_t max)
+{
+    if(_size == 0)
+    {
+        return;
+    }
+
+    while(events.size() < max && _size > 0)
+    {
+        if(_head >= _segments.front().second)
+        {
+            assert(_segments.size() > 1);
+            removeHead();
+            continue;
+        }
+        readHead(events, max);
+    }
+
+    //
+    // Remove the head segment as soon as it's fully read, unless it's
+    // also the tail segment.
+    //
+    if(_head >= _segments.front().second && _segments.size() > 1)
+    {
+        removeHead();
+    }
+    saveHead();
+}
+
+void
+IceStorm::SpillQueue::discard()
+{
+    closeHead();
+    closeTail();
+    for(deque<pair<Ice::Long, Ice::Long> >::const_iterator p = _segments.begin(); p != _segments.end(); ++p)
+    {
+        IceUtilInternal::remove(segmentPath(p->first));
+    }
+    _segments.clear();
+    _size = 0;
+    _head = 0;
+    IceUtilInternal::remove(_path + "/head");
+    IceUtilInternal::rmdir(_path);
+}
+
+string
+IceStorm::SpillQueue::segmentPath(Ice::Long number) const
+{
+    ostringstream os;
+    os << _path << '/' << setfill('0') << setw(10) << number << ".seg";
+    return os.str();
+}
+
+void
+IceStorm::SpillQueue::openTail(Ice::Long number)
+{
+    closeTail();
+
+    string path = segmentPath(number);
+    _fd = IceUtilInternal::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY);
+    if(_fd < 0)
+    {
+        throwFileException(path);
+    }
+    _segments.push_back(make_pair(number, Ice::Long(0)));
+}
+
+void
+IceStorm::SpillQueue::closeTail()
+{
+    if(_fd >= 0)
+    {
+        IceUtilInternal::close(_fd);
+        _fd = -1;
+    }
+}
+
+void
+IceStorm::SpillQueue::closeHead()
+{
+    if(_readFd >= 0)
+    {
+        IceUtilInternal::close(_readFd);
+        _readFd = -1;
+    }
+}
+
+void
+IceStorm::SpillQueue::removeHead()
+{
+    assert(_segments.size() > 1);
+    closeHead();
+    IceUtilInternal::remove(segmentPath(_segments.front().first));
+    _segments.pop_front();
+    _head = 0;
+}
+
+void
+IceStorm::SpillQueue::saveHead()
+{
+    string path = _path + "/head";
+    {
+        ofstream os(IceUtilInternal::streamFilename(path + ".tmp").c_str()); // path is a UTF-8 string
+        if(!os)
+        {
+            throwFileException(path + ".tmp");
+        }
+        os << _segments.front().first << ' ' << _head << endl;
+    }
+#ifdef _WIN32
+    IceUtilInternal::remove(path);
+#endif
+    if(IceUtilInternal::rename(path + ".tmp", path) != 0)
+    {
+        throwFileException(path);
+    }
+}
+
+void
+IceStorm::SpillQueue::readHead(EventDataSeq& events, size_t max)
+{
+    const Ice::Long size = _segments.front().second;
+    if(_readFd < 0)
+    {
+        string path = segmentPath(_segments.front().first);
+        _readFd = IceUtilInternal::open(path, O_RDONLY | O_BINARY);
+        if(_readFd < 0)
+        {
+            throwFileException(path);
+        }
+#ifdef _WIN32
+        if(_lseeki64(_readFd, _head, SEEK_SET) != _head)
+#else
+        if(lseek(_readFd, static_cast<off_t>(_head), SEEK_SET) != static_cast<off_t>(_head))
+#endif
+        {
+            closeHead();
+            throwFileException(path);
+        }
+    }
+
+    Ice::Long expired = _ageMax > IceUtil::Time() ? (IceUtil::Time::now() - _ageMax).toMilliSeconds() : 0;
+    vector<Ice::Byte> buffer;
+    try
+    {
+        while(events.size() < max && _head < size)
+        {
+            Ice::Int length = -1;
+            Ice::Long timestamp = 0;
+            if(size - _head >= headerSize)
+            {
+                buffer.resize(static_cast<size_t>(headerSize));
+                read(&buffer[0], buffer.size());
+                Ice::InputStream header(_communicator, make_pair(&buffer[0], &buffer[0] + buffer.size()));
+                header.read(length);
+                header.read(timestamp);
+            }
+
+            if(length < 0 || size - _head - headerSize < length)
+            {
+                //
+                // A partially written record, the remainder of the segment
+                // can't be read.
+                //
+                _size -= size - _head;
+                _head = size;
+                break;
+            }
+
+            buffer.resize(static_cast<size_t>(length));
+            if(length > 0)
+            {
+                read(&buffer[0], buffer.size());
+            }
+            if(timestamp >= expired)
+            {
+                Ice::InputStream in(_communicator, make_pair(&buffer[0], &buffer[0] + buffer.size()));
+                EventDataPtr event;
+                in.read(event);
+                events.push_back(event);
+            }
+            _head += headerSize + length;
+            _size -= headerSize + length;
+        }
+    }
+    catch(...)
+    {
+        //
+        // The file position might no longer match the head offset, the
+        // segment is opened again on the next read.
+        //
+        closeHead();
+        throw;
+    }
+}
+
+void
+IceStorm::SpillQueue::read(Ice::Byte* p, size_t count)
+{
+    while(count > 0)
+    {
+#ifdef _WIN32
+        int n = ::_read(_readFd, p, static_cast<unsigned int>(count));
+#else
+        ssize_t n = ::read(_readFd, p, count);
+#endif
+        if(n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if(n <= 0)
+        {
+            if(n == 0)
+            {
+                errno = 0; // Unexpected end of file.
+            }
+            throwFileException(segmentPath(_segments.front().first));
+        }
+        p += n;
+        count -= static_cast<size_t>(n);
+    }
+}
+
+void
+IceStorm::SpillQueue::throwFileException(const string& path) const
+{
+    throw Ice::FileException(__FILE__, __LINE__, errno, path);
+}
@@ -0,0 +1,101 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef SPILL_QUEUE_H
+#define SPILL_QUEUE_H
+
+#include <IceStorm/IceStormInternal.h>
+
+namespace IceStorm
+{
+
+//
+// A queue of events stored on disk, used by twoway subscribers to hold
+// the events which can't be kept in memory or which are published while
+// the subscriber is offline.
+//
+// The events are appended to numbered segment files in the queue
+// directory and read back sequentially from the head segment, which is
+// kept open until all its events are read and it's removed. The queue
+// directory and its first segment are only created when events are
+// first spilled; an existing directory is recovered when the queue is
+// created.
+//
+// The queue directory is named after the topic and identity of the
+// subscriber, so it's found again when the subscriber is re-created from
+// its database record on restart. The position of the next event to read
+// is saved in the "head" file of the directory rather than in the
+// database: it changes on each read and must stay consistent with the
+// segment files, which live outside the database, and a database write
+// transaction for each read would be serialized with the topic updates.
+// Only the events on disk survive a restart: the events already moved to
+// the in-memory queue of the subscriber aren't written back.
+//
+// The queue isn't thread safe, it's protected by the subscriber lock.
+// Failures to access the queue files raise Ice::FileException.
+//
+class SpillQueue : public IceUtil::Shared
+{
+public:
+
+    SpillQueue(const Ice::CommunicatorPtr&, const std::string&, Ice::Long, const IceUtil::Time&, Ice::Long);
+    ~SpillQueue();
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    //
+    // Append the events. If the queue would exceed its maximum size, the
+    // oldest events are dropped if the second argument is true,
+    // otherwise the events aren't appended and false is returned. The
+    // oldest events are dropped a segment at a time, the tail segment is
+    // closed first if it's also the head segment.
+    //
+    bool push(const EventDataSeq&, bool);
+
+    //
+    // Move up to the given number of events from the head of the queue
+    // to the given sequence. Events older than the maximum age are
+    // discarded.
+    //
+    void pop(EventDataSeq&, size_t);
+
+    //
+    // Discard the queued events and remove the queue files. The queue
+    // files are otherwise kept when the queue is released, so the
+    // events are sent once the subscriber is re-created.
+    //
+    void discard();
+
+private:
+
+    std::string segmentPath(Ice::Long) const;
+    void openTail(Ice::Long);
+    void closeTail();
+    void closeHead();
+    void removeHead();
+    void saveHead();
+    void readHead(EventDataSeq&, size_t);
+    void read(Ice::Byte*, size_t);
+    void throwFileException(const std::string&) const;
+
+    const Ice::CommunicatorPtr _communicator;
+    const std::string _path;
+    const Ice::Long _sizeMax;
+    const IceUtil::Time _ageMax;
+    const Ice::Long _segmentSize;
+
+    std::deque<std::pair<Ice::Long, Ice::Long> > _segments; // The segment numbers and sizes.
+    Ice::Long _head; // The read offset in the head segment.
+    Ice::Long _size; // The number of bytes which aren't read yet.
+    int _fd; // The file descriptor of the tail segment.
+    int _readFd; // The file descriptor of the head segment, positioned at _head.
+};
+typedef IceUtil::Handle<SpillQueue> SpillQueuePtr;
+
+}
+
+#endif
@@ -9,6 +9,8 @@
 #include <IceStorm/Util.h>
 #include <Ice/LoggerUtil.h>
 #include <IceUtil/StringUtil.h>
+#include <algorithm>
+#include <iomanip>
 #include <iterator>
 
 using namespace std;
@@ -184,6 +186,48 @@ private:
     const SubscriberBatchPtr _subscriber;
 };
 
+//
+// Escape the characters which aren't safe in a file name.
+//
+string
+toFileName(const string& s)
+{
+    ostringstream os;
+    for(string::const_iterator p = s.begin(); p != s.end(); ++p)
+    {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if(isalnum(c) || c == '-' || c == '_')
+        {
+            os << *p;
+        }
+        else
+        {
+            os << '%' << hex << setw(2) << setfill('0') << static_cast<int>(c) << dec;
+        }
+    }
+    return os.str();
+}
+
+class ReplayTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    ReplayTimerTask(const SubscriberPtr& subscriber) :
+        _subscriber(subscriber)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _subscriber->replay();
+    }
+
+private:
+
+    const SubscriberPtr _subscriber;
+};
+
 }
 
 SubscriberBatch::SubscriberBatch(
@@ -205,7 +249,7 @@ SubscriberBatch::flush()
     if(_outstanding == 0)
     {
         ++_outstanding;
-        _instance->batchFlusher()->schedule(new FlushTimerTask(this), _interval);
+        _instance->batchFlusher(_rec.topicName)->schedule(new FlushTimerTask(this), _interval);
     }
 }
 
@@ -405,6 +449,19 @@ SubscriberTwoway::SubscriberTwoway(
     Subscriber(instance, rec, proxy, retryCount, maxOutstanding),
     _obj(obj)
 {
+    //
+    // The events of twoway subscribers are spilled to disk if a spill
+    // path is configured. Files are only created once events are
+    // spilled, unless the subscriber already has a queue on disk.
+    //
+    PersistentInstancePtr persistentInstance = PersistentInstancePtr::dynamicCast(instance);
+    if(persistentInstance && !persistentInstance->spillPath().empty())
+    {
+        string name = toFileName(rec.topicName) + "." + toFileName(instance->communicator()->identityToString(rec.id));
+        _spill = new SpillQueue(instance->communicator(), persistentInstance->spillPath() + "/" + name,
+                                persistentInstance->spillSizeMax(), persistentInstance->spillAgeMax(),
+                                persistentInstance->spillSegmentSize());
+    }
 }
 
 void
@@ -415,7 +472,13 @@ SubscriberTwoway::flush()
     //
     // If the subscriber isn't online we're done.
     //
-    if(_state != SubscriberStateOnline || _events.empty())
+    if(_state != SubscriberStateOnline)
+    {
+        return;
+    }
+
+    unspill();
+    if(_events.empty())
     {
         return;
     }
@@ -442,6 +505,10 @@ SubscriberTwoway::flush()
         }
         catch(const Ice::Exception& ex)
         {
+            //
+            // The event wasn't sent, it's queued again.
+            //
+            _events.insert(_events.begin(), e);
             error(true, ex);
             return;
         }
@@ -595,6 +662,30 @@ Subscriber::create(
                 newObj = newObj->ice_connectionCached(connectionCached > 0);
             }
 
+            //
+            // The maximum number of events sent to a twoway subscriber
+            // without waiting for their responses. The events of an
+            // ordered subscriber are sent one at a time.
+            //
+            int maxOutstanding = 5;
+            p = rec.theQoS.find("maxOutstanding");
+            if(p != rec.theQoS.end())
+            {
+                istringstream is(IceUtilInternal::trim(p->second));
+                if(!(is >> maxOutstanding) || !is.eof() || maxOutstanding <= 0)
+                {
+                    throw BadQoS("invalid max outstanding (positive numeric value required): " + p->second);
+                }
+                if(!newObj->ice_isTwoway())
+                {
+                    throw BadQoS("maxOutstanding QoS requires a twoway proxy");
+                }
+                if(reliability == "ordered")
+                {
+                    throw BadQoS("maxOutstanding QoS isn't supported with ordered reliability");
+                }
+            }
+
             if(reliability == "ordered")
             {
                 if(!newObj->ice_isTwoway())
@@ -622,7 +713,7 @@ Subscriber::create(
             else //if(newObj->ice_isTwoway())
             {
                 assert(newObj->ice_isTwoway());
-                subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, 5, newObj);
+                subscriber = new SubscriberTwoway(instance, rec, proxy, retryCount, maxOutstanding, newObj);
             }
             per->setSubscriber(subscriber);
         }
@@ -632,6 +723,10 @@ Subscriber::create(
             throw;
         }
 
+        //
+        // Send the events spilled to disk before a restart.
+        //
+        subscriber->replay();
         return subscriber;
     }
 }
@@ -654,6 +749,12 @@ Subscriber::record() const
     return _rec;
 }
 
+EventFilterPtr
+Subscriber::filter() const
+{
+    return _filter;
+}
+
 bool
 Subscriber::queue(bool forwarded, const EventDataSeq& events)
 {
@@ -673,6 +774,14 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
     {
         if(IceUtil::Time::now(IceUtil::Time::Monotonic) < _next)
         {
+            //
+            // The events are discarded unless they can be spilled to
+            // disk.
+            //
+            if(_spill && !spill(events))
+            {
+                return false;
+            }
             break;
         }
 
@@ -685,6 +794,21 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
 
     case SubscriberStateOnline:
     {
+        //
+        // Spill the events to disk if there are already spilled events,
+        // to preserve ordering, or if the events don't fit in memory.
+        //
+        if(_spill && (!_spill->empty() || (_instance->sendQueueSizeMax() > 0 &&
+                      static_cast<int>(_events.size() + events.size()) > _instance->sendQueueSizeMax())))
+        {
+            if(!spill(events))
+            {
+                return false;
+            }
+            flush();
+            break;
+        }
+
         for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
         {
             if(static_cast<int>(_events.size()) == _instance->sendQueueSizeMax())
@@ -773,6 +897,27 @@ Subscriber::destroy()
 
     IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
     _observer.detach();
+
+    //
+    // The spilled events are kept on disk, they are sent again if the
+    // subscriber is re-created. The events of the in-memory queue are
+    // lost.
+    //
+    _spill = 0;
+}
+
+void
+Subscriber::discard()
+{
+    {
+        IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+        if(_spill)
+        {
+            _spill->discard();
+            _spill = 0;
+        }
+    }
+    destroy();
 }
 
 void
@@ -856,10 +1001,26 @@ Subscriber::error(bool dec, const Ice::Exception& e)
         }
 
         // Transition to offline state, increment the retry count and
-        // clear all queued events.
+        // clear all queued events. If the events are spilled to disk,
+        // the queued events are kept and sent again once the discard
+        // interval expires.
         _next = now + _instance->discardInterval();
         ++_currentRetry;
-        _events.clear();
+        if(_spill)
+        {
+            try
+            {
+                _instance->timer(_rec.topicName)->schedule(new ReplayTimerTask(this), _instance->discardInterval());
+            }
+            catch(const IceUtil::IllegalArgumentException&)
+            {
+                // The timer is destroyed, the service is shutting down.
+            }
+        }
+        else
+        {
+            _events.clear();
+        }
         setState(SubscriberStateOffline);
     }
     // Errored out.
@@ -956,6 +1117,109 @@ Subscriber::updateObserver()
     }
 }
 
+void
+Subscriber::replay()
+{
+    IceUtil::Monitor<IceUtil::RecMutex>::Lock sync(_lock);
+
+    if(!_spill)
+    {
+        return;
+    }
+
+    if(_state == SubscriberStateOffline)
+    {
+        if(IceUtil::Time::now(IceUtil::Time::Monotonic) < _next)
+        {
+            return;
+        }
+        setState(SubscriberStateOnline);
+    }
+
+    if(_state == SubscriberStateOnline && (!_events.empty() || !_spill->empty()))
+    {
+        flush();
+    }
+}
+
+bool
+Subscriber::spill(const EventDataSeq& events)
+{
+    assert(_spill);
+    try
+    {
+        if(!_spill->push(events, _instance->sendQueueSizeMaxPolicy() == Instance::DropEvents))
+        {
+            error(false, IceStorm::SendQueueSizeMaxReached(__FILE__, __LINE__));
+            return false;
+        }
+    }
+    catch(const Ice::FileException& ex)
+    {
+        Ice::Warning warn(_instance->traceLevels()->logger);
+        warn << _instance->traceLevels()->subscriberCat << ":" << _instance->communicator()->identityToString(_rec.id)
+             << " can't spill events to disk, discarding spilled events:\n" << ex;
+        _spill = 0;
+        return true;
+    }
+
+    if(_observer)
+    {
+        _observer->queued(static_cast<Ice::Int>(events.size()));
+    }
+    return true;
+}
+
+void
+Subscriber::unspill()
+{
+    if(!_spill || _spill->empty())
+    {
+        return;
+    }
+
+    //
+    // Refill the in-memory queue once it's half empty, reading the
+    // spilled events in chunks rather than one at a time.
+    //
+    size_t max = _instance->sendQueueSizeMax() > 0 ? static_cast<size_t>(_instance->sendQueueSizeMax()) : 1000;
+    if(_events.size() > max / 2)
+    {
+        return;
+    }
+
+    try
+    {
+        _spill->pop(_events, max);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        Ice::Warning warn(_instance->traceLevels()->logger);
+        warn << _instance->traceLevels()->subscriberCat << ":" << _instance->communicator()->identityToString(_rec.id)
+             << " can't read spilled events, discarding spilled events:\n" << ex;
+        _spill = 0;
+    }
+}
+
+namespace
+{
+
+EventFilterPtr
+createFilter(const SubscriberRecord& rec)
+{
+    if(!rec.link)
+    {
+        QoS::const_iterator p = rec.theQoS.find("filter");
+        if(p != rec.theQoS.end())
+        {
+            return new EventFilter(p->second);
+        }
+    }
+    return 0;
+}
+
+}
+
 Subscriber::Subscriber(
     const InstancePtr& instance,
     const SubscriberRecord& rec,
@@ -968,6 +1232,7 @@ Subscriber::Subscriber(
     _maxOutstanding(maxOutstanding),
     _proxy(proxy),
     _proxyReplica(proxy),
+    _filter(createFilter(rec)),
     _shutdown(false),
     _state(SubscriberStateOnline),
     _outstanding(0),
@@ -1042,6 +1307,120 @@ Subscriber::setState(Subscriber::SubscriberState state)
     }
 }
 
+SubscriberIndex::SubscriberIndex(const vector<SubscriberPtr>& subscribers)
+{
+    vector<EventFilter::Term> terms;
+    for(vector<SubscriberPtr>::const_iterator p = subscribers.begin(); p != subscribers.end(); ++p)
+    {
+        EventFilterPtr filter = (*p)->filter();
+        if(!filter)
+        {
+            _unfiltered.push_back(*p);
+            continue;
+        }
+
+        size_t n = _filtered.size();
+        _filtered.push_back(*p);
+        if(!filter->indexTerms(terms))
+        {
+            _unindexed.push_back(n);
+            continue;
+        }
+
+        for(vector<EventFilter::Term>::const_iterator q = terms.begin(); q != terms.end(); ++q)
+        {
+            vector<size_t>& v = q->operation ? _operations[q->value] : _contexts[q->key][q->value];
+            if(v.empty() || v.back() != n)
+            {
+                v.push_back(n);
+            }
+        }
+    }
+}
+
+void
+SubscriberIndex::queue(bool forwarded, const EventDataSeq& events, vector<SubscriberPtr>& failed) const
+{
+    for(vector<SubscriberPtr>::const_iterator p = _unfiltered.begin(); p != _unfiltered.end(); ++p)
+    {
+        if(!(*p)->queue(forwarded, events))
+        {
+            failed.push_back(*p);
+        }
+    }
+
+    if(_filtered.empty())
+    {
+        return;
+    }
+
+    //
+    // Gather the events matched by each filtered subscriber, only the
+    // subscribers with a matching filter get an entry.
+    //
+    map<size_t, EventDataSeq> matched;
+    vector<size_t> candidates;
+    for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+    {
+        match(*p, candidates);
+        for(vector<size_t>::const_iterator q = candidates.begin(); q != candidates.end(); ++q)
+        {
+            matched[*q].push_back(*p);
+        }
+    }
+
+    for(map<size_t, EventDataSeq>::const_iterator p = matched.begin(); p != matched.end(); ++p)
+    {
+        if(!_filtered[p->first]->queue(forwarded, p->second))
+        {
+            failed.push_back(_filtered[p->first]);
+        }
+    }
+}
+
+void
+SubscriberIndex::match(const EventDataPtr& event, vector<size_t>& matched) const
+{
+    vector<size_t> candidates = _unindexed;
+
+    ValueIndex::const_iterator p = _operations.find(event->op);
+    if(p != _operations.end())
+    {
+        candidates.insert(candidates.end(), p->second.begin(), p->second.end());
+    }
+
+    if(!_contexts.empty())
+    {
+        for(Ice::Context::const_iterator q = event->context.begin(); q != event->context.end(); ++q)
+        {
+            map<string, ValueIndex>::const_iterator r = _contexts.find(q->first);
+            if(r != _contexts.end())
+            {
+                p = r->second.find(q->second);
+                if(p != r->second.end())
+                {
+                    candidates.insert(candidates.end(), p->second.begin(), p->second.end());
+                }
+            }
+        }
+    }
+
+    //
+    // A subscriber can be indexed under several terms of its filter.
+    //
+    sort(candidates.begin(), candidates.end());
+    candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+    matched.clear();
+    for(vector<size_t>::const_iterator q = candidates.begin(); q != candidates.end(); ++q)
+    {
+        if(_filtered[*q]->filter()->match(event))
+        {
+            matched.push_back(*q);
+        }
+    }
+}
+
 bool
 IceStorm::operator==(const SubscriberPtr& subscriber, const Ice::Identity& id)
 {
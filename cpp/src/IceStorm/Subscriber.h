@@ -8,6 +8,8 @@
 #include <IceStorm/IceStormInternal.h>
 #include <IceStorm/SubscriberRecord.h>
 #include <IceStorm/Instrumentation.h>
+#include <IceStorm/EventFilter.h>
+#include <IceStorm/SpillQueue.h>
 #include <Ice/ObserverHelper.h>
 #include <IceUtil/RecMutex.h>
 
@@ -29,6 +31,7 @@ public:
     Ice::ObjectPrx proxy() const; // Get the per subscriber object.
     Ice::Identity id() const; // Return the id of the subscriber.
     IceStorm::SubscriberRecord record() const; // Get the subscriber record.
+    EventFilterPtr filter() const; // Get the filter of the subscriber, if any.
 
     // Returns false if the subscriber should be reaped.
     bool queue(bool, const EventDataSeq&);
@@ -37,6 +40,7 @@ public:
     bool errored() const;
 
     void destroy();
+    void discard(); // Destroy the subscriber and discard its spilled events.
 
     // To be called by the AMI callbacks only.
     void completed(const Ice::AsyncResultPtr&);
@@ -46,6 +50,9 @@ public:
 
     void updateObserver();
 
+    // Send the events spilled to disk if the subscriber is back online.
+    void replay();
+
     enum SubscriberState
     {
         SubscriberStateOnline, // Online waiting to send events.
@@ -60,6 +67,9 @@ protected:
 
     void setState(SubscriberState);
 
+    bool spill(const EventDataSeq&);
+    void unspill();
+
     Subscriber(const InstancePtr&, const IceStorm::SubscriberRecord&, const Ice::ObjectPrx&, int, int);
 
     // Immutable
@@ -69,6 +79,7 @@ protected:
     const int _maxOutstanding; // The maximum number of oustanding events.
     const Ice::ObjectPrx _proxy; // The per subscriber object proxy, if any.
     const Ice::ObjectPrx _proxyReplica; // The replicated per subscriber object proxy, if any.
+    const EventFilterPtr _filter; // The filter QoS, if any.
 
     IceUtil::Monitor<IceUtil::RecMutex> _lock;
 
@@ -79,6 +90,7 @@ protected:
     int _outstanding; // The current number of outstanding responses.
     int _outstandingCount; // The current number of outstanding events when batching events (only used for metrics).
     EventDataSeq _events; // The queue of events to send.
+    SpillQueuePtr _spill; // The queue of events spilled to disk, if enabled.
 
     // The next time to try sending a new event if we're offline.
     IceUtil::Time _next;
@@ -87,6 +99,38 @@ protected:
     IceInternal::ObserverHelperT<IceStorm::Instrumentation::SubscriberObserver> _observer;
 };
 
+//
+// An immutable snapshot of the subscribers of a topic, indexed by the
+// equality terms of their filters. Only the filters of the subscribers
+// which are indexed under the operation name or the context of an event
+// are evaluated.
+//
+class SubscriberIndex : public IceUtil::Shared
+{
+public:
+
+    SubscriberIndex(const std::vector<SubscriberPtr>&);
+
+    //
+    // Queue the events with the subscribers whose filter matches the
+    // events and return the subscribers for which queue() failed.
+    //
+    void queue(bool, const EventDataSeq&, std::vector<SubscriberPtr>&) const;
+
+private:
+
+    typedef std::map<std::string, std::vector<size_t> > ValueIndex;
+
+    void match(const EventDataPtr&, std::vector<size_t>&) const;
+
+    std::vector<SubscriberPtr> _unfiltered; // The subscribers without filter.
+    std::vector<SubscriberPtr> _filtered; // The subscribers with a filter.
+    std::vector<size_t> _unindexed; // The filtered subscribers whose filter must always be evaluated.
+    ValueIndex _operations; // Operation name to filtered subscribers.
+    std::map<std::string, ValueIndex> _contexts; // Context key and value to filtered subscribers.
+};
+typedef IceUtil::Handle<SubscriberIndex> SubscriberIndexPtr;
+
 bool operator==(const IceStorm::SubscriberPtr&, const Ice::Identity&);
 bool operator==(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 bool operator!=(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
@@ -5,6 +5,7 @@
 #include <IceStorm/TopicI.h>
 #include <IceStorm/Instance.h>
 #include <IceStorm/Subscriber.h>
+#include <IceStorm/Shard.h>
 #include <IceStorm/TraceLevels.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/Observers.h>
@@ -27,6 +28,172 @@ logError(const Ice::CommunicatorPtr& com, const IceDB::LMDBException& ex)
     error << "LMDB error: " << ex;
 }
 
+//
+// The topic updates are group committed, the updates made concurrently
+// by several topics are committed together. On the master the LLU is
+// incremented by the update, on a replica the update stores the LLU of
+// the master.
+//
+class AddSubscriberMutation : public IceDB::Mutation
+{
+public:
+
+    AddSubscriberMutation(SubscriberMap& subscriberMap, LLUMap& lluMap, LogMap& logMap, int logSize,
+                          const SubscriberRecordKey& key, const SubscriberRecord& record,
+                          const LogUpdate* masterLLU = 0) :
+        _subscriberMap(subscriberMap), _lluMap(lluMap), _logMap(logMap), _logSize(logSize), _key(key),
+        _record(record), _masterLLU(masterLLU)
+    {
+    }
+
+    virtual void
+    execute(const IceDB::ReadWriteTxn& txn)
+    {
+        _subscriberMap.put(txn, _key, _record);
+        if(_masterLLU)
+        {
+            llu = *_masterLLU;
+            _lluMap.put(txn, lluDbKey, llu);
+        }
+        else
+        {
+            llu = getIncrementedLLU(txn, _lluMap);
+        }
+        appendLog(txn, _logMap, _logSize, llu, LogOperationAddSubscriber, _record.topicName, _record);
+    }
+
+    LogUpdate llu;
+
+private:
+
+    SubscriberMap& _subscriberMap;
+    LLUMap& _lluMap;
+    LogMap& _logMap;
+    const int _logSize;
+    const SubscriberRecordKey& _key;
+    const SubscriberRecord& _record;
+    const LogUpdate* _masterLLU;
+};
+
+class RemoveSubscribersMutation : public IceDB::Mutation
+{
+public:
+
+    RemoveSubscribersMutation(SubscriberMap& subscriberMap, LLUMap& lluMap, LogMap& logMap, int logSize,
+                              const Ice::Identity& topic, const Ice::IdentitySeq& ids,
+                              const LogUpdate* masterLLU = 0) :
+        found(false), _subscriberMap(subscriberMap), _lluMap(lluMap), _logMap(logMap), _logSize(logSize),
+        _topic(topic), _ids(ids), _masterLLU(masterLLU)
+    {
+    }
+
+    virtual void
+    execute(const IceDB::ReadWriteTxn& txn)
+    {
+        for(Ice::IdentitySeq::const_iterator id = _ids.begin(); id != _ids.end(); ++id)
+        {
+            SubscriberRecordKey key;
+            key.topic = _topic;
+            key.id = *id;
+
+            if(_subscriberMap.del(txn, key))
+            {
+                found = true;
+            }
+        }
+
+        //
+        // The master only logs the removal of subscribers which were
+        // found, a replica always logs the update of the master.
+        //
+        if(_masterLLU)
+        {
+            llu = *_masterLLU;
+            _lluMap.put(txn, lluDbKey, llu);
+        }
+        else if(found)
+        {
+            llu = getIncrementedLLU(txn, _lluMap);
+        }
+        else
+        {
+            return;
+        }
+        appendLog(txn, _logMap, _logSize, llu, LogOperationRemoveSubscriber, identityToTopicName(_topic),
+                  SubscriberRecord(), _ids);
+    }
+
+    bool found;
+    LogUpdate llu;
+
+private:
+
+    SubscriberMap& _subscriberMap;
+    LLUMap& _lluMap;
+    LogMap& _logMap;
+    const int _logSize;
+    const Ice::Identity& _topic;
+    const Ice::IdentitySeq& _ids;
+    const LogUpdate* _masterLLU;
+};
+
+class DestroyTopicMutation : public IceDB::Mutation
+{
+public:
+
+    DestroyTopicMutation(SubscriberMap& subscriberMap, LLUMap& lluMap, LogMap& logMap, int logSize,
+                         const Ice::Identity& topic, const string& name, const LogUpdate* masterLLU) :
+        _subscriberMap(subscriberMap), _lluMap(lluMap), _logMap(logMap), _logSize(logSize), _topic(topic),
+        _name(name), _masterLLU(masterLLU)
+    {
+    }
+
+    virtual void
+    execute(const IceDB::ReadWriteTxn& txn)
+    {
+        // Erase all subscriber records and the topic record.
+        SubscriberRecordKey key;
+        key.topic = _topic;
+
+        SubscriberMapRWCursor cursor(_subscriberMap, txn);
+        if(cursor.find(key))
+        {
+            _subscriberMap.del(txn, key);
+
+            SubscriberRecordKey k;
+            SubscriberRecord v;
+            while(cursor.get(k, v, MDB_NEXT) && k.topic == key.topic)
+            {
+                _subscriberMap.del(txn, k);
+            }
+        }
+
+        // Update the LLU.
+        if(_masterLLU)
+        {
+            llu = *_masterLLU;
+            _lluMap.put(txn, lluDbKey, llu);
+        }
+        else
+        {
+            llu = getIncrementedLLU(txn, _lluMap);
+        }
+        appendLog(txn, _logMap, _logSize, llu, LogOperationDestroyTopic, _name);
+    }
+
+    LogUpdate llu;
+
+private:
+
+    SubscriberMap& _subscriberMap;
+    LLUMap& _lluMap;
+    LogMap& _logMap;
+    const int _logSize;
+    const Ice::Identity& _topic;
+    const string& _name;
+    const LogUpdate* _masterLLU;
+};
+
 //
 // The servant has a 1-1 association with a topic. It is used to
 // receive events from Publishers.
@@ -341,9 +508,12 @@ TopicImpl::TopicImpl(
     _instance(instance),
     _name(name),
     _id(id),
+    _shard(_instance->shard(name)),
+    _publishAdapter(_instance->publishAdapter(name)),
     _destroyed(false),
     _lluMap(_instance->lluMap()),
-    _subscriberMap(_instance->subscriberMap())
+    _subscriberMap(_instance->subscriberMap()),
+    _logMap(_instance->logMap())
 {
     try
     {
@@ -380,7 +550,7 @@ TopicImpl::TopicImpl(
             linkid.name = _name + ".link";
         }
 
-        _publisherPrx = _instance->publishAdapter()->add(new PublisherI(this, instance), pubid);
+        _publisherPrx = _publishAdapter->add(new PublisherI(this, instance), pubid);
         _linkPrx = TopicLinkPrx::uncheckedCast(
             _instance->publishAdapter()->add(new TopicLinkI(this, instance), linkid));
 
@@ -409,6 +579,7 @@ TopicImpl::TopicImpl(
                 //
                 SubscriberPtr subscriber = Subscriber::create(_instance, *p);
                 _subscribers.push_back(subscriber);
+                _index = 0;
             }
             catch(const Ice::Exception& ex)
             {
@@ -461,11 +632,11 @@ TopicImpl::getNonReplicatedPublisher() const
     // so create an indirect proxy, otherwise create a direct proxy.
     if(!_publisherPrx->ice_getAdapterId().empty())
     {
-        return _instance->publishAdapter()->createIndirectProxy(_publisherPrx->ice_getIdentity());
+        return _publishAdapter->createIndirectProxy(_publisherPrx->ice_getIdentity());
     }
     else
     {
-        return _instance->publishAdapter()->createDirectProxy(_publisherPrx->ice_getIdentity());
+        return _publishAdapter->createDirectProxy(_publisherPrx->ice_getIdentity());
     }
 }
 
@@ -546,17 +717,13 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
         SubscriberRecordKey key;
         key.topic = _id;
         key.id = subscriber->id();
 
-        _subscriberMap.put(txn, key, record);
-
-        llu = getIncrementedLLU(txn, _lluMap);
-
-        txn.commit();
+        AddSubscriberMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), key, record);
+        _instance->dbEnv().groupCommit(mutation);
+        llu = mutation.llu;
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -565,6 +732,7 @@ TopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPrx& obj)
     }
 
     _subscribers.push_back(subscriber);
+    _index = 0;
 
     _instance->observers()->addSubscriber(llu, _name, record);
 
@@ -656,17 +824,13 @@ TopicImpl::link(const TopicPrx& topic, Ice::Int cost)
 
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
         SubscriberRecordKey key;
         key.topic = _id;
         key.id = id;
 
-        _subscriberMap.put(txn, key, record);
-
-        llu = getIncrementedLLU(txn, _lluMap);
-
-        txn.commit();
+        AddSubscriberMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), key, record);
+        _instance->dbEnv().groupCommit(mutation);
+        llu = mutation.llu;
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -675,6 +839,7 @@ TopicImpl::link(const TopicPrx& topic, Ice::Int cost)
     }
 
     _subscribers.push_back(subscriber);
+    _index = 0;
 
     _instance->observers()->addSubscriber(llu, _name, record);
 }
@@ -861,6 +1026,7 @@ TopicImpl::update(const SubscriberRecordSeq& records)
             {
                 (*p)->destroy();
                 p = _subscribers.erase(p);
+                _index = 0;
             }
             else
             {
@@ -885,6 +1051,7 @@ TopicImpl::update(const SubscriberRecordSeq& records)
         {
             SubscriberPtr subscriber = Subscriber::create(_instance, *p);
             _subscribers.push_back(subscriber);
+            _index = 0;
         }
     }
 }
@@ -953,61 +1120,90 @@ private:
 void
 TopicImpl::publish(bool forwarded, const EventDataSeq& events)
 {
-    TopicInternalPrx masterInternal;
+    if(_shard)
+    {
+        _shard->publish(this, forwarded, events);
+        return;
+    }
+
+    Ice::ObjectPrx master;
     Ice::Long generation = -1;
     Ice::IdentitySeq reap;
     {
         // Use cached reads.
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
-
-        //
-        // Copy of the subscriber list so that event publishing can occur
-        // in parallel.
-        //
-        vector<SubscriberPtr> copy;
+        if(!queue(forwarded, events, unlock.getMaster(), reap))
         {
-            IceUtil::Mutex::Lock sync(_subscribersMutex);
-            if(_observer)
-            {
-                if(forwarded)
-                {
-                    _observer->forwarded();
-                }
-                else
-                {
-                    _observer->published();
-                }
-            }
-            copy = _subscribers;
+            return;
         }
+        master = unlock.getMaster();
+        generation = unlock.generation();
+    }
 
-        //
-        // Queue each event, gathering a list of those subscribers that
-        // must be reaped.
-        //
-        for(vector<SubscriberPtr>::const_iterator p = copy.begin(); p != copy.end(); ++p)
+    reapOnMaster(master, generation, reap);
+}
+
+bool
+TopicImpl::queue(bool forwarded, const EventDataSeq& events, const Ice::ObjectPrx& master, Ice::IdentitySeq& reap)
+{
+    //
+    // Copy of the subscriber list so that event publishing can occur
+    // in parallel.
+    //
+    SubscriberIndexPtr index;
+    {
+        IceUtil::Mutex::Lock sync(_subscribersMutex);
+        if(_observer)
         {
-            if(!(*p)->queue(forwarded, events) && (*p)->reap())
+            if(forwarded)
+            {
+                _observer->forwarded();
+            }
+            else
             {
-                reap.push_back((*p)->id());
+                _observer->published();
             }
         }
-
-        // If there are no subscribers in error then we're done.
-        if(reap.empty())
+        if(!_index)
         {
-            return;
+            _index = new SubscriberIndex(_subscribers);
         }
-        if(!unlock.getMaster())
+        index = _index;
+    }
+
+    //
+    // Queue each event with the subscribers whose filter matches
+    // it, gathering a list of those subscribers that must be reaped.
+    //
+    vector<SubscriberPtr> failed;
+    index->queue(forwarded, events, failed);
+    for(vector<SubscriberPtr>::const_iterator p = failed.begin(); p != failed.end(); ++p)
+    {
+        if((*p)->reap())
         {
-            IceUtil::Mutex::Lock sync(_subscribersMutex);
-            removeSubscribers(reap);
-            return;
+            reap.push_back((*p)->id());
         }
-        masterInternal = TopicInternalPrx::uncheckedCast(unlock.getMaster()->ice_identity(_id));
-        generation = unlock.generation();
     }
 
+    // If there are no subscribers in error then we're done.
+    if(reap.empty())
+    {
+        return false;
+    }
+    if(!master)
+    {
+        IceUtil::Mutex::Lock sync(_subscribersMutex);
+        removeSubscribers(reap);
+        return false;
+    }
+    return true;
+}
+
+void
+TopicImpl::reapOnMaster(const Ice::ObjectPrx& master, Ice::Long generation, const Ice::IdentitySeq& reap)
+{
+    TopicInternalPrx masterInternal = TopicInternalPrx::uncheckedCast(master->ice_identity(_id));
+
     // Tell the master to reap this set of subscribers. This is an
     // AMI invocation so it shouldn't block the caller (in the
     // typical case) we do it outside of the mutex lock for
@@ -1064,18 +1260,12 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
         SubscriberRecordKey key;
         key.topic = _id;
         key.id = subscriber->id();
 
-        _subscriberMap.put(txn, key, record);
-
-        // Update the LLU.
-        _lluMap.put(txn, lluDbKey, llu);
-
-        txn.commit();
+        AddSubscriberMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), key, record, &llu);
+        _instance->dbEnv().groupCommit(mutation);
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1084,6 +1274,7 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
     }
 
     _subscribers.push_back(subscriber);
+    _index = 0;
 }
 
 void
@@ -1110,20 +1301,8 @@ TopicImpl::observerRemoveSubscriber(const LogUpdate& llu, const Ice::IdentitySeq
     // First remove from the database.
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
-        for(Ice::IdentitySeq::const_iterator id = ids.begin(); id != ids.end(); ++id)
-        {
-            SubscriberRecordKey key;
-            key.topic = _id;
-            key.id = *id;
-
-            _subscriberMap.del(txn, key);
-        }
-
-        _lluMap.put(txn, lluDbKey, llu);
-
-        txn.commit();
+        RemoveSubscribersMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), _id, ids, &llu);
+        _instance->dbEnv().groupCommit(mutation);
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1139,8 +1318,9 @@ TopicImpl::observerRemoveSubscriber(const LogUpdate& llu, const Ice::IdentitySeq
         vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), *id);
         if(p != _subscribers.end())
         {
-            (*p)->destroy();
+            (*p)->discard();
             _subscribers.erase(p);
+            _index = 0;
         }
     }
 }
@@ -1200,37 +1380,10 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
     LogUpdate llu;
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
-        // Erase all subscriber records and the topic record.
-        SubscriberRecordKey key;
-        key.topic = _id;
-
-        SubscriberMapRWCursor cursor(_subscriberMap, txn);
-        if(cursor.find(key))
-        {
-            _subscriberMap.del(txn, key);
-
-            SubscriberRecordKey k;
-            SubscriberRecord v;
-            while(cursor.get(k, v, MDB_NEXT) && k.topic == key.topic)
-            {
-                _subscriberMap.del(txn, k);
-            }
-        }
-
-        // Update the LLU.
-        if(master)
-        {
-            llu = getIncrementedLLU(txn, _lluMap);
-        }
-        else
-        {
-            llu = origLLU;
-            _lluMap.put(txn, lluDbKey, llu);
-        }
-
-        txn.commit();
+        DestroyTopicMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), _id, _name,
+                                      master ? 0 : &origLLU);
+        _instance->dbEnv().groupCommit(mutation);
+        llu = mutation.llu;
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1239,15 +1392,16 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
     }
 
     _instance->publishAdapter()->remove(_linkPrx->ice_getIdentity());
-    _instance->publishAdapter()->remove(_publisherPrx->ice_getIdentity());
+    _publishAdapter->remove(_publisherPrx->ice_getIdentity());
     _instance->topicReaper()->add(_name);
 
     // Destroy each of the subscribers.
     for(vector<SubscriberPtr>::const_iterator p = _subscribers.begin(); p != _subscribers.end(); ++p)
     {
-        (*p)->destroy();
+        (*p)->discard();
     }
     _subscribers.clear();
+    _index = 0;
 
     _instance->topicAdapter()->remove(_id);
 
@@ -1265,29 +1419,10 @@ TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
     bool found = false;
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
-        for(Ice::IdentitySeq::const_iterator id = ids.begin(); id != ids.end(); ++id)
-        {
-            SubscriberRecordKey key;
-            key.topic = _id;
-            key.id = *id;
-
-            if(_subscriberMap.del(txn, key))
-            {
-                found = true;
-            }
-        }
-
-        if(found)
-        {
-            llu = getIncrementedLLU(txn, _lluMap);
-            txn.commit();
-        }
-        else
-        {
-            txn.rollback();
-        }
+        RemoveSubscribersMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), _id, ids);
+        _instance->dbEnv().groupCommit(mutation);
+        found = mutation.found;
+        llu = mutation.llu;
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -1308,8 +1443,9 @@ TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
             vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), *id);
             if(p != _subscribers.end())
             {
-                (*p)->destroy();
+                (*p)->discard();
                 _subscribers.erase(p);
+                _index = 0;
             }
         }
 
@@ -22,6 +22,12 @@ typedef IceUtil::Handle<PersistentInstance> PersistentInstancePtr;
 class Subscriber;
 typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 
+class SubscriberIndex;
+typedef IceUtil::Handle<SubscriberIndex> SubscriberIndexPtr;
+
+class Shard;
+typedef IceUtil::Handle<Shard> ShardPtr;
+
 class TopicImpl : public IceUtil::Shared
 {
 public:
@@ -52,6 +58,14 @@ public:
     void shutdown();
     void publish(bool, const EventDataSeq&);
 
+    //
+    // Queue the events with the subscribers, the caller must hold a
+    // cached read of the replication node. Returns true if subscribers
+    // must be reaped by the given master.
+    //
+    bool queue(bool, const EventDataSeq&, const Ice::ObjectPrx&, Ice::IdentitySeq&);
+    void reapOnMaster(const Ice::ObjectPrx&, Ice::Long, const Ice::IdentitySeq&);
+
     // Observer methods.
     void observerAddSubscriber(const IceStormElection::LogUpdate&, const SubscriberRecord&);
     void observerRemoveSubscriber(const IceStormElection::LogUpdate&, const Ice::IdentitySeq&);
@@ -74,6 +88,8 @@ private:
     const PersistentInstancePtr _instance;
     const std::string _name; // The topic name
     const Ice::Identity _id; // The topic identity
+    const ShardPtr _shard; // The topic shard, null if the topics aren't sharded.
+    const Ice::ObjectAdapterPtr _publishAdapter; // The adapter of the publisher object.
 
     IceInternal::ObserverHelperT<IceStorm::Instrumentation::TopicObserver> _observer;
 
@@ -94,10 +110,17 @@ private:
     //
     std::vector<SubscriberPtr> _subscribers;
 
+    //
+    // The subscribers indexed by their filter, built on the next publish
+    // after the subscriber list changed.
+    //
+    SubscriberIndexPtr _index;
+
     bool _destroyed; // Has this Topic been destroyed?
 
     LLUMap _lluMap;
     SubscriberMap _subscriberMap;
+    LogMap _logMap;
 };
 
 typedef IceUtil::Handle<TopicImpl> TopicImplPtr;
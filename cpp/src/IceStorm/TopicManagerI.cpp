@@ -29,6 +29,71 @@ logError(const Ice::CommunicatorPtr& com, const IceDB::LMDBException& ex)
     error << "LMDB error: " << ex;
 }
 
+//
+// The number of times a full content sync is restarted because the
+// llu of the node changed while its chunks were retrieved. The content
+// is then retrieved with a single getContent call.
+//
+const int syncContentRetryMax = 3;
+
+//
+// The creation of a topic is group committed with the concurrent
+// updates of the topics. On the master the LLU is incremented, on a
+// replica the LLU of the master is stored.
+//
+class CreateTopicMutation : public IceDB::Mutation
+{
+public:
+
+    CreateTopicMutation(SubscriberMap& subscriberMap, LLUMap& lluMap, LogMap& logMap, int logSize,
+                        const Ice::Identity& topic, const string& name, const LogUpdate* masterLLU = 0) :
+        _subscriberMap(subscriberMap), _lluMap(lluMap), _logMap(logMap), _logSize(logSize), _topic(topic),
+        _name(name), _masterLLU(masterLLU)
+    {
+    }
+
+    virtual void
+    execute(const IceDB::ReadWriteTxn& txn)
+    {
+        SubscriberRecordKey key;
+        key.topic = _topic;
+        SubscriberRecord rec;
+        rec.link = false;
+        rec.cost = 0;
+
+        if(_masterLLU)
+        {
+            if(_subscriberMap.find(txn, key))
+            {
+                throw ObserverInconsistencyException("topic exists: " + _name);
+            }
+            _subscriberMap.put(txn, key, rec);
+
+            llu = *_masterLLU;
+            _lluMap.put(txn, lluDbKey, llu);
+        }
+        else
+        {
+            _subscriberMap.put(txn, key, rec);
+
+            llu = getIncrementedLLU(txn, _lluMap);
+        }
+        appendLog(txn, _logMap, _logSize, llu, LogOperationCreateTopic, _name);
+    }
+
+    LogUpdate llu;
+
+private:
+
+    SubscriberMap& _subscriberMap;
+    LLUMap& _lluMap;
+    LogMap& _logMap;
+    const int _logSize;
+    const Ice::Identity& _topic;
+    const string& _name;
+    const LogUpdate* _masterLLU;
+};
+
 class TopicManagerI : public TopicManagerInternal
 {
 public:
@@ -200,6 +265,16 @@ public:
         }
     }
 
+    virtual void initUpdates(const LogUpdate& llu, const LogRecordSeq& updates, const Ice::Current&)
+    {
+        NodeIPtr node = _instance->node();
+        if(node)
+        {
+            node->checkObserverInit(llu.generation);
+        }
+        _impl->observerInitUpdates(llu, updates);
+    }
+
 private:
 
     const PersistentInstancePtr _instance;
@@ -220,6 +295,17 @@ public:
         _impl->getContent(llu, content);
     }
 
+    virtual bool getUpdates(const LogUpdate& since, LogUpdate& llu, LogRecordSeq& updates, const Ice::Current&)
+    {
+        return _impl->getUpdates(since, llu, updates);
+    }
+
+    virtual bool getContentChunk(const string& start, int max, LogUpdate& llu, TopicContentSeq& content,
+                                 const Ice::Current&)
+    {
+        return _impl->getContentChunk(start, max, llu, content);
+    }
+
 private:
 
     const TopicManagerImplPtr _impl;
@@ -230,7 +316,8 @@ private:
 TopicManagerImpl::TopicManagerImpl(const PersistentInstancePtr& instance) :
     _instance(instance),
     _lluMap(instance->lluMap()),
-    _subscriberMap(instance->subscriberMap())
+    _subscriberMap(instance->subscriberMap()),
+    _logMap(instance->logMap())
 {
     try
     {
@@ -263,6 +350,10 @@ TopicManagerImpl::TopicManagerImpl(const PersistentInstancePtr& instance) :
             LogUpdate empty = {0, 0};
             _instance->lluMap().put(txn, lluDbKey, empty);
 
+            // The updates of the replication log followed the llu of the
+            // previous run, they can't be replicated from the reset llu.
+            _logMap.clear(txn);
+
             // Recreate each of the topics.
             SubscriberRecordKey k;
             SubscriberRecord v;
@@ -319,19 +410,9 @@ TopicManagerImpl::create(const string& name)
     LogUpdate llu;
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
-        SubscriberRecordKey key;
-        key.topic = id;
-        SubscriberRecord rec;
-        rec.link = false;
-        rec.cost = 0;
-
-        _subscriberMap.put(txn, key, rec);
-
-        llu = getIncrementedLLU(txn, _lluMap);
-
-        txn.commit();
+        CreateTopicMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), id, name);
+        _instance->dbEnv().groupCommit(mutation);
+        llu = mutation.llu;
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -413,6 +494,10 @@ TopicManagerImpl::observerInit(const LogUpdate& llu, const TopicContentSeq& cont
 
         _lluMap.put(txn, lluDbKey, llu);
 
+        // The replication log now starts with the initial state.
+        _logMap.clear(txn);
+        appendLog(txn, _logMap, _instance->logSize(), llu, LogOperationGeneration, "");
+
         _subscriberMap.clear(txn);
 
         for(TopicContentSeq::const_iterator p = content.begin(); p != content.end(); ++p)
@@ -503,23 +588,8 @@ TopicManagerImpl::observerCreateTopic(const LogUpdate& llu, const string& name)
 
     try
     {
-        IceDB::ReadWriteTxn txn(_instance->dbEnv());
-
-        SubscriberRecordKey key;
-        key.topic = id;
-        SubscriberRecord rec;
-        rec.link = false;
-        rec.cost = 0;
-
-        if(_subscriberMap.find(txn, key))
-        {
-            throw ObserverInconsistencyException("topic exists: " + name);
-        }
-        _subscriberMap.put(txn, key, rec);
-
-        _lluMap.put(txn, lluDbKey, llu);
-
-        txn.commit();
+        CreateTopicMutation mutation(_subscriberMap, _lluMap, _logMap, _instance->logSize(), id, name, &llu);
+        _instance->dbEnv().groupCommit(mutation);
     }
     catch(const IceDB::LMDBException& ex)
     {
@@ -581,6 +651,73 @@ TopicManagerImpl::observerRemoveSubscriber(const LogUpdate& llu, const string& n
     topic->observerRemoveSubscriber(llu, id);
 }
 
+void
+TopicManagerImpl::observerInitUpdates(const LogUpdate& llu, const LogRecordSeq& updates)
+{
+    Lock sync(*this);
+
+    TraceLevelsPtr traceLevels = _instance->traceLevels();
+    if(traceLevels->topicMgr > 0)
+    {
+        Ice::Trace out(traceLevels->logger, traceLevels->topicMgrCat);
+        out << "init with " << updates.size() << " updates llu: " << llu.generation << "/" << llu.iteration;
+    }
+
+    for(LogRecordSeq::const_iterator p = updates.begin(); p != updates.end(); ++p)
+    {
+        switch(p->op)
+        {
+        case LogOperationGeneration:
+            observerGeneration(p->llu);
+            break;
+        case LogOperationCreateTopic:
+            observerCreateTopic(p->llu, p->topic);
+            break;
+        case LogOperationDestroyTopic:
+            observerDestroyTopic(p->llu, p->topic);
+            break;
+        case LogOperationAddSubscriber:
+            observerAddSubscriber(p->llu, p->topic, p->record);
+            break;
+        case LogOperationRemoveSubscriber:
+            observerRemoveSubscriber(p->llu, p->topic, p->subscribers);
+            break;
+        }
+    }
+
+    // The updates normally end with the master llu, but a subscriber
+    // which was already present doesn't update the llu.
+    observerGeneration(llu);
+
+    // Clear the set of observers.
+    _instance->observers()->clear();
+}
+
+void
+TopicManagerImpl::observerGeneration(const LogUpdate& llu)
+{
+    try
+    {
+        IceDB::ReadWriteTxn txn(_instance->dbEnv());
+
+        LogUpdate current;
+        _lluMap.get(txn, lluDbKey, current);
+        if(current == llu)
+        {
+            return;
+        }
+        _lluMap.put(txn, lluDbKey, llu);
+        appendLog(txn, _logMap, _instance->logSize(), llu, LogOperationGeneration, "");
+
+        txn.commit();
+    }
+    catch(const IceDB::LMDBException& ex)
+    {
+        logError(_instance->communicator(), ex);
+        throw; // will become UnknownException in caller
+    }
+}
+
 void
 TopicManagerImpl::getContent(LogUpdate& llu, TopicContentSeq& content)
 {
@@ -608,6 +745,83 @@ TopicManagerImpl::getContent(LogUpdate& llu, TopicContentSeq& content)
     }
 }
 
+bool
+TopicManagerImpl::getUpdates(const LogUpdate& since, LogUpdate& llu, LogRecordSeq& updates)
+{
+    updates.clear();
+    try
+    {
+        IceDB::ReadOnlyTxn txn(_instance->dbEnv());
+        _lluMap.get(txn, lluDbKey, llu);
+        if(since == llu)
+        {
+            return true;
+        }
+        else if(llu < since)
+        {
+            return false;
+        }
+
+        //
+        // The log must contain the given llu, otherwise some of the
+        // updates which followed it are missing.
+        //
+        LogMapCursor cursor(_logMap, txn);
+        LogRecord rec;
+        if(!cursor.find(since, rec))
+        {
+            return false;
+        }
+
+        LogUpdate key;
+        while(cursor.get(key, rec, MDB_NEXT))
+        {
+            updates.push_back(rec);
+        }
+    }
+    catch(const IceDB::LMDBException& ex)
+    {
+        logError(_instance->communicator(), ex);
+        throw; // will become UnknownException in caller
+    }
+
+    if(updates.empty() || updates.back().llu != llu)
+    {
+        updates.clear();
+        return false;
+    }
+    return true;
+}
+
+bool
+TopicManagerImpl::getContentChunk(const string& start, int max, LogUpdate& llu, TopicContentSeq& content)
+{
+    Lock sync(*this);
+    reap();
+
+    content.clear();
+    map<string, TopicImplPtr>::const_iterator p = _topics.upper_bound(start);
+    size_t count = 0;
+    while(p != _topics.end() && (content.empty() || count < static_cast<size_t>(max)))
+    {
+        content.push_back(p->second->getContent());
+        count += content.back().records.size() + 1;
+        ++p;
+    }
+
+    try
+    {
+        IceDB::ReadOnlyTxn txn(_instance->dbEnv());
+        _lluMap.get(txn, lluDbKey, llu);
+    }
+    catch(const IceDB::LMDBException& ex)
+    {
+        logError(_instance->communicator(), ex);
+        throw; // will become UnknownException in caller
+    }
+    return p != _topics.end();
+}
+
 LogUpdate
 TopicManagerImpl::getLastLogUpdate() const
 {
@@ -630,12 +844,108 @@ void
 TopicManagerImpl::sync(const Ice::ObjectPrx& master)
 {
     TopicManagerSyncPrx sync = TopicManagerSyncPrx::uncheckedCast(master);
+    TraceLevelsPtr traceLevels = _instance->traceLevels();
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    //
+    // First try to only retrieve the updates which followed our llu
+    // from the replication log of the master.
+    //
+    LogUpdate since = getLastLogUpdate();
+    try
+    {
+        LogUpdate llu;
+        LogRecordSeq updates;
+        if(sync->getUpdates(since, llu, updates))
+        {
+            observerInitUpdates(llu, updates);
+
+            if(traceLevels->replication > 0)
+            {
+                Ice::Trace out(traceLevels->logger, traceLevels->replicationCat);
+                out << "synced " << updates.size() << " updates from llu " << since.generation << "/"
+                    << since.iteration << " to " << llu.generation << "/" << llu.iteration << " in "
+                    << (IceUtil::Time::now(IceUtil::Time::Monotonic) - start).toMilliSecondsDouble() << "ms";
+            }
+            return;
+        }
+    }
+    catch(const Ice::OperationNotExistException&)
+    {
+        // The master doesn't support incremental updates.
+        LogUpdate llu;
+        TopicContentSeq content;
+        sync->getContent(llu, content);
+        observerInit(llu, content);
+        return;
+    }
+    catch(const ObserverInconsistencyException& ex)
+    {
+        if(traceLevels->replication > 0)
+        {
+            Ice::Trace out(traceLevels->logger, traceLevels->replicationCat);
+            out << "incremental sync failed: " << ex.reason << ", syncing the full content";
+        }
+    }
+
+    int chunks = syncContent(sync);
 
+    if(traceLevels->replication > 0)
+    {
+        LogUpdate llu = getLastLogUpdate();
+        Ice::Trace out(traceLevels->logger, traceLevels->replicationCat);
+        out << "synced the full content from llu " << since.generation << "/" << since.iteration << " to "
+            << llu.generation << "/" << llu.iteration << " in " << chunks << " chunks in "
+            << (IceUtil::Time::now(IceUtil::Time::Monotonic) - start).toMilliSecondsDouble() << "ms";
+    }
+}
+
+int
+TopicManagerImpl::syncContent(const TopicManagerSyncPrx& sync)
+{
+    //
+    // Retrieve the content in chunks. The node we sync with takes part
+    // in the election and doesn't accept updates while we sync. If its
+    // llu changes anyway, the chunks are retrieved again, but only a few
+    // times: a node which keeps changing is then synced with a single
+    // getContent call rather than starving this node.
+    //
     LogUpdate llu;
     TopicContentSeq content;
-    sync->getContent(llu, content);
+    string start;
+    int chunks = 0;
+    int retry = 0;
+    bool more = true;
+    while(more)
+    {
+        LogUpdate chunkLlu;
+        TopicContentSeq chunk;
+        more = sync->getContentChunk(start, _instance->syncChunkSize(), chunkLlu, chunk);
+        ++chunks;
+        if(chunks > 1 && chunkLlu != llu)
+        {
+            if(++retry > syncContentRetryMax)
+            {
+                content.clear();
+                sync->getContent(llu, content);
+                observerInit(llu, content);
+                return chunks + 1;
+            }
+            content.clear();
+            start.clear();
+            more = true;
+            continue;
+        }
+        llu = chunkLlu;
+        if(!chunk.empty())
+        {
+            start = identityToTopicName(chunk.back().id);
+            content.insert(content.end(), chunk.begin(), chunk.end());
+        }
+    }
 
     observerInit(llu, content);
+    return chunks;
 }
 
 void
@@ -672,6 +982,20 @@ TopicManagerImpl::initMaster(const set<GroupNodeInfo>& slaves, const LogUpdate&
 
         _lluMap.put(txn, lluDbKey, llu);
 
+        // The new generation must follow the updates of the log, if
+        // the log has updates past it they can't be replicated.
+        {
+            LogMapCursor cursor(_logMap, txn);
+            LogUpdate last;
+            LogRecord rec;
+            if(cursor.get(last, rec, MDB_LAST) && !(last < llu))
+            {
+                cursor.close();
+                _logMap.clear(txn);
+            }
+        }
+        appendLog(txn, _logMap, _instance->logSize(), llu, LogOperationGeneration, "");
+
         txn.commit();
     }
     catch(const IceDB::LMDBException& ex)
@@ -680,8 +1004,21 @@ TopicManagerImpl::initMaster(const set<GroupNodeInfo>& slaves, const LogUpdate&
         throw; // will become UnknownException in caller
     }
 
+    // Slaves for which the log has all the updates since their llu
+    // only receive these updates.
+    map<int, LogRecordSeq> updates;
+    for(set<GroupNodeInfo>::const_iterator p = slaves.begin(); p != slaves.end(); ++p)
+    {
+        LogUpdate last;
+        LogRecordSeq u;
+        if(getUpdates(p->llu, last, u))
+        {
+            updates[p->id].swap(u);
+        }
+    }
+
     // Now initialize the observers.
-    _instance->observers()->init(slaves, llu, content);
+    _instance->observers()->init(slaves, llu, content, updates);
 }
 
 Ice::ObjectPrx
@@ -49,9 +49,13 @@ public:
     void observerAddSubscriber(const IceStormElection::LogUpdate&, const std::string&,
                                const IceStorm::SubscriberRecord&);
     void observerRemoveSubscriber(const IceStormElection::LogUpdate&, const std::string&, const Ice::IdentitySeq&);
+    void observerInitUpdates(const IceStormElection::LogUpdate&, const IceStormElection::LogRecordSeq&);
 
     // Sync methods.
     void getContent(IceStormElection::LogUpdate&, IceStormElection::TopicContentSeq&);
+    bool getUpdates(const IceStormElection::LogUpdate&, IceStormElection::LogUpdate&,
+                    IceStormElection::LogRecordSeq&);
+    bool getContentChunk(const std::string&, int, IceStormElection::LogUpdate&, IceStormElection::TopicContentSeq&);
 
     // Replica methods.
     virtual IceStormElection::LogUpdate getLastLogUpdate() const;
@@ -70,6 +74,8 @@ private:
 
     void updateTopicObservers();
     void updateSubscriberObservers();
+    void observerGeneration(const IceStormElection::LogUpdate&);
+    int syncContent(const IceStormElection::TopicManagerSyncPrx&);
 
     TopicPrx installTopic(const std::string&, const Ice::Identity&, bool,
                           const IceStorm::SubscriberRecordSeq& = IceStorm::SubscriberRecordSeq());
@@ -86,6 +92,7 @@ private:
 
     LLUMap _lluMap;
     SubscriberMap _subscriberMap;
+    LogMap _logMap;
 };
 typedef IceUtil::Handle<TopicManagerImpl> TopicManagerImplPtr;
 
@@ -96,6 +96,7 @@ TransientTopicImpl::TransientTopicImpl(
     _instance(instance),
     _name(name),
     _id(id),
+    _publishAdapter(_instance->publishAdapter(name)),
     _destroyed(false)
 {
     //
@@ -125,7 +126,7 @@ TransientTopicImpl::TransientTopicImpl(
         linkid.name = _name + ".link";
     }
 
-    _publisherPrx = _instance->publishAdapter()->add(new TransientPublisherI(this), pubid);
+    _publisherPrx = _publishAdapter->add(new TransientPublisherI(this), pubid);
     _linkPrx = TopicLinkPrx::uncheckedCast(_instance->publishAdapter()->add(new TransientTopicLinkI(this), linkid));
 }
 
@@ -243,17 +244,23 @@ TransientTopicImpl::subscribe(const QoS& origQoS, const Ice::ObjectPrx& obj, con
     record.link = false;
     record.cost = 0;
 
+    //
+    // The new subscriber is created first, an invalid QoS leaves the
+    // existing subscriber in place.
+    //
+    SubscriberPtr subscriber = Subscriber::create(_instance, record);
+
     vector<SubscriberPtr>::iterator p = find(_subscribers.begin(), _subscribers.end(), record.id);
     if(p != _subscribers.end())
     {
-        // If we already have this subscriber remove it from our
-        // subscriber list and remove it from the database.
+        // If we already have this subscriber replace it in our
+        // subscriber list.
         (*p)->destroy();
         _subscribers.erase(p);
     }
 
-    SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _index = 0;
 }
 
 Ice::ObjectPrx
@@ -310,6 +317,7 @@ TransientTopicImpl::subscribeAndGetPublisher(const QoS& qos, const Ice::ObjectPr
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _index = 0;
 
     return subscriber->proxy();
 }
@@ -349,6 +357,7 @@ TransientTopicImpl::unsubscribe(const Ice::ObjectPrx& subscriber, const Ice::Cur
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        _index = 0;
     }
 }
 
@@ -393,6 +402,7 @@ TransientTopicImpl::link(const TopicPrx& topic, Ice::Int cost, const Ice::Curren
 
     SubscriberPtr subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    _index = 0;
 }
 
 void
@@ -434,6 +444,7 @@ TransientTopicImpl::unlink(const TopicPrx& topic, const Ice::Current&)
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        _index = 0;
     }
 }
 
@@ -491,7 +502,7 @@ TransientTopicImpl::destroy(const Ice::Current&)
     try
     {
         _instance->publishAdapter()->remove(_linkPrx->ice_getIdentity());
-        _instance->publishAdapter()->remove(_publisherPrx->ice_getIdentity());
+        _publishAdapter->remove(_publisherPrx->ice_getIdentity());
     }
     catch(const Ice::ObjectAdapterDeactivatedException&)
     {
@@ -504,6 +515,7 @@ TransientTopicImpl::destroy(const Ice::Current&)
         (*p)->destroy();
     }
     _subscribers.clear();
+    _index = 0;
 }
 
 void
@@ -532,20 +544,26 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
     // Copy of the subscriber list so that event publishing can occur
     // in parallel.
     //
-    vector<SubscriberPtr> copy;
+    SubscriberIndexPtr index;
     {
         Lock sync(*this);
-        copy = _subscribers;
+        if(!_index)
+        {
+            _index = new SubscriberIndex(_subscribers);
+        }
+        index = _index;
     }
 
     //
-    // Queue each event, gathering a list of those subscribers that
-    // must be reaped.
+    // Queue each event with the subscribers whose filter matches it,
+    // gathering a list of those subscribers that must be reaped.
     //
+    vector<SubscriberPtr> failed;
+    index->queue(forwarded, events, failed);
     vector<Ice::Identity> e;
-    for(vector<SubscriberPtr>::const_iterator p = copy.begin(); p != copy.end(); ++p)
+    for(vector<SubscriberPtr>::const_iterator p = failed.begin(); p != failed.end(); ++p)
     {
-        if(!(*p)->queue(forwarded, events) && (*p)->reap())
+        if((*p)->reap())
         {
             e.push_back((*p)->id());
         }
@@ -583,6 +601,7 @@ TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
                 //
                 subscriber->destroy();
                 _subscribers.erase(q);
+                _index = 0;
             }
         }
     }
@@ -17,6 +17,9 @@ typedef IceUtil::Handle<Instance> InstancePtr;
 class Subscriber;
 typedef IceUtil::Handle<Subscriber> SubscriberPtr;
 
+class SubscriberIndex;
+typedef IceUtil::Handle<SubscriberIndex> SubscriberIndexPtr;
+
 class TransientTopicImpl : public TopicInternal, public IceUtil::Mutex
 {
 public:
@@ -53,6 +56,7 @@ private:
     const InstancePtr _instance;
     const std::string _name; // The topic name
     const Ice::Identity _id; // The topic identity
+    const Ice::ObjectAdapterPtr _publishAdapter; // The adapter of the publisher object.
 
     /*const*/ Ice::ObjectPrx _publisherPrx;
     /*const*/ TopicLinkPrx _linkPrx;
@@ -66,6 +70,12 @@ private:
     //
     std::vector<SubscriberPtr> _subscribers;
 
+    //
+    // The subscribers indexed by their filter, built on the next publish
+    // after the subscriber list changed.
+    //
+    SubscriberIndexPtr _index;
+
     bool _destroyed; // Has this Topic been destroyed?
 };
 
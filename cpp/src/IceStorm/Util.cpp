@@ -85,6 +85,26 @@ IceStormInternal::compareSubscriberRecordKey(const MDB_val* v1, const MDB_val* v
     }
 }
 
+int
+IceStormInternal::compareLogUpdate(const MDB_val* v1, const MDB_val* v2)
+{
+    IceStormElection::LogUpdate k1, k2;
+    IceDB::Codec<IceStormElection::LogUpdate, IceDB::IceContext, Ice::OutputStream>::read(k1, *v1, dbContext);
+    IceDB::Codec<IceStormElection::LogUpdate, IceDB::IceContext, Ice::OutputStream>::read(k2, *v2, dbContext);
+    if(k1 < k2)
+    {
+        return -1;
+    }
+    else if(k1 == k2)
+    {
+        return 0;
+    }
+    else
+    {
+        return 1;
+    }
+}
+
 IceStormElection::LogUpdate
 IceStormInternal::getIncrementedLLU(const IceDB::ReadWriteTxn& txn, LLUMap& lluMap)
 {
@@ -94,3 +114,35 @@ IceStormInternal::getIncrementedLLU(const IceDB::ReadWriteTxn& txn, LLUMap& lluM
     lluMap.put(txn, lluDbKey, llu);
     return llu;
 }
+
+void
+IceStormInternal::appendLog(const IceDB::ReadWriteTxn& txn, LogMap& logMap, int max,
+                            const IceStormElection::LogUpdate& llu, IceStormElection::LogOperation op,
+                            const string& topic, const SubscriberRecord& record, const Ice::IdentitySeq& subscribers)
+{
+    if(max <= 0)
+    {
+        return;
+    }
+
+    IceStormElection::LogRecord rec;
+    rec.llu = llu;
+    rec.op = op;
+    rec.topic = topic;
+    rec.record = record;
+    rec.subscribers = subscribers;
+    logMap.put(txn, llu, rec);
+
+    MDB_stat st;
+    if(mdb_stat(txn.mtxn(), logMap.mdbi(), &st) == 0 && st.ms_entries > static_cast<size_t>(max))
+    {
+        size_t count = st.ms_entries - static_cast<size_t>(max);
+        LogMapRWCursor cursor(logMap, txn);
+        IceStormElection::LogUpdate k;
+        IceStormElection::LogRecord v;
+        for(bool more = cursor.get(k, v, MDB_FIRST); more && count > 0; more = cursor.get(k, v, MDB_NEXT), --count)
+        {
+            cursor.del();
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include <IceDB/IceDB.h>
 #include <IceStorm/LLURecord.h>
 #include <IceStorm/SubscriberRecord.h>
+#include <IceStorm/Election.h>
 
 namespace IceStorm
 {
@@ -22,6 +23,8 @@ typedef IceUtil::Handle<Instance> InstancePtr;
 typedef IceDB::Dbi<IceStorm::SubscriberRecordKey, IceStorm::SubscriberRecord, IceDB::IceContext, Ice::OutputStream>
         SubscriberMap;
 typedef IceDB::Dbi<std::string, IceStormElection::LogUpdate, IceDB::IceContext, Ice::OutputStream> LLUMap;
+typedef IceDB::Dbi<IceStormElection::LogUpdate, IceStormElection::LogRecord, IceDB::IceContext, Ice::OutputStream>
+        LogMap;
 
 const std::string lluDbKey = "_manager";
 
@@ -42,9 +45,22 @@ describeEndpoints(const Ice::ObjectPrx&);
 int
 compareSubscriberRecordKey(const MDB_val* v1, const MDB_val* v2);
 
+int
+compareLogUpdate(const MDB_val* v1, const MDB_val* v2);
+
 IceStormElection::LogUpdate
 getIncrementedLLU(const IceDB::ReadWriteTxn&, IceStorm::LLUMap&);
 
+//
+// Record an update in the replication log. The oldest records are
+// removed to keep the log to the given maximum number of records.
+//
+void
+appendLog(const IceDB::ReadWriteTxn&, IceStorm::LogMap&, int, const IceStormElection::LogUpdate&,
+          IceStormElection::LogOperation, const std::string&,
+          const IceStorm::SubscriberRecord& = IceStorm::SubscriberRecord(),
+          const Ice::IdentitySeq& = Ice::IdentitySeq());
+
 }
 
 #endif
@@ -2588,7 +2588,8 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
         << ", del, cookie, sync);";
     C << nl << "try";
     C << sb;
-    C << nl << "result->prepare(" << flatName << ", " << operationModeToString(p->sendMode()) << ", context);";
+    C << nl << "result->prepare(" << flatName << ", ice_staticId(), " << operationModeToString(p->sendMode())
+      << ", context);";
     if(inParams.empty())
     {
         C << nl << "result->writeEmptyParams();";
@@ -7130,7 +7131,7 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
         C << "shared_from_this(), read, ex, sent);";
         C << sp;
 
-        C << nl << "outAsync->invoke(" << flatName << ", ";
+        C << nl << "outAsync->invoke(" << flatName << ", ice_staticId(), ";
         C << operationModeToString(p->sendMode(), true) << ", " << opFormatTypeToString(p, true) << ", context,";
         C.inc();
         C << nl;
@@ -7204,7 +7205,7 @@ Slice::Gen::Cpp11ProxyVisitor::visitOperation(const OperationPtr& p)
     {
         C << nl << "_checkTwowayOnly(" << flatName << ");";
     }
-    C << nl << "outAsync->invoke(" << flatName << ", ";
+    C << nl << "outAsync->invoke(" << flatName << ", ice_staticId(), ";
     C << getUnqualified(operationModeToString(p->sendMode(), true), clScope) << ", "
       << getUnqualified(opFormatTypeToString(p, true), clScope) << ", context,";
     C.inc();
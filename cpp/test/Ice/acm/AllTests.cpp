@@ -764,6 +764,47 @@ allTests(Test::TestHelper* helper)
         (*p)->destroy();
     }
 
+#ifdef TEST_PERF
+    {
+        //
+        // The number of connections can be changed with the
+        // Test.IdleConnections property. The file descriptor limits
+        // of the client and server must allow as many connections.
+        //
+        const int count = communicator->getProperties()->getPropertyAsIntWithDefault("Test.IdleConnections", 100000);
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter(0, -1, -1);
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ACM.Client.Timeout", "2");
+        initData.properties->setProperty("Ice.ACM.Client.Close", "2"); // CloseOnInvocation
+        initData.properties->setProperty("Ice.ACM.Client.Heartbeat", "1"); // HeartbeatOnDispatch
+        Ice::CommunicatorHolder ich(initData);
+        TestIntfPrxPtr proxy = ICE_UNCHECKED_CAST(TestIntfPrx, ich->stringToProxy(
+                                                      adapter->getTestIntf()->ice_toString()));
+
+        cout << "testing connection monitoring with " << count << " idle connections... " << flush;
+        for(int i = 0; i < count; ++i)
+        {
+            proxy->ice_connectionId(toString(i))->ice_getConnection();
+        }
+
+        //
+        // Measure the CPU time used by the client while the connections
+        // are idle, it's mostly spent by the connection monitor. We
+        // first wait for the connection establishment to complete.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::seconds(5));
+        const int seconds = 10;
+        clock_t start = clock();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::seconds(seconds));
+        clock_t cpu = clock() - start;
+        cout << static_cast<double>(cpu) * 1000 / CLOCKS_PER_SEC << " ms CPU in " << seconds << "s ok" << endl;
+
+        adapter->deactivate();
+    }
+#endif
+
     cout << "shutting down... " << flush;
     com->shutdown();
     cout << "ok" << endl;
@@ -36,6 +36,73 @@ private:
 
 ICE_DEFINE_PTR(PingReplyIPtr, PingReplyI);
 
+//
+// Holds the first ping received after hold() until release() is
+// called.
+//
+class HedgePingReplyI : public Test::PingReply
+{
+public:
+
+    HedgePingReplyI() :
+        _hold(false),
+        _released(false),
+        _count(0)
+    {
+    }
+
+    virtual void reply(const Ice::Current&)
+    {
+    }
+
+    virtual void ice_ping(const Ice::Current&) const
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        ++_count;
+        if(_hold)
+        {
+            _hold = false;
+            while(!_released)
+            {
+                if(!_monitor.timedWait(IceUtil::Time::seconds(10)))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    void hold()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _hold = true;
+        _released = false;
+        _count = 0;
+    }
+
+    void release()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _released = true;
+        _monitor.notifyAll();
+    }
+
+    int getCount()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        return _count;
+    }
+
+private:
+
+    mutable IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    mutable bool _hold;
+    bool _released;
+    mutable int _count;
+};
+
+ICE_DEFINE_PTR(HedgePingReplyIPtr, HedgePingReplyI);
+
 enum ThrowType { LocalException, UserException, StandardException, OtherException };
 
 #ifdef ICE_CPP11_MAPPING
@@ -2453,6 +2520,114 @@ allTests(Test::TestHelper* helper, bool collocated)
         cout << "ok" << endl;
     }
 
+    if(p->ice_getConnection() && protocol != "bt")
+    {
+        cout << "testing connection pool... " << flush;
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.Default.ConnectionPoolSize", "2");
+            Ice::CommunicatorHolder ich(initData);
+
+            auto q = Ice::uncheckedCast<Test::TestIntfPrx>(ich->stringToProxy(communicator->proxyToString(p)));
+            auto con = q->ice_getConnection();
+
+            //
+            // Once the first connection has a pending request, a second
+            // connection is established and used for the next requests.
+            //
+            auto s = make_shared<promise<void>>();
+            auto sent = make_shared<promise<void>>();
+            q->startDispatchAsync([s]() { s->set_value(); },
+                                  [s](exception_ptr ex) { s->set_exception(ex); },
+                                  [sent](bool) { sent->set_value(); });
+            auto f = s->get_future();
+            sent->get_future().get();
+
+            auto con2 = q->ice_getConnection();
+            for(int i = 0; i < 200 && con2 == con; ++i)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+                con2 = q->ice_getConnection();
+            }
+            test(con2 != con);
+            q->ice_ping();
+            test(q->ice_getConnection() == con2);
+
+            q->finishDispatch();
+            f.get();
+        }
+        cout << "ok" << endl;
+
+        cout << "testing hedged invocations... " << flush;
+        for(int i = 0; i < 2; ++i)
+        {
+            //
+            // Hedging is enabled with the Hedge proxy property or with
+            // the Ice.Hedge.Operations property.
+            //
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            if(i == 1)
+            {
+                initData.properties->setProperty("Ice.Hedge.Operations", "ice_ping");
+            }
+            initData.properties->setProperty("Ice.Hedge.MinDelay", "50");
+            initData.properties->setProperty("Ice.Hedge.Budget", "100");
+            initData.properties->setProperty("HedgeAdapter.Endpoints", "default");
+            initData.properties->setProperty("HedgeAdapter.ThreadPool.Size", "2");
+            Ice::CommunicatorHolder ich(initData);
+
+            auto adapter = ich->createObjectAdapter("HedgeAdapter");
+            auto servant = make_shared<HedgePingReplyI>();
+            auto q = adapter->addWithUUID(servant)->ice_collocationOptimized(false);
+            adapter->activate();
+
+            auto hedged = q;
+            if(i == 0)
+            {
+                ich->getProperties()->setProperty("Hedged.Proxy", ich->proxyToString(q));
+                ich->getProperties()->setProperty("Hedged.Proxy.Hedge", "1");
+                ich->getProperties()->setProperty("Hedged.Proxy.CollocationOptimized", "0");
+                hedged = ich->propertyToProxy("Hedged.Proxy");
+            }
+
+            //
+            // The invocations are hedged once enough latencies are known.
+            //
+            for(int j = 0; j < 30; ++j)
+            {
+                hedged->ice_ping();
+            }
+
+            //
+            // The reply to the hedged request completes the invocation
+            // while the first request is held.
+            //
+            servant->hold();
+            IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            hedged->ice_ping();
+            test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::seconds(5));
+            test(servant->getCount() == 2);
+            servant->release();
+
+            if(i == 0)
+            {
+                //
+                // The invocations of a proxy without the Hedge property
+                // aren't hedged.
+                //
+                servant->hold();
+                auto r = q->ice_pingAsync();
+                test(r.wait_for(chrono::milliseconds(500)) == future_status::timeout);
+                test(servant->getCount() == 1);
+                servant->release();
+                r.get();
+            }
+        }
+        cout << "ok" << endl;
+    }
+
     p->shutdown();
 
 #else
@@ -4136,6 +4311,111 @@ allTests(Test::TestHelper* helper, bool collocated)
         cout << "ok" << endl;
     }
 
+    if(p->ice_getConnection() && protocol != "bt")
+    {
+        cout << "testing connection pool... " << flush;
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.Default.ConnectionPoolSize", "2");
+            Ice::CommunicatorHolder ich(initData);
+
+            Test::TestIntfPrx q = Test::TestIntfPrx::uncheckedCast(
+                ich->stringToProxy(communicator->proxyToString(p)));
+            Ice::ConnectionPtr con = q->ice_getConnection();
+
+            //
+            // Once the first connection has a pending request, a second
+            // connection is established and used for the next requests.
+            //
+            Ice::AsyncResultPtr r = q->begin_startDispatch();
+            r->waitForSent();
+
+            Ice::ConnectionPtr con2 = q->ice_getConnection();
+            for(int i = 0; i < 200 && con2 == con; ++i)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+                con2 = q->ice_getConnection();
+            }
+            test(con2 != con);
+            q->ice_ping();
+            test(q->ice_getConnection() == con2);
+
+            q->finishDispatch();
+            q->end_startDispatch(r);
+        }
+        cout << "ok" << endl;
+
+        cout << "testing hedged invocations... " << flush;
+        for(int i = 0; i < 2; ++i)
+        {
+            //
+            // Hedging is enabled with the Hedge proxy property or with
+            // the Ice.Hedge.Operations property.
+            //
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            if(i == 1)
+            {
+                initData.properties->setProperty("Ice.Hedge.Operations", "ice_ping");
+            }
+            initData.properties->setProperty("Ice.Hedge.MinDelay", "50");
+            initData.properties->setProperty("Ice.Hedge.Budget", "100");
+            initData.properties->setProperty("HedgeAdapter.Endpoints", "default");
+            initData.properties->setProperty("HedgeAdapter.ThreadPool.Size", "2");
+            Ice::CommunicatorHolder ich(initData);
+
+            Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("HedgeAdapter");
+            HedgePingReplyIPtr servant = new HedgePingReplyI();
+            Ice::ObjectPrx q = adapter->addWithUUID(servant)->ice_collocationOptimized(false);
+            adapter->activate();
+
+            Ice::ObjectPrx hedged = q;
+            if(i == 0)
+            {
+                ich->getProperties()->setProperty("Hedged.Proxy", ich->proxyToString(q));
+                ich->getProperties()->setProperty("Hedged.Proxy.Hedge", "1");
+                ich->getProperties()->setProperty("Hedged.Proxy.CollocationOptimized", "0");
+                hedged = ich->propertyToProxy("Hedged.Proxy");
+            }
+
+            //
+            // The invocations are hedged once enough latencies are known.
+            //
+            for(int j = 0; j < 30; ++j)
+            {
+                hedged->ice_ping();
+            }
+
+            //
+            // The reply to the hedged request completes the invocation
+            // while the first request is held.
+            //
+            servant->hold();
+            IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            hedged->ice_ping();
+            test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::seconds(5));
+            test(servant->getCount() == 2);
+            servant->release();
+
+            if(i == 0)
+            {
+                //
+                // The invocations of a proxy without the Hedge property
+                // aren't hedged.
+                //
+                servant->hold();
+                Ice::AsyncResultPtr r = q->begin_ice_ping();
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+                test(!r->isCompleted());
+                test(servant->getCount() == 1);
+                servant->release();
+                q->end_ice_ping(r);
+            }
+        }
+        cout << "ok" << endl;
+    }
+
     p->shutdown();
 #endif
 }
@@ -822,6 +822,110 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing parallel connection establishment... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectStaggerDelay", "100");
+        Ice::CommunicatorHolder ich(initData);
+
+        //
+        // The adapter isn't activated: it listens but it never validates
+        // the connections.
+        //
+        Ice::ObjectAdapterPtr hung = ich->createObjectAdapterWithEndpoints("Hung", "default");
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter91", "default");
+
+        Ice::EndpointSeq endpoints = hung->getEndpoints();
+        Ice::EndpointSeq edpts = adapter->getTestIntf()->ice_getEndpoints();
+        endpoints.insert(endpoints.end(), edpts.begin(), edpts.end());
+
+        Ice::ObjectPrxPtr obj = ich->stringToProxy(communicator->proxyToString(adapter->getTestIntf()));
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx, obj->ice_endpoints(endpoints)->
+                                                 ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered))->
+                                                 ice_collocationOptimized(false));
+
+        //
+        // Without the stagger delay, each connection establishment waits
+        // for the connect timeout of the first endpoint.
+        //
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < 5; i++)
+        {
+            test(test->getAdapterName() == "Adapter91");
+            test->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        }
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::seconds(10));
+
+        test = ICE_UNCHECKED_CAST(TestIntfPrx,
+                                  test->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Random)));
+        for(int i = 0; i < 5; i++)
+        {
+            test(getAdapterNameWithAMI(test) == "Adapter91");
+            test->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        }
+
+        //
+        // The connection establishment fails once all the attempts failed.
+        //
+        com->deactivateObjectAdapter(adapter);
+        try
+        {
+            test->ice_timeout(500)->ice_ping();
+            test(false);
+        }
+        catch(const Ice::ConnectFailedException&)
+        {
+        }
+        catch(const Ice::ConnectTimeoutException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing circuit breaker... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.CircuitBreaker.Failures", "1");
+        initData.properties->setProperty("Ice.CircuitBreaker.Backoff", "2000");
+        Ice::CommunicatorHolder ich(initData);
+
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter101", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter102", "default"));
+
+        Ice::ObjectPrxPtr obj = ich->stringToProxy(communicator->proxyToString(createTestIntfPrx(adapters)));
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx, obj->ice_endpointSelection(
+                                                     Ice::ICE_ENUM(EndpointSelectionType, Ordered)));
+        test(test->getAdapterName() == "Adapter101");
+        Ice::EndpointSeq endpoints = test->ice_getEndpoints();
+
+        //
+        // The connection establishment to the first endpoint fails and
+        // the endpoint is ejected.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        test(test->ice_connectionId("1")->getAdapterName() == "Adapter102");
+
+        //
+        // The ejected endpoint is tried last until the backoff expires,
+        // even if it's available again.
+        //
+        adapters[0] = com->createObjectAdapter("Adapter103", endpoints[0]->toString());
+        test(test->ice_connectionId("2")->getAdapterName() == "Adapter102");
+
+        //
+        // Once the backoff expired, the endpoint is used again.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(2500));
+        test(test->ice_connectionId("3")->getAdapterName() == "Adapter103");
+        test(test->ice_connectionId("4")->getAdapterName() == "Adapter103");
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
     if(!communicator->getProperties()->getProperty("Ice.Plugin.IceSSL").empty() &&
        communicator->getProperties()->getProperty("Ice.Default.Protocol") == "ssl")
     {
@@ -327,6 +327,167 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing dispatch priorities... " << flush;
+    {
+        HoldPrxPtr holdPriorities =
+            ICE_UNCHECKED_CAST(HoldPrx, communicator->stringToProxy("hold:" + helper->getTestEndpoint(2)));
+        Ice::Context high;
+        high["_priority"] = "1";
+
+        //
+        // The adapter dispatches one request at a time, the high
+        // priority request is dispatched before the low priority
+        // request queued before it. The first request is dispatched
+        // before the other requests are sent.
+        //
+        holdPriorities->set(0, 0);
+#ifdef ICE_CPP11_MAPPING
+        auto r1 = holdPriorities->setAsync(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        auto r2 = holdPriorities->setAsync(2, 0);
+        auto r3 = holdPriorities->setAsync(3, 0, high);
+        test(r1.get() == 0);
+        test(r3.get() == 1);
+        test(r2.get() == 3);
+#else
+        Ice::AsyncResultPtr r1 = holdPriorities->begin_set(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        Ice::AsyncResultPtr r2 = holdPriorities->begin_set(2, 0);
+        Ice::AsyncResultPtr r3 = holdPriorities->begin_set(3, 0, high);
+        test(holdPriorities->end_set(r1) == 0);
+        test(holdPriorities->end_set(r3) == 1);
+        test(holdPriorities->end_set(r2) == 3);
+#endif
+
+        //
+        // The low priority request is rejected once it's queued for
+        // longer than DispatchQueueTimeMax. The rejected request would
+        // be retried, the requests are sent with a communicator which
+        // doesn't retry.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.RetryIntervals", "-1");
+        Ice::CommunicatorHolder ich(initData);
+        holdPriorities = ICE_UNCHECKED_CAST(HoldPrx, ich->stringToProxy("hold:" + helper->getTestEndpoint(2)));
+
+        holdPriorities->set(0, 0);
+#ifdef ICE_CPP11_MAPPING
+        r1 = holdPriorities->setAsync(1, 1500);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        r2 = holdPriorities->setAsync(2, 0);
+        r3 = holdPriorities->setAsync(3, 0, high);
+        test(r1.get() == 0);
+        try
+        {
+            r2.get();
+            test(false);
+        }
+        catch(const Ice::ServerOverloadedException& ex)
+        {
+            test(!ex.reason.empty() && ex.operation == "set");
+        }
+        test(r3.get() == 1);
+#else
+        r1 = holdPriorities->begin_set(1, 1500);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        r2 = holdPriorities->begin_set(2, 0);
+        r3 = holdPriorities->begin_set(3, 0, high);
+        test(holdPriorities->end_set(r1) == 0);
+        try
+        {
+            holdPriorities->end_set(r2);
+            test(false);
+        }
+        catch(const Ice::ServerOverloadedException& ex)
+        {
+            test(!ex.reason.empty() && ex.operation == "set");
+        }
+        test(holdPriorities->end_set(r3) == 1);
+#endif
+    }
+    cout << "ok" << endl;
+
+    cout << "testing concurrency limit... " << flush;
+    {
+        HoldPrxPtr holdLimit =
+            ICE_UNCHECKED_CAST(HoldPrx, communicator->stringToProxy("hold:" + helper->getTestEndpoint(3)));
+
+        //
+        // The adapter dispatches one request at a time, the requests
+        // received while a request is dispatched are rejected. The
+        // rejected request is retried once and rejected again.
+        //
+        holdLimit->set(0, 0);
+#ifdef ICE_CPP11_MAPPING
+        auto r1 = holdLimit->setAsync(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        try
+        {
+            holdLimit->set(2, 0);
+            test(false);
+        }
+        catch(const Ice::ServerOverloadedException& ex)
+        {
+            test(!ex.reason.empty() && ex.operation == "set");
+        }
+        test(r1.get() == 0);
+#else
+        Ice::AsyncResultPtr r1 = holdLimit->begin_set(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        try
+        {
+            holdLimit->set(2, 0);
+            test(false);
+        }
+        catch(const Ice::ServerOverloadedException& ex)
+        {
+            test(!ex.reason.empty() && ex.operation == "set");
+        }
+        test(holdLimit->end_set(r1) == 0);
+#endif
+        test(holdLimit->set(3, 0) == 1);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing retry of overload rejections on another endpoint... " << flush;
+    {
+        HoldPrxPtr holdLimit =
+            ICE_UNCHECKED_CAST(HoldPrx, communicator->stringToProxy("hold:" + helper->getTestEndpoint(3)));
+        HoldPrxPtr holdOther =
+            ICE_UNCHECKED_CAST(HoldPrx, communicator->stringToProxy("hold:" + helper->getTestEndpoint(4)));
+        HoldPrxPtr holdReplicated = ICE_UNCHECKED_CAST(HoldPrx, communicator->stringToProxy(
+            "hold:" + helper->getTestEndpoint(3) + ":" + helper->getTestEndpoint(4)));
+        holdReplicated = holdReplicated->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered));
+
+        //
+        // The request rejected by the overloaded adapter isn't
+        // dispatched, it's retried on the other endpoint even though
+        // the operation isn't idempotent.
+        //
+        holdLimit->set(0, 0);
+        holdOther->set(10, 0);
+#ifdef ICE_CPP11_MAPPING
+        auto r1 = holdLimit->setAsync(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        test(holdReplicated->set(2, 0) == 10);
+        test(r1.get() == 0);
+#else
+        Ice::AsyncResultPtr r1 = holdLimit->begin_set(1, 1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(200));
+        test(holdReplicated->set(2, 0) == 10);
+        test(holdLimit->end_set(r1) == 0);
+#endif
+        test(holdLimit->set(3, 0) == 1);
+        test(holdOther->set(0, 0) == 2);
+
+        //
+        // Without overload, the request is sent to the first endpoint.
+        //
+        test(holdReplicated->set(4, 0) == 3);
+    }
+    cout << "ok" << endl;
+
     cout << "changing state to hold and shutting down server... " << flush;
     hold->shutdown();
     cout << "ok" << endl;
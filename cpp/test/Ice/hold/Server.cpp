@@ -37,8 +37,39 @@ Server::run(int argc, char** argv)
     Ice::ObjectAdapterPtr adapter2 = communicator->createObjectAdapter("TestAdapter2");
     adapter2->add(ICE_MAKE_SHARED(HoldI, timer, adapter2), Ice::stringToIdentity("hold"));
 
+    //
+    // The dispatch of the requests rejected by TestAdapter3 and
+    // TestAdapter4 isn't
+    // reported as a warning.
+    //
+    communicator->getProperties()->setProperty("Ice.Warn.Dispatch", "0");
+    communicator->getProperties()->setProperty("TestAdapter3.Endpoints", getTestEndpoint(2));
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.Size", "2");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.SizeMax", "2");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.SizeWarn", "0");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.DispatchPriorities", "2");
+    communicator->getProperties()->setProperty("TestAdapter3.ThreadPool.DispatchQueueTimeMax", "1000");
+    Ice::ObjectAdapterPtr adapter3 = communicator->createObjectAdapter("TestAdapter3");
+    adapter3->add(ICE_MAKE_SHARED(HoldI, timer, adapter3), Ice::stringToIdentity("hold"));
+
+    communicator->getProperties()->setProperty("TestAdapter4.Endpoints", getTestEndpoint(3));
+    communicator->getProperties()->setProperty("TestAdapter4.ThreadPool.Size", "2");
+    communicator->getProperties()->setProperty("TestAdapter4.ThreadPool.SizeWarn", "0");
+    communicator->getProperties()->setProperty("TestAdapter4.ConcurrencyLimit", "1");
+    communicator->getProperties()->setProperty("TestAdapter4.ConcurrencyLimit.Max", "1");
+    communicator->getProperties()->setProperty("TestAdapter4.ConcurrencyLimit.Latency", "10000");
+    Ice::ObjectAdapterPtr adapter4 = communicator->createObjectAdapter("TestAdapter4");
+    adapter4->add(ICE_MAKE_SHARED(HoldI, timer, adapter4), Ice::stringToIdentity("hold"));
+
+    communicator->getProperties()->setProperty("TestAdapter5.Endpoints", getTestEndpoint(4));
+    Ice::ObjectAdapterPtr adapter5 = communicator->createObjectAdapter("TestAdapter5");
+    adapter5->add(ICE_MAKE_SHARED(HoldI, timer, adapter5), Ice::stringToIdentity("hold"));
+
     adapter1->activate();
     adapter2->activate();
+    adapter3->activate();
+    adapter4->activate();
+    adapter5->activate();
 
     serverReady();
 
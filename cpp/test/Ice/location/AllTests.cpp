@@ -627,6 +627,124 @@ allTests(Test::TestHelper* helper, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing locator cache updates... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheUpdates", "1");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        registry->setAdapterDirectProxy("TestAdapter6", locator->findAdapterById("TestAdapter"));
+        registry->addObject(communicator->stringToProxy("test3@TestAdapter6"));
+
+        count = locator->getRequestCount();
+        ic->stringToProxy("test@TestAdapter6")->ice_ping();
+        test(++count == locator->getRequestCount());
+
+        //
+        // Wait for the subscription to the cache updates.
+        //
+        int nRetry = 500;
+        while(locator->getCacheSubscriberCount() == 0 && --nRetry > 0)
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(locator->getCacheSubscriberCount() > 0);
+
+        //
+        // The entries cached before the subscription might have missed
+        // an update, they are evicted once subscribed and the adapter is
+        // looked up again.
+        //
+        int newCount = count;
+        nRetry = 500;
+        do
+        {
+            newCount = locator->getRequestCount();
+            ic->stringToProxy("test@TestAdapter6")->ice_ping();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        while(locator->getRequestCount() != newCount && --nRetry > 0);
+        test(newCount > count);
+
+        count = locator->getRequestCount();
+        ic->stringToProxy("test3")->ice_ping();
+        test(++count == locator->getRequestCount());
+
+        //
+        // The adapter endpoints are updated by the locator, the cached
+        // endpoints are used until the update is received.
+        //
+        registry->setAdapterDirectProxy("TestAdapter6",
+                                        communicator->stringToProxy("dummy:" + helper->getTestEndpoint(99)));
+        try
+        {
+            while(true)
+            {
+                ic->stringToProxy("test@TestAdapter6")->ice_ping();
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Expected to fail once the endpoints are updated.
+        }
+
+        //
+        // The removal of the adapter evicts it from the cache.
+        //
+        registry->setAdapterDirectProxy("TestAdapter6", locator->findAdapterById("TestAdapter"));
+        ic->stringToProxy("test@TestAdapter6")->ice_ping();
+        registry->setAdapterDirectProxy("TestAdapter6", ICE_NULLPTR);
+        try
+        {
+            while(true)
+            {
+                ic->stringToProxy("test@TestAdapter6")->ice_ping();
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+        catch(const Ice::NotRegisteredException&)
+        {
+        }
+
+        //
+        // The update of a well-known object evicts it from the cache.
+        //
+        registry->addObject(communicator->stringToProxy("test3@TestAdapter"));
+        count = locator->getRequestCount();
+        ic->stringToProxy("test3")->ice_ping();
+        registry->addObject(communicator->stringToProxy("test3:" + helper->getTestEndpoint(99)));
+        try
+        {
+            while(true)
+            {
+                ic->stringToProxy("test3")->ice_ping();
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Expected to fail once the object is evicted.
+        }
+        test(locator->getRequestCount() > count);
+
+        //
+        // The result of a lookup isn't cached if an update of the adapter
+        // is received while it's looked up, it might be older than the
+        // update. The locator sends an update of TestAdapterRace before
+        // answering its lookups.
+        //
+        registry->setAdapterDirectProxy("TestAdapterRace", locator->findAdapterById("TestAdapter"));
+        count = locator->getRequestCount();
+        ic->stringToProxy("test@TestAdapterRace")->ice_ping();
+        ic->stringToProxy("test@TestAdapterRace")->ice_ping();
+        count += 2;
+        test(count == locator->getRequestCount());
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
@@ -39,7 +39,8 @@ Server::run(int argc, char** argv)
     // locator interface, this locator is used by the clients and the
     // 'servers' created with the server manager interface.
     //
-    ServerLocatorRegistryPtr registry = ICE_MAKE_SHARED(ServerLocatorRegistry);
+    ServerLocatorCacheNotifierPtr notifier = ICE_MAKE_SHARED(ServerLocatorCacheNotifier);
+    ServerLocatorRegistryPtr registry = ICE_MAKE_SHARED(ServerLocatorRegistry, notifier);
     registry->addObject(adapter->createProxy(Ice::stringToIdentity("ServerManager")));
     Ice::ObjectPtr object = ICE_MAKE_SHARED(ServerManagerI, registry, initData);
     adapter->add(object, Ice::stringToIdentity("ServerManager"));
@@ -48,8 +49,9 @@ Server::run(int argc, char** argv)
         ICE_UNCHECKED_CAST(Ice::LocatorRegistryPrx,
                            adapter->add(registry, Ice::stringToIdentity("registry")));
 
-    Ice::LocatorPtr locator = ICE_MAKE_SHARED(ServerLocator, registry, registryPrx);
+    Ice::LocatorPtr locator = ICE_MAKE_SHARED(ServerLocator, registry, registryPrx, notifier);
     adapter->add(locator, Ice::stringToIdentity("locator"));
+    adapter->addFacet(notifier, Ice::stringToIdentity("locator"), "LocatorCacheNotifier");
 
     adapter->activate();
     serverReady();
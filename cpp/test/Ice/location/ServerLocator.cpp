@@ -9,7 +9,84 @@
 
 using namespace std;
 
-ServerLocatorRegistry::ServerLocatorRegistry()
+#ifdef ICE_CPP11_MAPPING
+void
+ServerLocatorCacheNotifier::subscribe(Ice::Identity id, const Ice::Current& current)
+#else
+void
+ServerLocatorCacheNotifier::subscribe(const Ice::Identity& id, const Ice::Current& current)
+#endif
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    _observers.push_back(ICE_UNCHECKED_CAST(Ice::LocatorCacheObserverPrx, current.con->createProxy(id)->ice_oneway()));
+}
+
+#ifdef ICE_CPP11_MAPPING
+void
+ServerLocatorCacheNotifier::unsubscribe(Ice::Identity id, const Ice::Current&)
+#else
+void
+ServerLocatorCacheNotifier::unsubscribe(const Ice::Identity& id, const Ice::Current&)
+#endif
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    for(vector<Ice::LocatorCacheObserverPrxPtr>::iterator p = _observers.begin(); p != _observers.end(); ++p)
+    {
+        if((*p)->ice_getIdentity() == id)
+        {
+            _observers.erase(p);
+            break;
+        }
+    }
+}
+
+void
+ServerLocatorCacheNotifier::adapterUpdated(const string& id, const Ice::ObjectPrxPtr& proxy)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    vector<Ice::LocatorCacheObserverPrxPtr>::iterator p = _observers.begin();
+    while(p != _observers.end())
+    {
+        try
+        {
+            (*p)->adapterUpdated(id, proxy);
+            ++p;
+        }
+        catch(const Ice::LocalException&)
+        {
+            p = _observers.erase(p);
+        }
+    }
+}
+
+void
+ServerLocatorCacheNotifier::objectUpdated(const Ice::Identity& id)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    vector<Ice::LocatorCacheObserverPrxPtr>::iterator p = _observers.begin();
+    while(p != _observers.end())
+    {
+        try
+        {
+            (*p)->objectUpdated(id);
+            ++p;
+        }
+        catch(const Ice::LocalException&)
+        {
+            p = _observers.erase(p);
+        }
+    }
+}
+
+int
+ServerLocatorCacheNotifier::getSubscriberCount() const
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    return static_cast<int>(_observers.size());
+}
+
+ServerLocatorRegistry::ServerLocatorRegistry(const ServerLocatorCacheNotifierPtr& notifier) :
+    _notifier(notifier)
 {
 }
 
@@ -34,6 +111,7 @@ ServerLocatorRegistry::setAdapterDirectProxy_async(const Ice::AMD_LocatorRegistr
     {
         _adapters[adapter] = object;
     }
+    _notifier->adapterUpdated(adapter, object);
 #ifdef ICE_CPP11_MAPPING
     response();
 #else
@@ -65,6 +143,8 @@ ServerLocatorRegistry::setReplicatedAdapterDirectProxy_async(
         _adapters[adapter] = object;
         _adapters[replicaGroup] = object;
     }
+    _notifier->adapterUpdated(adapter, object);
+    _notifier->adapterUpdated(replicaGroup, object);
 #ifdef ICE_CPP11_MAPPING
     response();
 #else
@@ -130,11 +210,14 @@ void
 ServerLocatorRegistry::addObject(const Ice::ObjectPrxPtr& object)
 {
     _objects[object->ice_getIdentity()] = object;
+    _notifier->objectUpdated(object->ice_getIdentity());
 }
 
-ServerLocator::ServerLocator(const ServerLocatorRegistryPtr& registry, const ::Ice::LocatorRegistryPrxPtr& registryPrx) :
+ServerLocator::ServerLocator(const ServerLocatorRegistryPtr& registry, const ::Ice::LocatorRegistryPrxPtr& registryPrx,
+                             const ServerLocatorCacheNotifierPtr& notifier) :
     _registry(registry),
     _registryPrx(registryPrx),
+    _notifier(notifier),
     _requestCount(0)
 {
 }
@@ -177,6 +260,19 @@ ServerLocator::findAdapterByIdAsync(string id,
         return;
     }
 
+    if(id == "TestAdapterRace")
+    {
+        //
+        // Send an update of the adapter while it's looked up, before
+        // the response is sent.
+        //
+        Ice::ObjectPrxPtr proxy = _registry->getAdapter(id);
+        _notifier->adapterUpdated(id, proxy);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        response(proxy);
+        return;
+    }
+
     // We add a small delay to make sure locator request queuing gets tested when
     // running the test on a fast machine
     IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1));
@@ -195,6 +291,19 @@ ServerLocator::findAdapterById_async(const Ice::AMD_Locator_findAdapterByIdPtr&
         return;
     }
 
+    if(id == "TestAdapterRace")
+    {
+        //
+        // Send an update of the adapter while it's looked up, before
+        // the response is sent.
+        //
+        Ice::ObjectPrxPtr proxy = _registry->getAdapter(id);
+        _notifier->adapterUpdated(id, proxy);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        response->ice_response(proxy);
+        return;
+    }
+
     // We add a small delay to make sure locator request queuing gets tested when
     // running the test on a fast machine
     IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1));
@@ -213,3 +322,9 @@ ServerLocator::getRequestCount(const ::Ice::Current&) const
 {
     return _requestCount;
 }
+
+int
+ServerLocator::getCacheSubscriberCount(const ::Ice::Current&) const
+{
+    return _notifier->getSubscriberCount();
+}
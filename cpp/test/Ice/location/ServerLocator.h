@@ -8,12 +8,39 @@
 #include <Ice/Locator.h>
 #include <Test.h>
 #include <Ice/ProxyF.h>
+#include <IceUtil/Mutex.h>
+
+class ServerLocatorCacheNotifier : public Ice::LocatorCacheNotifier
+{
+public:
+
+#ifdef ICE_CPP11_MAPPING
+    virtual void subscribe(::Ice::Identity, const ::Ice::Current&);
+    virtual void unsubscribe(::Ice::Identity, const ::Ice::Current&);
+#else
+    virtual void subscribe(const ::Ice::Identity&, const ::Ice::Current&);
+    virtual void unsubscribe(const ::Ice::Identity&, const ::Ice::Current&);
+#endif
+
+    //
+    // Internal method
+    //
+    void adapterUpdated(const ::std::string&, const ::Ice::ObjectPrxPtr&);
+    void objectUpdated(const ::Ice::Identity&);
+    int getSubscriberCount() const;
+
+private:
+
+    ::std::vector< ::Ice::LocatorCacheObserverPrxPtr> _observers;
+    IceUtil::Mutex _mutex;
+};
+ICE_DEFINE_PTR(ServerLocatorCacheNotifierPtr, ServerLocatorCacheNotifier);
 
 class ServerLocatorRegistry : public Test::TestLocatorRegistry
 {
 public:
 
-    ServerLocatorRegistry();
+    ServerLocatorRegistry(const ServerLocatorCacheNotifierPtr&);
 
 #ifdef ICE_CPP11_MAPPING
     virtual void setAdapterDirectProxyAsync(std::string, std::shared_ptr<::Ice::ObjectPrx>,
@@ -50,6 +77,7 @@ public:
 
 private:
 
+    const ServerLocatorCacheNotifierPtr _notifier;
     ::std::map< ::std::string, ::Ice::ObjectPrxPtr> _adapters;
     ::std::map< ::Ice::Identity, ::Ice::ObjectPrxPtr> _objects;
 };
@@ -59,7 +87,8 @@ class ServerLocator : public Test::TestLocator
 {
 public:
 
-    ServerLocator(const ::ServerLocatorRegistryPtr&, const ::Ice::LocatorRegistryPrxPtr&);
+    ServerLocator(const ::ServerLocatorRegistryPtr&, const ::Ice::LocatorRegistryPrxPtr&,
+                  const ::ServerLocatorCacheNotifierPtr&);
 
 #ifdef ICE_CPP11_MAPPING
     virtual void findObjectByIdAsync(::Ice::Identity,
@@ -82,10 +111,13 @@ public:
 
     virtual int getRequestCount(const Ice::Current&) const;
 
+    virtual int getCacheSubscriberCount(const Ice::Current&) const;
+
 private:
 
     ServerLocatorRegistryPtr _registry;
     ::Ice::LocatorRegistryPrxPtr _registryPrx;
+    ServerLocatorCacheNotifierPtr _notifier;
     int _requestCount;
 };
 
@@ -478,6 +478,19 @@ allTests(Test::TestHelper* helper)
     test(b1->ice_getInvocationTimeout() == 1000);
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".ConnectionPoolSize";
+    prop->setProperty(property, "4");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(communicator->proxyToProperty(b1, "Test")["Test.ConnectionPoolSize"] == "4");
+    prop->setProperty(property, "");
+
+    property = propertyPrefix + ".Hedge";
+    test(communicator->proxyToProperty(b1, "Test").count("Test.Hedge") == 0);
+    prop->setProperty(property, "1");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(communicator->proxyToProperty(b1, "Test")["Test.Hedge"] == "1");
+    prop->setProperty(property, "");
+
     property = propertyPrefix + ".EndpointSelection";
     test(b1->ice_getEndpointSelection() == Ice::ICE_ENUM(EndpointSelectionType, Random));
     prop->setProperty(property, "Random");
@@ -1209,6 +1222,67 @@ allTests(Test::TestHelper* helper)
         cout << "ok" << endl;
     }
 
+    cout << "testing request handler sharing... " << flush;
+    {
+        Test::MyClassPrxPtr prx = cl->ice_connectionId("shared");
+        test(!prx->ice_getCachedConnection());
+        prx->ice_ping();
+        Ice::ConnectionPtr connection = prx->ice_getCachedConnection();
+        ctx.clear();
+        ctx["one"] = "hello";
+        test(prx->ice_context(ctx)->ice_getCachedConnection() == connection);
+        test(prx->ice_context(ctx)->ice_isA("::Test::MyClass"));
+        test(prx->getContext() == ctx);
+        test(prx->ice_context(ctx)->ice_context(Ice::Context())->ice_isA("::Test::MyClass"));
+        test(prx->getContext().empty());
+        test(prx->ice_facet("facet")->ice_getCachedConnection() == connection);
+        test(prx->ice_encodingVersion(Ice::Encoding_1_0)->ice_getCachedConnection() == connection);
+        test(prx->ice_invocationTimeout(10000)->ice_getCachedConnection() == connection);
+        prx->ice_invocationTimeout(10000)->ice_ping();
+        test(!prx->ice_connectionCached(false)->ice_getCachedConnection());
+        test(!prx->ice_connectionId("other")->ice_getCachedConnection());
+    }
+    cout << "ok" << endl;
+
+#ifdef TEST_PERF
+    {
+        const int iterations = 100000;
+        Test::MyClassPrxPtr prx = cl->ice_connectionId("perf");
+        prx->ice_ping();
+        ctx.clear();
+        ctx["one"] = "hello";
+
+        cout << "testing invocations through derived proxies with " << iterations << " iterations... " << flush;
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < iterations; ++i)
+        {
+            prx->ice_ping();
+        }
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        IceUtil::Time proxy = now - start;
+
+        start = now;
+        for(int i = 0; i < iterations; ++i)
+        {
+            prx->ice_context(ctx)->ice_ping();
+        }
+        now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        IceUtil::Time derived = now - start;
+
+        start = now;
+        for(int i = 0; i < iterations; ++i)
+        {
+            prx->ice_timeout(30000)->ice_ping(); // Derived proxy which doesn't share the request handler.
+        }
+        IceUtil::Time unshared = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        cout << "proxy = " << proxy.toMicroSecondsDouble() / iterations << " us; ice_context = "
+             << derived.toMicroSecondsDouble() / iterations << " us; ice_timeout = "
+             << unshared.toMicroSecondsDouble() / iterations << " us ok" << endl;
+    }
+#endif
+
     cout << "testing encoding versioning... " << flush;
     string ref20 = "test -e 2.0:" + endp;
     Test::MyClassPrxPtr cl20 = ICE_UNCHECKED_CAST(Test::MyClassPrx, communicator->stringToProxy(ref20));
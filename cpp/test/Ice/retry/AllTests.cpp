@@ -334,5 +334,80 @@ allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& c
     }
     cout << "ok" << endl;
 
+    if(retry1->ice_getConnection())
+    {
+        testInvocationCount(-1);
+        testFailureCount(-1);
+        testRetryCount(-1);
+
+        cout << "testing reply cache... " << flush;
+        //
+        // The connection is closed by the dispatch of the request, the
+        // retry gets the cached reply instead of being dispatched again.
+        //
+        int count = retry1->opReplyCached(true);
+        testInvocationCount(1);
+        testFailureCount(0);
+        testRetryCount(1);
+        test(retry1->opReplyCached(false) == count + 1);
+        testInvocationCount(1);
+        testFailureCount(0);
+        testRetryCount(0);
+
+        //
+        // The requests with the same request ID get the same reply.
+        //
+        Ice::Context ctx;
+        ctx["_rid"] = "test";
+        count = retry2->opReplyCached(false, ctx);
+        test(retry2->opReplyCached(false, ctx) == count);
+        test(retry2->opReplyCached(false) == count + 1);
+
+        //
+        // The request IDs are scoped by the identity and the operation
+        // of the requests.
+        //
+        test(retry2->opIdempotent(-1, ctx) == 0);
+        RetryPrxPtr retryOther = ICE_UNCHECKED_CAST(RetryPrx,
+                                                    retry2->ice_identity(Ice::stringToIdentity("retryOther")));
+        test(retryOther->opReplyCached(false, ctx) == 1);
+
+        //
+        // A retry is sent to the endpoint which received the request,
+        // the object adapter of another endpoint doesn't have its reply.
+        //
+        string endpoint1 = TestHelper::getTestEndpoint(communicator->getProperties(), 1);
+        RetryPrxPtr retryEndpoint1 = ICE_UNCHECKED_CAST(RetryPrx, communicator->stringToProxy("retry:" + endpoint1));
+        count = retryEndpoint1->opReplyCached(false);
+        retry1->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+
+        RetryPrxPtr retryReplicated = ICE_UNCHECKED_CAST(RetryPrx, communicator->stringToProxy(ref + ":" + endpoint1));
+        retryReplicated = retryReplicated->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered));
+        test(retryReplicated->opReplyCached(true) == count + 1);
+        test(retryEndpoint1->opReplyCached(false) == count + 2);
+
+        //
+        // The operations of Ice.ReplyCache.Operations are given with the
+        // type ID of their interface, the second communicator lists the
+        // opReplyCached operation of another interface.
+        //
+        testInvocationCount(-1);
+        testFailureCount(-1);
+        testRetryCount(-1);
+        RetryPrxPtr retryNotCached = ICE_UNCHECKED_CAST(RetryPrx, communicator2->stringToProxy(ref));
+        try
+        {
+            retryNotCached->opReplyCached(true);
+            test(false);
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+        testInvocationCount(1);
+        testFailureCount(1);
+        testRetryCount(0);
+        cout << "ok" << endl;
+    }
+
     return retry1;
 }
@@ -34,6 +34,7 @@ Client::run(int argc, char** argv)
     initData.properties->setProperty("Ice.PrintStackTraces", "0");
 
     initData.properties->setProperty("Ice.RetryIntervals", "0 1 10 1");
+    initData.properties->setProperty("Ice.ReplyCache.Operations", "::Test::Retry::opReplyCached");
     Ice::CommunicatorHolder ich1 = Ice::initialize(argc, argv, initData);
 
     //
@@ -43,6 +44,7 @@ Client::run(int argc, char** argv)
     //
     initData.properties = initData.properties->clone();
     initData.properties->setProperty("Ice.RetryIntervals", "0 1 10000");
+    initData.properties->setProperty("Ice.ReplyCache.Operations", "::Test::Other::opReplyCached");
     initData.observer = getObserver();
     Ice::CommunicatorHolder ich2 = Ice::initialize(initData);
 
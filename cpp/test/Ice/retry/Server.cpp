@@ -24,9 +24,17 @@ Server::run(int argc, char** argv)
     Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
 
     communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    communicator->getProperties()->setProperty("TestAdapter.ReplyCache.Size", "100");
     Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
     adapter->add(ICE_MAKE_SHARED(RetryI), Ice::stringToIdentity("retry"));
+    adapter->add(ICE_MAKE_SHARED(RetryI), Ice::stringToIdentity("retryOther"));
     adapter->activate();
+
+    communicator->getProperties()->setProperty("TestAdapter2.Endpoints", getTestEndpoint(1));
+    communicator->getProperties()->setProperty("TestAdapter2.ReplyCache.Size", "100");
+    Ice::ObjectAdapterPtr adapter2 = communicator->createObjectAdapter("TestAdapter2");
+    adapter2->add(ICE_MAKE_SHARED(RetryI), Ice::stringToIdentity("retry"));
+    adapter2->activate();
     serverReady();
     communicator->waitForShutdown();
 }
@@ -6,7 +6,7 @@
 #include <TestI.h>
 #include <SystemFailure.h>
 
-RetryI::RetryI() : _counter(0)
+RetryI::RetryI() : _counter(0), _dispatchCount(0)
 {
 }
 
@@ -57,6 +57,20 @@ RetryI::opSystemException(const Ice::Current&)
     throw SystemFailure(__FILE__, __LINE__);
 }
 
+int
+RetryI::opReplyCached(bool kill, const Ice::Current& current)
+{
+    //
+    // The connection is closed before the reply is sent, the reply is
+    // cached by the object adapter.
+    //
+    if(kill)
+    {
+        current.con->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+    }
+    return ++_dispatchCount;
+}
+
 void
 RetryI::shutdown(const Ice::Current& current)
 {
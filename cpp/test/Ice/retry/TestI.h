@@ -17,11 +17,13 @@ public:
     virtual int opIdempotent(int, const Ice::Current&);
     virtual void opNotIdempotent(const Ice::Current&);
     virtual void opSystemException(const Ice::Current&);
+    virtual int opReplyCached(bool, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 
 private:
 
     int _counter;
+    int _dispatchCount;
 };
 
 #endif
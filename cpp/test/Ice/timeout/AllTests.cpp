@@ -565,5 +565,87 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing deadlines... " << flush;
+    {
+        //
+        // The invocation timeout is the deadline of the request, the
+        // invocations made by the dispatch inherit the deadline.
+        //
+        communicator->getProperties()->setProperty("TimeoutDeadline.AdapterId", "deadlineAdapter");
+        communicator->getProperties()->setProperty("TimeoutDeadline.ThreadPool.Size", "2");
+
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TimeoutDeadline");
+        adapter->activate();
+
+        TimeoutPrxPtr deadline = ICE_UNCHECKED_CAST(TimeoutPrx, adapter->addWithUUID(ICE_MAKE_SHARED(TimeoutI)));
+        test(deadline->remainingTime() == -1);
+        test(deadline->nestedRemainingTime() == -1);
+
+        int remaining = deadline->ice_invocationTimeout(1000)->remainingTime();
+        test(remaining > 0 && remaining <= 1000);
+        remaining = deadline->ice_invocationTimeout(1000)->nestedRemainingTime();
+        test(remaining > 0 && remaining <= 1000);
+
+        adapter->destroy();
+
+        TimeoutPrxPtr to = ICE_UNCHECKED_CAST(TimeoutPrx, obj->ice_connectionId("deadline"));
+        remaining = to->ice_invocationTimeout(1000)->remainingTime();
+        test(remaining > 0 && remaining <= 1000);
+
+        //
+        // The request is sent with the time left, not the invocation
+        // timeout, when it's queued until the connection is established.
+        //
+        TimeoutPrxPtr queued =
+            ICE_UNCHECKED_CAST(TimeoutPrx, obj->ice_connectionId("queued")->ice_invocationTimeout(1000));
+        controller->holdAdapter(-1);
+#ifdef ICE_CPP11_MAPPING
+        auto q = queued->remainingTimeAsync();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        controller->resumeAdapter();
+        remaining = q.get();
+#else
+        Ice::AsyncResultPtr q = queued->begin_remainingTime();
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        controller->resumeAdapter();
+        remaining = queued->end_remainingTime(q);
+#endif
+        test(remaining > 0 && remaining <= 500);
+
+        //
+        // The server drops the expired requests without a response.
+        //
+        Ice::Context ctx;
+        ctx["_deadline"] = "0";
+#ifdef ICE_CPP11_MAPPING
+        auto r = to->opAsync(ctx);
+        test(r.wait_for(chrono::milliseconds(500)) == future_status::timeout);
+        to->ice_getConnection()->close(Ice::ConnectionClose::Forcefully);
+        try
+        {
+            r.get();
+            test(false);
+        }
+        catch(const Ice::ConnectionManuallyClosedException&)
+        {
+        }
+#else
+        Ice::AsyncResultPtr r = to->begin_op(ctx);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+        test(!r->isCompleted());
+        to->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+        try
+        {
+            to->end_op(r);
+            test(false);
+        }
+        catch(const Ice::ConnectionManuallyClosedException&)
+        {
+        }
+#endif
+        to->op();
+    }
+    cout << "ok" << endl;
+
     controller->shutdown();
 }
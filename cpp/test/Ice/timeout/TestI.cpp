@@ -47,6 +47,18 @@ TimeoutI::sleep(Ice::Int to, const Ice::Current&)
     IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(to));
 }
 
+Ice::Int
+TimeoutI::remainingTime(const Ice::Current& current)
+{
+    return Ice::getRemainingTime(current);
+}
+
+Ice::Int
+TimeoutI::nestedRemainingTime(const Ice::Current& current)
+{
+    return ICE_UNCHECKED_CAST(Test::TimeoutPrx, current.adapter->createProxy(current.id))->remainingTime();
+}
+
 ControllerI::ControllerI(const Ice::ObjectAdapterPtr& adapter) : _adapter(adapter)
 {
 }
@@ -14,6 +14,8 @@ public:
     virtual void op(const Ice::Current&);
     virtual void sendData(ICE_IN(Test::ByteSeq), const Ice::Current&);
     virtual void sleep(Ice::Int, const Ice::Current&);
+    virtual Ice::Int remainingTime(const Ice::Current&);
+    virtual Ice::Int nestedRemainingTime(const Ice::Current&);
 };
 
 class ControllerI : public virtual Test::Controller
@@ -739,6 +739,76 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing activation latency... " << flush;
+    {
+        //
+        // Measure the time to start a server, one server at a time and
+        // with all the servers started concurrently. The servers are
+        // started by the activation threads of the node in the latter
+        // case.
+        //
+        IceGrid::ApplicationInfo info = admin->getApplicationInfo("Test");
+        IceGrid::ApplicationDescriptor testApp;
+        testApp.name = "TestApp";
+        testApp.serverTemplates = info.descriptor.serverTemplates;
+        testApp.variables = info.descriptor.variables;
+        const int nServers = 20;
+        vector<string> ids;
+        for(int i = 0; i < nServers; ++i)
+        {
+            ostringstream id;
+            id << "latency-" << i;
+            ids.push_back(id.str());
+            IceGrid::ServerInstanceDescriptor server;
+            server._cpp_template = "Server";
+            server.parameterValues["id"] = id.str();
+            server.parameterValues["activation"] = "manual";
+            testApp.nodes["localnode"].serverInstances.push_back(server);
+        }
+        admin->addApplication(testApp);
+
+        try
+        {
+            IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            for(vector<string>::const_iterator p = ids.begin(); p != ids.end(); ++p)
+            {
+                admin->startServer(*p);
+            }
+            IceUtil::Time sequential = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+            for(vector<string>::const_iterator p = ids.begin(); p != ids.end(); ++p)
+            {
+                admin->stopServer(*p);
+            }
+
+            start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            vector<Ice::AsyncResultPtr> results;
+            for(vector<string>::const_iterator p = ids.begin(); p != ids.end(); ++p)
+            {
+                results.push_back(admin->begin_startServer(*p));
+            }
+            for(vector<Ice::AsyncResultPtr>::const_iterator p = results.begin(); p != results.end(); ++p)
+            {
+                admin->end_startServer(*p);
+            }
+            IceUtil::Time concurrent = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+            for(vector<string>::const_iterator p = ids.begin(); p != ids.end(); ++p)
+            {
+                test(admin->getServerState(*p) == IceGrid::Active);
+                admin->stopServer(*p);
+            }
+
+            cout << "sequential: " << sequential.toMilliSecondsDouble() / nServers << "ms, concurrent: "
+                 << concurrent.toMilliSecondsDouble() / nServers << "ms per server... " << flush;
+        }
+        catch(const IceGrid::ServerStartException& ex)
+        {
+            cerr << ex.reason << endl;
+            test(false);
+        }
+        admin->removeApplication("TestApp");
+    }
+    cout << "ok" << endl;
+
     admin->stopServer("node-1");
     admin->stopServer("node-2");
 
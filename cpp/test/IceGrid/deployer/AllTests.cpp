@@ -48,6 +48,44 @@ bool isLongLineEnd(const string& line)
     return line.size() > 1 && line[line.size() - 2] == 'b' && line[line.size() - 1] == 'c';
 }
 
+class FileObserverI : public FileObserver, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    virtual void
+    linesAppended(const Ice::StringSeq& lines, const Ice::Current&)
+    {
+        Lock sync(*this);
+        for(Ice::StringSeq::const_iterator p = lines.begin(); p != lines.end(); ++p)
+        {
+            if(p != lines.begin())
+            {
+                _text += '\n';
+            }
+            _text += *p;
+        }
+        notifyAll();
+    }
+
+    void
+    waitForText(const string& text)
+    {
+        Lock sync(*this);
+        IceUtil::Time end = IceUtil::Time::now(IceUtil::Time::Monotonic) + IceUtil::Time::seconds(10);
+        while(_text != text)
+        {
+            IceUtil::Time delay = end - IceUtil::Time::now(IceUtil::Time::Monotonic);
+            test(delay > IceUtil::Time());
+            timedWait(delay);
+        }
+    }
+
+private:
+
+    string _text;
+};
+typedef IceUtil::Handle<FileObserverI> FileObserverIPtr;
+
 }
 
 struct ProxyIdentityEqual : public std::binary_function<Ice::ObjectPrx,string,bool>
@@ -367,6 +405,39 @@ logTests(const Ice::CommunicatorPtr& comm, const AdminSessionPrx& session)
         test(false);
     }
 
+    try
+    {
+        //
+        // Test following a log file.
+        //
+        string path = testDir + "/log5.txt";
+        ofstream os(path.c_str(), ios_base::out | ios_base::trunc);
+        os << "first line" << endl;
+
+        Ice::ObjectAdapterPtr adapter = comm->createObjectAdapterWithEndpoints("", "default");
+        FileObserverIPtr observer = new FileObserverI();
+        FileObserverPrx observerPrx = FileObserverPrx::uncheckedCast(adapter->addWithUUID(observer));
+        adapter->activate();
+
+        it = session->openServerLog("LogServer", path, 0);
+        it->follow(1024, observerPrx);
+
+        os << "started a line" << flush;
+        observer->waitForText("started a line");
+        os << ", finished" << endl;
+        observer->waitForText("started a line, finished\n");
+        os << "second line" << endl << "third line" << endl;
+        observer->waitForText("started a line, finished\nsecond line\nthird line\n");
+
+        it->destroy();
+        adapter->destroy();
+    }
+    catch(const FileNotAvailableException& ex)
+    {
+        cerr << ex.reason << endl;
+        test(false);
+    }
+
     cout << "ok" << endl;
 }
 
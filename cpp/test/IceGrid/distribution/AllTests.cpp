@@ -5,6 +5,7 @@
 #include <IceUtil/Thread.h>
 #include <Ice/Ice.h>
 #include <IceGrid/IceGrid.h>
+#include <IcePatch2/FileServer.h>
 #include <TestHelper.h>
 #include <Test.h>
 
@@ -54,6 +55,9 @@ allTests(Test::TestHelper* helper)
         test(test->getServerFile("dir1/file2") == "dummy-file2");
         test(test->getServerFile("dir2/file3") == "dummy-file3");
 
+        string bigfile = test->getServerFile("dir1/bigfile");
+        test(bigfile.size() == 300000 && bigfile.find("UPDATED") == string::npos);
+
         test(test->getApplicationFile("rootfile") == "");
         test(test->getApplicationFile("dir1/file1") == "");
         test(test->getApplicationFile("dir1/file2") == "");
@@ -147,6 +151,35 @@ allTests(Test::TestHelper* helper)
         test(test->getServerFile("dir2/file3") == "dummy-file3");
         test(test->getServerFile("dir2/file4") == "dummy-file4");
 
+        //
+        // The big file is patched with the chunks which aren't already
+        // present in the original version of the file.
+        //
+        string bigfile = test->getServerFile("dir1/bigfile");
+        test(bigfile.size() == 300000 && bigfile.find("UPDATED") == 100000);
+
+        //
+        // The file server dispatched getChunk for fewer chunks than the
+        // big file has, the whole file download doesn't call getChunk.
+        //
+        IcePatch2::FileServerPrx fileServer =
+            IcePatch2::FileServerPrx::uncheckedCast(communicator->stringToProxy("Test.IcePatch2/server"));
+        IcePatch2::ChunkInfoSeq chunks = fileServer->getChunkInfoSeq("dir1/bigfile", 0, 1000);
+
+        IceMX::MetricsAdminPrx metrics =
+            IceMX::MetricsAdminPrx::checkedCast(admin->getServerAdmin("Test.IcePatch2"), "Metrics");
+        Ice::Long timestamp;
+        IceMX::MetricsView view = metrics->getMetricsView("Debug", timestamp);
+        Ice::Long getChunkCount = 0;
+        for(IceMX::MetricsMap::const_iterator p = view["Dispatch"].begin(); p != view["Dispatch"].end(); ++p)
+        {
+            if((*p)->id == "getChunk")
+            {
+                getChunkCount = (*p)->total;
+            }
+        }
+        test(getChunkCount > 0 && getChunkCount < static_cast<Ice::Long>(chunks.size()));
+
         test(test->getApplicationFile("rootfile") == "");
         test(test->getApplicationFile("dir1/file1") == "");
         test(test->getApplicationFile("dir1/file2") == "");
@@ -2,6 +2,6 @@
 # Copyright (c) ZeroC, Inc. All rights reserved.
 #
 
-$(test)_client_dependencies = IceGrid Glacier2
+$(test)_client_dependencies = IceGrid Glacier2 IcePatch2
 
 tests += $(test)
@@ -3,6 +3,8 @@
 # Copyright (c) ZeroC, Inc. All rights reserved.
 #
 
+import random, string
+
 class IceGridDistributionTestCase(IceGridTestCase):
 
     def setupClientSide(self, current):
@@ -21,6 +23,15 @@ class IceGridDistributionTestCase(IceGridTestCase):
           [ "updated/dir2/file4", "dummy-file4"],
         ]
 
+        #
+        # The big file is updated in its middle, its first and last
+        # chunks are reused when it's patched with the updated data.
+        #
+        rand = random.Random(0)
+        bigfile = "".join(rand.choice(string.ascii_letters) for i in range(300000))
+        files.append([ "original/dir1/bigfile", bigfile ])
+        files.append([ "updated/dir1/bigfile", bigfile[:100000] + "UPDATED" + bigfile[100007:] ])
+
         current.write("creating IcePatch2 data directory... ")
         current.mkdirs(datadir)
 
@@ -32,8 +43,8 @@ class IceGridDistributionTestCase(IceGridTestCase):
             f.write(content)
             f.close()
 
-        IcePatch2Calc(args=[os.path.join(datadir, "original")]).run(current)
-        IcePatch2Calc(args=[os.path.join(datadir, "updated")]).run(current)
+        IcePatch2Calc(args=["--chunks", os.path.join(datadir, "original")]).run(current)
+        IcePatch2Calc(args=["--chunks", os.path.join(datadir, "updated")]).run(current)
 
         current.writeln("ok")
 
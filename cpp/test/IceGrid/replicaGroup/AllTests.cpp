@@ -481,6 +481,74 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing replication with latency load balancing... " << flush;
+    {
+        map<string, string> params;
+        params["replicaGroup"] = "Latency";
+        params["id"] = "Server1";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server2";
+        instantiateServer(admin, "Server", "localnode", params);
+        params["id"] = "Server3";
+        params["delay"] = "200";
+        instantiateServer(admin, "Server", "localnode", params);
+        TestIntfPrx obj = TestIntfPrx::uncheckedCast(comm->stringToProxy("Latency"));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_locatorCacheTimeout(0));
+        obj = TestIntfPrx::uncheckedCast(obj->ice_connectionCached(false));
+        set<string> replicaIds = serverReplicaIds;
+        while(!replicaIds.empty())
+        {
+            try
+            {
+                replicaIds.erase(obj->getReplicaId());
+            }
+            catch(const Ice::LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+        }
+
+        //
+        // Server3 is slow, once the node reported the latencies of the
+        // replicas, it's no longer selected. The replicas are invoked
+        // directly to keep their latency up to date.
+        //
+        vector<TestIntfPrx> replicas;
+        for(set<string>::const_iterator p = serverReplicaIds.begin(); p != serverReplicaIds.end(); ++p)
+        {
+            replicas.push_back(TestIntfPrx::uncheckedCast(obj->ice_adapterId(*p)));
+        }
+        int nRetry = 0;
+        int slow = 0;
+        do
+        {
+            for(vector<TestIntfPrx>::const_iterator p = replicas.begin(); p != replicas.end(); ++p)
+            {
+                (*p)->getReplicaId();
+            }
+            slow = 0;
+            for(int i = 0; i < 20; ++i)
+            {
+                if(obj->getReplicaId() == "Server3.ReplicatedAdapter")
+                {
+                    ++slow;
+                }
+            }
+            if(slow > 0)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+            }
+        }
+        while(slow > 0 && ++nRetry < 60);
+        test(slow == 0);
+
+        removeServer(admin, "Server1");
+        removeServer(admin, "Server2");
+        removeServer(admin, "Server3");
+    }
+    cout << "ok" << endl;
+
     cout << "testing filters... " << flush;
     {
         map<string, string> params;
@@ -5,7 +5,9 @@
 
 registryProps = {
     "Ice.Plugin.RegistryPlugin" : "RegistryPlugin:createRegistryPlugin",
-    "IceGrid.Registry.DynamicRegistration" : 1
+    "IceGrid.Registry.DynamicRegistration" : 1,
+    # The nodes report the adapter loads of the latency load sample with each keep alive (every 2s)
+    "IceGrid.Registry.NodeSessionTimeout" : 4
 }
 
 clientProps = {
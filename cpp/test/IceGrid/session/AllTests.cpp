@@ -328,6 +328,7 @@ public:
 
         Lock sync(*this);
         //cerr << node << " " << info.id << " " << info.state << " " << info.pid << endl;
+        this->updatedServers.push_back(info.id);
         ServerDynamicInfoSeq& servers = this->nodes[node].servers;
         ServerDynamicInfoSeq::iterator p;
         for(p = servers.begin(); p != servers.end(); ++p)
@@ -427,6 +428,7 @@ public:
     }
 
     map<string, NodeDynamicInfo> nodes;
+    vector<string> updatedServers;
 };
 typedef IceUtil::Handle<NodeObserverI> NodeObserverIPtr;
 
@@ -496,6 +498,97 @@ allTests(Test::TestHelper* helper)
     AdminPrx admin = session->getAdmin();
     test(admin);
 
+    if(communicator->getProperties()->getPropertyAsInt("ObserverUpdateWindow") > 0)
+    {
+        //
+        // The registry is configured with IceGrid.Registry.ObserverUpdateWindow,
+        // only the coalescing of the node observer updates is tested.
+        //
+        cout << "testing node observer update window... " << flush;
+        Ice::PropertiesPtr properties = communicator->getProperties();
+        IceUtil::Time window = IceUtil::Time::milliSeconds(properties->getPropertyAsInt("ObserverUpdateWindow"));
+
+        Ice::ObjectAdapterPtr adpt = communicator->createObjectAdapter("");
+        NodeObserverIPtr nodeObs = new NodeObserverI("nodeObs");
+        Ice::ObjectPrx no = adpt->addWithUUID(nodeObs);
+        adpt->activate();
+        registry->ice_getConnection()->setAdapter(adpt);
+        session->setObserversByIdentity(Ice::Identity(),
+                                        no->ice_getIdentity(),
+                                        Ice::Identity(),
+                                        Ice::Identity(),
+                                        Ice::Identity());
+        nodeObs->waitForUpdate(__FILE__, __LINE__); // init
+
+        ApplicationDescriptor testApp;
+        testApp.name = "TestApp";
+        NodeDescriptor node;
+        for(int i = 1; i <= 2; ++i)
+        {
+            ostringstream os;
+            os << "Server" << i;
+            ServerDescriptorPtr server = new ServerDescriptor();
+            server->id = os.str();
+            server->exe = properties->getProperty("ServerDir") + "/server";
+            server->pwd = properties->getProperty("TestDir");
+            server->applicationDistrib = false;
+            server->allocatable = false;
+            node.servers.push_back(server);
+        }
+        testApp.nodes["localnode"] = node;
+
+        session->startUpdate();
+        admin->addApplication(testApp);
+        session->finishUpdate();
+
+        //
+        // Wait for the updates of the deployment to be published before
+        // updating the servers within a single window.
+        //
+        IceUtil::ThreadControl::sleep(window * 2);
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*nodeObs);
+            nodeObs->updatedServers.clear();
+        }
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        admin->enableServer("Server2", false);
+        admin->enableServer("Server1", false);
+        admin->enableServer("Server2", true);
+
+        nodeObs->waitForUpdate(__FILE__, __LINE__); // serverUpdate(Server2)
+        nodeObs->waitForUpdate(__FILE__, __LINE__); // serverUpdate(Server1)
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start >= window / 2);
+
+        //
+        // The superseded update of Server2 isn't published and the
+        // updates are published in the order of the first update of each
+        // server.
+        //
+        IceUtil::ThreadControl::sleep(window * 2);
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*nodeObs);
+            test(nodeObs->updatedServers.size() == 2);
+            test(nodeObs->updatedServers[0] == "Server2");
+            test(nodeObs->updatedServers[1] == "Server1");
+
+            ServerDynamicInfoSeq& servers = nodeObs->nodes["localnode"].servers;
+            for(ServerDynamicInfoSeq::const_iterator p = servers.begin(); p != servers.end(); ++p)
+            {
+                test(p->enabled == (p->id == "Server2"));
+            }
+        }
+
+        session->startUpdate();
+        admin->removeApplication("TestApp");
+        session->finishUpdate();
+
+        adpt->destroy();
+        session->destroy();
+        cout << "ok" << endl;
+        return;
+    }
+
     cout << "starting router... " << flush;
     try
     {
@@ -45,12 +45,27 @@ clientProps10 = lambda process, current: {
     "Ice.Default.EncodingVersion" : "1.0"
 }
 
+clientPropsWindow = lambda process, current: {
+    "ServerDir" : current.getBuildDir("server"),
+    "TestDir" : "{testdir}",
+    "ObserverUpdateWindow" : 500
+}
+
 icegridregistry = [IceGridRegistryMaster(props=registryProps)]
 
+#
+# The node observer updates are coalesced for the duration of the window.
+#
+icegridregistryWindow = [IceGridRegistryMaster(props=dict(registryProps, **{
+    'IceGrid.Registry.ObserverUpdateWindow' : 500
+}))]
+
 if isinstance(platform, Windows) or os.getuid() != 0:
     TestSuite(__file__,
           [ IceGridSessionTestCase("with default encoding", icegridregistry=icegridregistry,
                                    client=IceGridClient(props=clientProps)),
             IceGridSessionTestCase("with 1.0 encoding", icegridregistry=icegridregistry,
-                                   client=IceGridClient(props=clientProps10))],
+                                   client=IceGridClient(props=clientProps10)),
+            IceGridSessionTestCase("with observer update window", icegridregistry=icegridregistryWindow,
+                                   client=IceGridClient(props=clientPropsWindow))],
             runOnMainThread=True, multihost=False)
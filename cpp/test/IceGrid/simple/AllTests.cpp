@@ -44,6 +44,49 @@ allTests(Test::TestHelper* helper)
     test(finder->getLocator());
     cout << "ok" << endl;
 
+    cout << "testing locator cache updates... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheUpdates", "1");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        Ice::LocatorPrxPtr defaultLocator = communicator->getDefaultLocator();
+        Ice::LocatorRegistryPrxPtr locatorRegistry = defaultLocator->getRegistry();
+
+        //
+        // The registry sends the removal of the adapter to the subscribed
+        // clients, which evict the adapter from their cache. The cache
+        // entry doesn't expire otherwise. The first attempt might only
+        // succeed once the client is subscribed.
+        //
+        for(int i = 0; i < 2; ++i)
+        {
+            locatorRegistry->setAdapterDirectProxy("TestAdapterCache",
+                                                   defaultLocator->findAdapterById("TestAdapter"));
+            ic->stringToProxy("test @ TestAdapterCache")->ice_ping();
+            locatorRegistry->setAdapterDirectProxy("TestAdapterCache", ICE_NULLPTR);
+
+            int nRetry = 500;
+            try
+            {
+                while(--nRetry > 0)
+                {
+                    ic->stringToProxy("test @ TestAdapterCache")->ice_ping();
+                    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+                }
+                test(false);
+            }
+            catch(const Ice::NotRegisteredException& ex)
+            {
+                test(ex.kindOfObject == "object adapter");
+                test(ex.id == "TestAdapterCache");
+            }
+        }
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     Ice::CommunicatorPtr com;
     try
     {
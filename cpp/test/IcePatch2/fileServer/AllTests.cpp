@@ -0,0 +1,201 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <IcePatch2/FileServer.h>
+#include <TestHelper.h>
+
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+using namespace std;
+using namespace IcePatch2;
+
+namespace
+{
+
+Ice::ByteSeq
+readFile(const string& path)
+{
+    ifstream is(path.c_str(), ios::binary);
+    test(is);
+    return Ice::ByteSeq((istreambuf_iterator<char>(is)), istreambuf_iterator<char>());
+}
+
+void
+writeFile(const string& path, const Ice::ByteSeq& data, size_t size)
+{
+    ofstream os(path.c_str(), ios::binary | ios::trunc);
+    test(os);
+    os.write(reinterpret_cast<const char*>(&data[0]), static_cast<streamsize>(size));
+}
+
+Ice::ByteSeq
+readCompressed(const FileServerPrx& server, const string& path, int num)
+{
+    Ice::ByteSeq data;
+    while(true)
+    {
+        Ice::ByteSeq bytes = server->getLargeFileCompressed(path, static_cast<Ice::Long>(data.size()), num);
+        if(bytes.empty())
+        {
+            break;
+        }
+        test(bytes.size() <= static_cast<size_t>(num));
+        data.insert(data.end(), bytes.begin(), bytes.end());
+    }
+    return data;
+}
+
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    Ice::PropertiesPtr properties = communicator->getProperties();
+    string dataDir = properties->getProperty("IcePatch2.Directory");
+    const int requests = properties->getPropertyAsIntWithDefault("Requests", 5000);
+    const int clients = properties->getPropertyAsIntWithDefault("Clients", 500);
+    const int num = 256 * 1024;
+    const int blockSize = 64 * 1024;
+
+    FileServerPrx server = FileServerPrx::checkedCast(
+        communicator->stringToProxy("IcePatch2/server:" + helper->getTestEndpoint()));
+    test(server);
+
+    Ice::ByteSeq compressed = readFile(dataDir + "/large.bz2");
+    Ice::ByteSeq large = readFile(dataDir + "/large");
+
+    cout << "testing compressed file reads... " << flush;
+    {
+        test(readCompressed(server, "large", num) == compressed);
+        test(readCompressed(server, "large", 1000) == compressed);
+
+        //
+        // A read at the end of the file returns the remaining bytes, a
+        // read past the end of the file returns no bytes.
+        //
+        Ice::Long size = static_cast<Ice::Long>(compressed.size());
+        test(server->getLargeFileCompressed("large", size - 10, num).size() == 10);
+        test(server->getLargeFileCompressed("large", size, num).empty());
+        test(server->getLargeFileCompressed("large", size + num, num).empty());
+
+        try
+        {
+            server->getLargeFileCompressed("unknown", 0, num);
+            test(false);
+        }
+        catch(const FileAccessException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing chunk reads... " << flush;
+    {
+        ChunkInfoSeq chunks = server->getChunkInfoSeq("large", 0, 1000);
+        test(chunks.size() > 1);
+
+        Ice::ByteSeq data;
+        for(ChunkInfoSeq::const_iterator p = chunks.begin(); p != chunks.end(); ++p)
+        {
+            Ice::ByteSeq chunk = server->getChunk(p->checksum);
+            test(chunk.size() == static_cast<size_t>(p->size));
+            data.insert(data.end(), chunk.begin(), chunk.end());
+        }
+        test(data == large);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing truncated files... " << flush;
+    {
+        //
+        // Read the files first so that they are cached by the server.
+        //
+        ChunkInfoSeq chunks = server->getChunkInfoSeq("large", 0, 1000);
+        test(server->getChunk(chunks.back().checksum).size() == static_cast<size_t>(chunks.back().size));
+        test(readCompressed(server, "large", num) == compressed);
+
+        //
+        // Files truncated while they are served result in short reads
+        // and in failures for the chunks past the end of the file, the
+        // server must not crash.
+        //
+        size_t half = compressed.size() / 2;
+        writeFile(dataDir + "/large.bz2", compressed, half);
+        writeFile(dataDir + "/large", large, large.size() / 2);
+
+        test(server->getLargeFileCompressed("large", 0, static_cast<int>(compressed.size())).size() == half);
+        test(server->getLargeFileCompressed("large", static_cast<Ice::Long>(half), num).empty());
+        try
+        {
+            server->getChunk(chunks.back().checksum);
+            test(false);
+        }
+        catch(const FileAccessException&)
+        {
+        }
+        server->ice_ping();
+
+        //
+        // The files are served again once they are restored.
+        //
+        writeFile(dataDir + "/large.bz2", compressed, compressed.size());
+        writeFile(dataDir + "/large", large, large.size());
+        test(readCompressed(server, "large", num) == compressed);
+        test(server->getChunk(chunks.back().checksum).size() == static_cast<size_t>(chunks.back().size));
+    }
+    cout << "ok" << endl;
+
+    cout << "reading " << requests << " blocks of " << blockSize / 1024 << "KB with " << clients << " clients... "
+         << flush;
+    {
+        //
+        // Each client has its own connection and keeps one request
+        // outstanding, like concurrent clients patching the same file.
+        //
+        vector<FileServerPrx> proxies;
+        for(int i = 0; i < clients; ++i)
+        {
+            ostringstream os;
+            os << "client" << i;
+            proxies.push_back(server->ice_connectionId(os.str()));
+            proxies.back()->ice_getConnection();
+        }
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        Ice::Long size = static_cast<Ice::Long>(compressed.size());
+        Ice::Long pos = 0;
+        Ice::Long bytes = 0;
+        deque<pair<FileServerPrx, Ice::AsyncResultPtr> > results;
+        for(int i = 0; i < requests; ++i)
+        {
+            FileServerPrx proxy;
+            if(i < clients)
+            {
+                proxy = proxies[static_cast<size_t>(i)];
+            }
+            else
+            {
+                proxy = results.front().first;
+                bytes += static_cast<Ice::Long>(proxy->end_getLargeFileCompressed(results.front().second).size());
+                results.pop_front();
+            }
+            results.push_back(make_pair(proxy, proxy->begin_getLargeFileCompressed("large", pos, blockSize)));
+            pos = pos + blockSize < size ? pos + blockSize : 0;
+        }
+        while(!results.empty())
+        {
+            bytes += static_cast<Ice::Long>(results.front().first->end_getLargeFileCompressed(
+                                                results.front().second).size());
+            results.pop_front();
+        }
+        IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+        cout << "ok (" << static_cast<Ice::Long>(bytes / 1024.0 / 1024.0 / elapsed.toSecondsDouble()) << "MB/s)"
+             << endl;
+    }
+}
@@ -0,0 +1,10 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+$(test)_programs                = client
+$(test)_dependencies            = IcePatch2 Ice TestCommon
+
+$(test)_client_sources          = Client.cpp AllTests.cpp
+
+tests += $(test)
@@ -0,0 +1,51 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+import random
+
+class IcePatch2FileServer(ProcessFromBinDir, ProcessIsReleaseOnly, Server):
+
+    def __init__(self, *args, **kargs):
+        Server.__init__(self, exe="icepatch2server", waitForShutdown=False, mapping=Mapping.getByName("cpp"),
+                        *args, **kargs)
+
+    def getProps(self, current):
+        props = Server.getProps(self, current)
+        props.update({
+            "IcePatch2.Endpoints" : current.getTestEndpoint(0),
+            "IcePatch2.Directory" : "{testdir}/data",
+        })
+        return props
+
+class IcePatch2FileServerTestCase(ClientServerTestCase):
+
+    def setupServerSide(self, current):
+        datadir = os.path.join(current.testsuite.getPath(), "data")
+
+        current.write("creating IcePatch2 data directory... ")
+        current.mkdirs(datadir)
+
+        #
+        # Random data doesn't compress, the compressed file is about as
+        # large as the file.
+        #
+        rand = random.Random(0)
+        f = open(os.path.join(datadir, "large"), "wb")
+        f.write(bytearray(rand.randint(0, 255) for i in range(600000)))
+        f.close()
+
+        IcePatch2Calc(args=["--chunks", datadir]).run(current)
+        current.writeln("ok")
+
+    def teardownServerSide(self, current, success):
+        shutil.rmtree(os.path.join(current.testsuite.getPath(), "data"), ignore_errors=True)
+
+client = Client(props={ "IcePatch2.Directory" : "{testdir}/data" })
+
+TestSuite(__file__, [
+    IcePatch2FileServerTestCase("with file cache", client=client, server=IcePatch2FileServer()),
+    IcePatch2FileServerTestCase("without file cache", client=client,
+                                server=IcePatch2FileServer(props={ "IcePatch2.FileCacheSize" : 0 })),
+], multihost=False)
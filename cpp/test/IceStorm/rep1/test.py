@@ -282,4 +282,68 @@ class IceStormRep1TestCase(IceStormTestCase):
         self.stopIceStorm(current)
         current.writeln("ok")
 
-TestSuite(__file__, [ IceStormRep1TestCase("replicated", icestorm=icestorm) ], multihost=False)
+#
+# Replicas with a small replication log and small content chunks, to
+# check that a restarted replica syncs the full content retrieved in
+# chunks and that the other replicas sync from its replication log.
+#
+syncProps = dict(props)
+syncProps.update({
+    "IceStorm.Election.LogSize" : 10,
+    "IceStorm.Election.SyncChunkSize" : 2,
+    "IceStorm.Trace.Replication" : 1
+})
+
+syncIceStorm = [ IceStorm(replica=i, nreplicas=3, props = syncProps) for i in range(0,3) ]
+
+class IceStormRepSyncTestCase(IceStormTestCase):
+
+    def runClientSide(self, current):
+
+        def stopReplica(num):
+            self.icestorm[num].shutdown(current)
+            self.icestorm[num].stop(current, True)
+
+        def checkTopics(replica, topics):
+            for topic in topics:
+                output = self.runadmin(current, "create " + topic, instance=self.icestorm[replica], quiet=True,
+                                       exitstatus=1)
+                if output.find("error: topic `{0}' exists".format(topic)) < 0:
+                    raise RuntimeError("topic `{0}' is missing on replica {1}:\n{2}".format(topic, replica, output))
+
+        #
+        # The replica with the highest id is the coordinator of the group
+        # once it's restarted. Its llu is reset on startup so it syncs the
+        # full content of the other replicas, in chunks, before the group
+        # accepts updates again. The other replicas are up to date and
+        # only receive the updates of the new generation from its log.
+        #
+        current.write("testing replica sync with content chunks... ")
+        self.runadmin(current, "create sync0")
+        stopReplica(2)
+        self.runadmin(current, "create sync1 sync2")
+        self.icestorm[2].start(current)
+        self.icestorm[2].expect(current, "synced the full content from llu 0/0 .* in [0-9]+ chunks")
+        checkTopics(2, ["sync0", "sync1", "sync2"])
+        current.writeln("ok")
+
+        current.write("testing replica sync from the replication log... ")
+        stopReplica(2)
+        topics = ["chunk{0}".format(i) for i in range(0, 15)]
+        self.runadmin(current, "create " + " ".join(topics))
+        self.icestorm[2].start(current)
+        self.icestorm[2].expect(current, "init [01] with [0-9]+ updates")
+        checkTopics(2, ["sync0", "sync1", "sync2"] + topics)
+        for replica in range(0, 2):
+            checkTopics(replica, ["sync0", "sync1", "sync2"] + topics)
+        current.writeln("ok")
+
+        current.write("stopping replicas... ")
+        sys.stdout.flush()
+        self.stopIceStorm(current)
+        current.writeln("ok")
+
+TestSuite(__file__, [
+    IceStormRep1TestCase("replicated", icestorm=icestorm),
+    IceStormRepSyncTestCase("replicated sync", icestorm=syncIceStorm)
+], multihost=False)
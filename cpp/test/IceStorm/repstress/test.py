@@ -14,7 +14,12 @@ props = {
     "IceStorm.Election.MasterTimeout" : 2,
     "IceStorm.Election.ElectionTimeout" : 2,
     "IceStorm.Election.ResponseTimeout" : 2,
-    "Ice.Warn.Dispatch" : 0
+    "Ice.Warn.Dispatch" : 0,
+    #
+    # Trace the time taken by each replica to sync the database state
+    # of the master ("synced ... in <n>ms").
+    #
+    "IceStorm.Trace.Replication" : 1
 }
 
 icestorm = [ IceStorm(replica=i, nreplicas=3, props = props) for i in range(0,3) ]
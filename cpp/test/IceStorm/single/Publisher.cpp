@@ -51,7 +51,16 @@ Publisher::run(int argc, char** argv)
     SinglePrx single = SinglePrx::uncheckedCast(topic->getPublisher()->ice_twoway());
     for(int i = 0; i < 1000; ++i)
     {
-        single->event(i);
+        //
+        // The context of the events is used by the filtered subscribers.
+        //
+        Ice::Context ctx;
+        ctx["parity"] = i % 2 == 0 ? "even" : "odd";
+        if(i % 10 == 0)
+        {
+            ctx["tenth"] = "";
+        }
+        single->event(i, ctx);
     }
 }
 
@@ -16,8 +16,9 @@ class SingleI : public Single, public IceUtil::Monitor<IceUtil::Mutex>
 {
 public:
 
-    SingleI(const string& name) :
+    SingleI(const string& name, int expected = 1000) :
         _name(name),
+        _expected(expected),
         _count(0),
         _last(0)
     {
@@ -32,7 +33,8 @@ public:
             cerr << endl << "expected oneway request";
             test(false);
         }
-        else if((_name == "twoway" || _name == "twoway ordered") && current.requestId == 0)
+        else if((_name == "twoway" || _name == "twoway ordered" || _name == "twoway outstanding") &&
+                current.requestId == 0)
         {
             cerr << endl << "expected twoway request";
         }
@@ -46,13 +48,24 @@ public:
             cerr << endl << "expected datagram to be received over udp";
             test(false);
         }
+        if((_name == "filter" || _name == "flat filter") &&
+           (i % 2 != 0 || current.ctx.find("parity")->second != "even"))
+        {
+            cerr << endl << "received unexpected event for `" << _name << "': " << i;
+            test(false);
+        }
+        if(_name == "filter with negation and parentheses" && i % 10 != 0 && i % 2 == 0)
+        {
+            cerr << endl << "received unexpected event for `" << _name << "': " << i;
+            test(false);
+        }
         Lock sync(*this);
         if(_name == "per-request load balancing")
         {
             _connections.insert(current.con);
         }
         ++_last;
-        if(++_count == 1000)
+        if(++_count == _expected)
         {
             notify();
         }
@@ -65,7 +78,7 @@ public:
         cout << "testing " << _name << " ... " << flush;
         bool datagram = _name == "datagram" || _name == "batch datagram";
         IceUtil::Time timeout = (datagram) ? IceUtil::Time::seconds(5) : IceUtil::Time::seconds(30);
-        while(_count < 1000)
+        while(_count < _expected)
         {
             if(!timedWait(timeout))
             {
@@ -97,6 +110,7 @@ public:
 private:
 
     const string _name;
+    const int _expected;
     int _count;
     int _last;
     set<Ice::ConnectionPtr> _connections;
@@ -206,6 +220,120 @@ Subscriber::run(int argc, char** argv)
         subscriberIdentities.push_back(object->ice_getIdentity());
         topic->subscribeAndGetPublisher(qos, object);
     }
+    Ice::Identity missingIdentity;
+    {
+        //
+        // The outstanding events are acknowledged one by one, the
+        // subscriber is removed once the dispatch of its events fails
+        // with ObjectNotExistException.
+        //
+        IceStorm::QoS qos;
+        qos["maxOutstanding"] = "20";
+        missingIdentity = Ice::stringToIdentity(IceUtil::generateUUID());
+        Ice::ObjectPrx object = adapter->createProxy(missingIdentity);
+        subscriberIdentities.push_back(missingIdentity);
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        subscribers.push_back(new SingleI("twoway outstanding"));
+        IceStorm::QoS qos;
+        qos["maxOutstanding"] = "20";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        IceStorm::QoS qos;
+        qos["maxOutstanding"] = "20";
+        Ice::ObjectPrx object = adapter->addWithUUID(new SingleI("invalid"))->ice_oneway();
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, object);
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+    {
+        IceStorm::QoS qos;
+        qos["reliability"] = "ordered";
+        qos["maxOutstanding"] = "50";
+        Ice::ObjectPrx object = adapter->addWithUUID(new SingleI("invalid"));
+        try
+        {
+            topic->subscribeAndGetPublisher(qos, object);
+            test(false);
+        }
+        catch(const IceStorm::BadQoS&)
+        {
+        }
+    }
+    {
+        subscribers.push_back(new SingleI("filter", 500));
+        IceStorm::QoS qos;
+        qos["filter"] = "operation == 'event' && context['parity'] == \"even\"";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        //
+        // The odd events and the even events which are a multiple of 10.
+        //
+        subscribers.push_back(new SingleI("filter with negation and parentheses", 600));
+        IceStorm::QoS qos;
+        qos["filter"] = "!(context['parity'] == 'even' && !context['tenth']) && operation != 'other'";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        //
+        // A long chain of || isn't nested, only its last term matches.
+        //
+        subscribers.push_back(new SingleI("flat filter", 500));
+        string filter;
+        for(int i = 0; i < 100; ++i)
+        {
+            ostringstream os;
+            os << "context['parity'] == 'parity" << i << "' || ";
+            filter += os.str();
+        }
+        IceStorm::QoS qos;
+        qos["filter"] = filter + "context['parity'] == 'even'";
+        Ice::ObjectPrx object = adapter->addWithUUID(subscribers.back());
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
+    {
+        vector<string> filters;
+        filters.push_back("operation");
+        filters.push_back("operation == ");
+        filters.push_back("context['parity' == 'even'");
+        filters.push_back("(operation == 'event'");
+        filters.push_back("operation == 'event' ||");
+        filters.push_back("name == 'event'");
+        filters.push_back("operation == 'event");
+        filters.push_back(string(100, '(') + "operation == 'event'" + string(100, ')'));
+        filters.push_back(string(100, '!') + "operation == 'event'");
+        filters.push_back("context['" + string(5000, 'k') + "']");
+
+        Ice::ObjectPrx object = adapter->addWithUUID(new SingleI("invalid filter"));
+        for(vector<string>::const_iterator p = filters.begin(); p != filters.end(); ++p)
+        {
+            IceStorm::QoS qos;
+            qos["filter"] = *p;
+            try
+            {
+                topic->subscribeAndGetPublisher(qos, object);
+                test(false);
+            }
+            catch(const IceStorm::BadQoS&)
+            {
+            }
+        }
+    }
 
     {
         subscribers.push_back(new SingleI("per-request load balancing"));
@@ -254,6 +382,19 @@ Subscriber::run(int argc, char** argv)
     {
         (*p)->waitForEvents();
     }
+
+    cout << "testing batch dispatch failure ... " << flush;
+    for(int i = 0; i < 100; ++i)
+    {
+        ids = topic->getSubscribers();
+        if(find(ids.begin(), ids.end(), missingIdentity) == ids.end())
+        {
+            break;
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+    }
+    test(find(ids.begin(), ids.end(), missingIdentity) == ids.end());
+    cout << "ok" << endl;
 }
 
 DEFINE_TEST(Subscriber)
@@ -13,6 +13,55 @@ using namespace Ice;
 using namespace IceStorm;
 using namespace Test;
 
+//
+// Subscribes and unsubscribes a subscriber to its own topic, the
+// subscription updates of concurrent threads are group committed by
+// IceStorm.
+//
+class ChurnThread : public IceUtil::Thread
+{
+public:
+
+    ChurnThread(const TopicPrx& topic, const ObjectPrx& subscriber, int count) :
+        _topic(topic), _subscriber(subscriber), _count(count)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        try
+        {
+            for(int i = 0; i < _count; ++i)
+            {
+                _topic->subscribeAndGetPublisher(IceStorm::QoS(), _subscriber);
+                _topic->unsubscribe(_subscriber);
+            }
+        }
+        catch(const Ice::Exception& ex)
+        {
+            _exception.reset(ex.ice_clone());
+        }
+    }
+
+    void
+    check() const
+    {
+        if(_exception.get())
+        {
+            _exception->ice_throw();
+        }
+    }
+
+private:
+
+    const TopicPrx _topic;
+    const ObjectPrx _subscriber;
+    const int _count;
+    IceInternal::UniquePtr<Ice::Exception> _exception;
+};
+typedef IceUtil::Handle<ChurnThread> ChurnThreadPtr;
+
 class Publisher : public Test::TestHelper
 {
 public:
@@ -28,6 +77,8 @@ Publisher::run(int argc, char** argv)
     opts.addOpt("", "events", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "oneway");
     opts.addOpt("", "maxQueueTest");
+    opts.addOpt("", "churn", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "threads", IceUtilInternal::Options::NeedArg, "8");
 
     try
     {
@@ -75,6 +126,52 @@ Publisher::run(int argc, char** argv)
         throw invalid_argument(os.str());
     }
 
+    int churn = atoi(opts.optArg("churn").c_str());
+    if(churn > 0)
+    {
+        int threads = atoi(opts.optArg("threads").c_str());
+        if(threads <= 0)
+        {
+            ostringstream os;
+            os << argv[0] << ": threads must be > 0.";
+            throw invalid_argument(os.str());
+        }
+
+        vector<TopicPrx> topics;
+        vector<ChurnThreadPtr> churnThreads;
+        for(int i = 0; i < threads; ++i)
+        {
+            ostringstream name;
+            name << "churn" << i;
+            topics.push_back(manager->create(name.str()));
+            ObjectPrx subscriber = communicator->stringToProxy(name.str() + ":tcp -h 127.0.0.1 -p 12010");
+            churnThreads.push_back(new ChurnThread(topics.back(), subscriber, churn));
+        }
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(vector<ChurnThreadPtr>::const_iterator p = churnThreads.begin(); p != churnThreads.end(); ++p)
+        {
+            (*p)->start();
+        }
+        for(vector<ChurnThreadPtr>::const_iterator p = churnThreads.begin(); p != churnThreads.end(); ++p)
+        {
+            (*p)->getThreadControl().join();
+            (*p)->check();
+        }
+        IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        for(vector<TopicPrx>::const_iterator p = topics.begin(); p != topics.end(); ++p)
+        {
+            (*p)->destroy();
+        }
+
+        int updates = threads * churn * 2;
+        cout << updates << " subscription updates from " << threads << " threads in " << elapsed.toMilliSeconds()
+             << "ms (" << static_cast<int>(updates / max(elapsed.toSecondsDouble(), 0.001)) << " updates/s)... "
+             << flush;
+        return;
+    }
+
     TopicPrx topic = manager->retrieve("fed1");
 
     EventPrx twowayProxy = EventPrx::uncheckedCast(topic->getPublisher()->ice_twoway());
@@ -108,6 +108,50 @@ public:
     }
 };
 
+//
+// Simulates a link with the given latency: each event is acknowledged
+// once the latency elapsed, the events are dispatched concurrently by
+// the threads of the server thread pool.
+//
+class DelayEventI : public EventI
+{
+public:
+
+    DelayEventI(const CommunicatorPtr& communicator, int total, const IceUtil::Time& delay) :
+        EventI(communicator, total), _delay(delay)
+    {
+    }
+
+    virtual void
+    pub(int, const Ice::Current&)
+    {
+        {
+            Lock sync(*this);
+            if(_start == IceUtil::Time())
+            {
+                _start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            }
+        }
+
+        IceUtil::ThreadControl::sleep(_delay);
+
+        Lock sync(*this);
+        if(++_count == _total)
+        {
+            IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - _start;
+            cout << _total << " events with " << _delay.toMilliSeconds() << "ms latency in "
+                 << elapsed.toMilliSeconds() << "ms (" << static_cast<int>(_total / elapsed.toSecondsDouble())
+                 << " events/s)" << endl;
+            _communicator->shutdown();
+        }
+    }
+
+private:
+
+    const IceUtil::Time _delay;
+    IceUtil::Time _start;
+};
+
 class SlowEventI : public EventI
 {
 public:
@@ -317,6 +361,7 @@ Subscriber::run(int argc, char** argv)
     opts.addOpt("", "erratic", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "maxQueueDropEvents", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "maxQueueRemoveSub", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "delay", IceUtilInternal::Options::NeedArg);
 
     try
     {
@@ -360,6 +405,7 @@ Subscriber::run(int argc, char** argv)
     bool slow = opts.isSet("slow");
     int maxQueueDropEvents = opts.isSet("maxQueueDropEvents") ? atoi(opts.optArg("maxQueueDropEvents").c_str()) : 0;
     int maxQueueRemoveSub = opts.isSet("maxQueueRemoveSub") ? atoi(opts.optArg("maxQueueRemoveSub").c_str()) : 0;
+    int delay = atoi(opts.optArg("delay").c_str());
     bool erratic = false;
     int erraticNum = 0;
     s = opts.optArg("erratic");
@@ -409,6 +455,15 @@ Subscriber::run(int argc, char** argv)
             subs.push_back(item);
         }
     }
+    else if(delay > 0)
+    {
+        Subscription item;
+        item.adapter = communicator->createObjectAdapterWithEndpoints("SubscriberAdapter", "default");
+        item.servant = new DelayEventI(communicator.communicator(), events, IceUtil::Time::milliSeconds(delay));
+        item.qos = cmdLineQos;
+        item.qos["reliability"] = "twoway";
+        subs.push_back(item);
+    }
     else if(slow)
     {
         Subscription item;
@@ -486,6 +541,12 @@ Subscriber::run(int argc, char** argv)
             {
                 p->obj = p->obj->ice_oneway();
             }
+
+            q = p->qos.find("maxOutstanding");
+            if(q != p->qos.end())
+            {
+                qos["maxOutstanding"] = q->second;
+            }
             p->publisher = topic->subscribeAndGetPublisher(qos, p->obj);
         }
     }
@@ -32,10 +32,32 @@ class IceStormStressTestCase(IceStormTestCase):
         self.runadmin(current, "create TestIceStorm1/fed1 TestIceStorm2/fed1")
         current.writeln("ok")
 
+        current.write("Subscribing and unsubscribing concurrently... ")
+        ClientTestCase(client=Publisher("TestIceStorm1", args=["--churn", "500", "--threads", "8"])).run(current)
+        current.writeln("ok")
+
         current.write("Sending 5000 ordered events... ")
         doTest(("TestIceStorm1", '--events 5000 --qos "reliability,ordered"'), '--events 5000')
         current.writeln("ok")
 
+        #
+        # The subscriber acknowledges each event after 5ms, the events
+        # are dispatched by up to 100 threads to simulate a 5ms link.
+        #
+        props = { "Ice.ThreadPool.Server.Size" : 100 }
+        current.write("Sending 2000 twoway events to a subscriber with 5ms latency... ")
+        ClientServerTestCase(client=Publisher("TestIceStorm1", args=["--events", "2000", "--oneway"]),
+                             server=Subscriber("TestIceStorm1", args=["--events", "2000", "--delay", "5"],
+                                               props=props)).run(current)
+        current.writeln("ok")
+
+        current.write("Sending 2000 twoway events with 100 outstanding events to a subscriber with 5ms latency... ")
+        ClientServerTestCase(client=Publisher("TestIceStorm1", args=["--events", "2000", "--oneway"]),
+                             server=Subscriber("TestIceStorm1", args=["--events", "2000", "--delay", "5", "--qos",
+                                                                      "maxOutstanding,100"],
+                                               props=props)).run(current)
+        current.writeln("ok")
+
         self.runadmin(current, "link TestIceStorm1/fed1 TestIceStorm2/fed1")
         current.write("Sending 5000 ordered events across a link... ")
         doTest(("TestIceStorm2", '--events 5000 --qos "reliability,ordered"'), '--events 5000')
@@ -138,11 +160,27 @@ class IceStormStressTestCase(IceStormTestCase):
             s.stop(current, True)
         current.writeln("ok")
 
+#
+# The publish endpoints of the test use a fixed port, the shard publish
+# endpoints must be set.
+#
+def shardProps(portnum):
+    def props(process, current):
+        p = { "IceStorm.Shards" : 4 }
+        for i in range(0, 4):
+            p["IceStorm.Shard{0}.Publish.Endpoints".format(i)] = current.getTestEndpoint(portnum + 4 + i)
+        return p
+    return props
+
 TestSuite(__file__, [
 
     IceStormStressTestCase("persistent", icestorm=[IceStorm("TestIceStorm1", quiet=True),
                                                    IceStorm("TestIceStorm2", quiet=True, portnum=20)]),
 
+    IceStormStressTestCase("persistent sharded", icestorm=[
+        IceStorm("TestIceStorm1", quiet=True, props=shardProps(0)),
+        IceStorm("TestIceStorm2", quiet=True, portnum=20, props=shardProps(20))]),
+
     IceStormStressTestCase("replicated with replicated publisher", icestorm=
                            [IceStorm("TestIceStorm1", i, 3, quiet=True) for i in range(0,3)] +
                            [IceStorm("TestIceStorm2", i, 3, portnum=20, quiet=True) for i in range(0,3)]),
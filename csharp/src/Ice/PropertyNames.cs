@@ -36,6 +36,8 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Locator\.PreferSecure$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.Hedge$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.CollocationOptimized$", false, null),
@@ -48,6 +50,8 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Router\.PreferSecure$", false, null),
              new Property(@"^Ice\.Admin\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Admin\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.Hedge$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Router\.CollocationOptimized$", false, null),
@@ -61,7 +65,17 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^Ice\.Admin\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^Ice\.Admin\.ReplyCache\.Size$", false, null),
+             new Property(@"^Ice\.Admin\.ReplyCache\.TTL$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
              new Property(@"^Ice\.Admin\.Facets$", false, null),
@@ -71,16 +85,24 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Logger\.Properties$", false, null),
              new Property(@"^Ice\.Admin\.ServerId$", false, null),
              new Property(@"^Ice\.BackgroundLocatorCacheUpdates$", false, null),
+             new Property(@"^Ice\.LocatorCacheUpdates$", false, null),
              new Property(@"^Ice\.BatchAutoFlush$", true, null),
              new Property(@"^Ice\.BatchAutoFlushSize$", false, null),
              new Property(@"^Ice\.ChangeUser$", false, null),
+             new Property(@"^Ice\.CircuitBreaker\.Backoff$", false, null),
+             new Property(@"^Ice\.CircuitBreaker\.ErrorRate$", false, null),
+             new Property(@"^Ice\.CircuitBreaker\.Failures$", false, null),
+             new Property(@"^Ice\.CircuitBreaker\.MaxBackoff$", false, null),
              new Property(@"^Ice\.ClassGraphDepthMax$", false, null),
              new Property(@"^Ice\.ClientAccessPolicyProtocol$", false, null),
              new Property(@"^Ice\.Compression\.Level$", false, null),
              new Property(@"^Ice\.CollectObjects$", false, null),
              new Property(@"^Ice\.Config$", false, null),
+             new Property(@"^Ice\.ConnectStaggerDelay$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.ConnectionPoolSize$", false, null),
+             new Property(@"^Ice\.Default\.Hedge$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Host$", false, null),
@@ -89,6 +111,7 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Locator\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Default\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Default\.Locator\.CollocationOptimized$", false, null),
@@ -104,6 +127,7 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Router\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Default\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Router\.Router$", false, null),
              new Property(@"^Ice\.Default\.Router\.CollocationOptimized$", false, null),
@@ -116,6 +140,9 @@ namespace IceInternal
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
              new Property(@"^Ice\.HTTPProxyHost$", false, null),
              new Property(@"^Ice\.HTTPProxyPort$", false, null),
+             new Property(@"^Ice\.Hedge\.Budget$", false, null),
+             new Property(@"^Ice\.Hedge\.MinDelay$", false, null),
+             new Property(@"^Ice\.Hedge\.Operations$", false, null),
              new Property(@"^Ice\.ImplicitContext$", false, null),
              new Property(@"^Ice\.InitPlugins$", false, null),
              new Property(@"^Ice\.IPv4$", false, null),
@@ -140,6 +167,7 @@ namespace IceInternal
              new Property(@"^Ice\.PrintProcessId$", false, null),
              new Property(@"^Ice\.PrintStackTraces$", false, null),
              new Property(@"^Ice\.ProgramName$", false, null),
+             new Property(@"^Ice\.ReplyCache\.Operations$", false, null),
              new Property(@"^Ice\.RetryIntervals$", false, null),
              new Property(@"^Ice\.ServerIdleTime$", false, null),
              new Property(@"^Ice\.SOCKSProxyHost$", false, null),
@@ -154,6 +182,10 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.DispatchPriorities$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.DispatchOperationPriorities$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.DispatchWeights$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.DispatchQueueTimeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
@@ -161,7 +193,15 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.DispatchPriorities$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.DispatchOperationPriorities$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.DispatchWeights$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.DispatchQueueTimeMax$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.DispatchPriorities$", false, null),
+             new Property(@"^Ice\.DispatchOperationPriorities$", false, null),
+             new Property(@"^Ice\.DispatchWeights$", false, null),
+             new Property(@"^Ice\.DispatchQueueTimeMax$", false, null),
              new Property(@"^Ice\.ToStringMode$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Logger$", false, null),
@@ -216,6 +256,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.Hedge$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.CollocationOptimized$", false, null),
@@ -228,6 +270,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.Hedge$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.CollocationOptimized$", false, null),
@@ -241,7 +285,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
@@ -253,6 +307,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.Hedge$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -265,6 +321,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.Hedge$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -278,7 +336,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -290,6 +358,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.Hedge$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -302,6 +372,8 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.Hedge$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -315,7 +387,17 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.RetryCount$", false, null),
@@ -340,6 +422,8 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.Hedge$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -352,6 +436,8 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Router\.Hedge$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -365,7 +451,17 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Close$", false, null),
@@ -377,6 +473,8 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.Hedge$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -389,6 +487,8 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Router\.Hedge$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -402,7 +502,17 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceLocatorDiscovery\.Lookup$", false, null),
              new Property(@"^IceLocatorDiscovery\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.RetryCount$", false, null),
@@ -444,6 +554,8 @@ namespace IceInternal
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.PreferSecure$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.InvocationTimeout$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Hedge$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Locator$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Router$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.CollocationOptimized$", false, null),
@@ -465,6 +577,8 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceBridge\.Source\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceBridge\.Source\.Locator\.Hedge$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.Locator$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.Router$", false, null),
              new Property(@"^IceBridge\.Source\.Locator\.CollocationOptimized$", false, null),
@@ -477,6 +591,8 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.Router\.PreferSecure$", false, null),
              new Property(@"^IceBridge\.Source\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceBridge\.Source\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceBridge\.Source\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceBridge\.Source\.Router\.Hedge$", false, null),
              new Property(@"^IceBridge\.Source\.Router\.Locator$", false, null),
              new Property(@"^IceBridge\.Source\.Router\.Router$", false, null),
              new Property(@"^IceBridge\.Source\.Router\.CollocationOptimized$", false, null),
@@ -490,7 +606,17 @@ namespace IceInternal
              new Property(@"^IceBridge\.Source\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceBridge\.Source\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceBridge\.Source\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceBridge\.Source\.MessageSizeMax$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceBridge\.Source\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceBridge\.Source\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceBridge\.Source\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceBridge\.Target\.Endpoints$", false, null),
              new Property(@"^IceBridge\.InstanceName$", false, null),
              null
@@ -517,6 +643,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.Locator\.Hedge$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Locator\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -529,6 +657,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.Router\.Hedge$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Router\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Router\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Server\.Router\.CollocationOptimized$", false, null),
@@ -542,7 +672,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGridAdmin\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGridAdmin\.Server\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Address$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Interface$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Lookup$", false, null),
@@ -557,6 +697,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Hedge$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -569,6 +711,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Hedge$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -582,7 +726,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Close$", false, null),
@@ -594,6 +748,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.Hedge$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -606,6 +762,8 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.Hedge$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -619,7 +777,17 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.MessageSizeMax$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
              null
@@ -638,6 +806,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.CollocationOptimized$", false, null),
@@ -650,6 +820,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.CollocationOptimized$", false, null),
@@ -663,7 +835,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Heartbeat$", false, null),
@@ -676,6 +858,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.CollocationOptimized$", false, null),
@@ -688,6 +872,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.CollocationOptimized$", false, null),
@@ -701,8 +887,19 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Node\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Node\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Node\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
+             new Property(@"^IceGrid\.Node\.ActivationThreads$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
              new Property(@"^IceGrid\.Node\.CollocateRegistry$", false, null),
              new Property(@"^IceGrid\.Node\.Data$", false, null),
@@ -725,6 +922,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.Hedge$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.CollocationOptimized$", false, null),
@@ -737,6 +936,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -754,6 +955,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.CollocationOptimized$", false, null),
@@ -766,6 +969,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.CollocationOptimized$", false, null),
@@ -779,12 +984,24 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -801,6 +1018,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.CollocationOptimized$", false, null),
@@ -813,6 +1032,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.CollocationOptimized$", false, null),
@@ -826,7 +1047,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Timeout$", false, null),
@@ -840,6 +1071,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.CollocationOptimized$", false, null),
@@ -852,6 +1085,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.CollocationOptimized$", false, null),
@@ -865,7 +1100,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Port$", false, null),
@@ -882,6 +1127,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.CollocationOptimized$", false, null),
@@ -894,6 +1141,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.CollocationOptimized$", false, null),
@@ -907,15 +1156,29 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
+             new Property(@"^IceGrid\.Registry\.LMDB\.SyncMode$", false, null),
              new Property(@"^IceGrid\.Registry\.NodeSessionTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.ObserverUpdateWindow$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.CollocationOptimized$", false, null),
@@ -936,6 +1199,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -948,6 +1213,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.CollocationOptimized$", false, null),
@@ -961,7 +1228,17 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Heartbeat$", false, null),
@@ -974,6 +1251,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.CollocationOptimized$", false, null),
@@ -986,6 +1265,8 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.CollocationOptimized$", false, null),
@@ -999,13 +1280,25 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ReplyCache\.Size$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ReplyCache\.TTL$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionPoolSize$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Hedge$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1042,6 +1335,8 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Locator\.PreferSecure$", false, null),
              new Property(@"^IcePatch2\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^IcePatch2\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IcePatch2\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^IcePatch2\.Locator\.Hedge$", false, null),
              new Property(@"^IcePatch2\.Locator\.Locator$", false, null),
              new Property(@"^IcePatch2\.Locator\.Router$", false, null),
              new Property(@"^IcePatch2\.Locator\.CollocationOptimized$", false, null),
@@ -1054,6 +1349,8 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Router\.PreferSecure$", false, null),
              new Property(@"^IcePatch2\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^IcePatch2\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IcePatch2\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^IcePatch2\.Router\.Hedge$", false, null),
              new Property(@"^IcePatch2\.Router\.Locator$", false, null),
              new Property(@"^IcePatch2\.Router\.Router$", false, null),
              new Property(@"^IcePatch2\.Router\.CollocationOptimized$", false, null),
@@ -1067,8 +1364,19 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^IcePatch2\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^IcePatch2\.ReplyCache\.Size$", false, null),
+             new Property(@"^IcePatch2\.ReplyCache\.TTL$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
+             new Property(@"^IcePatch2\.FileCacheSize$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
              null
         };
@@ -1076,6 +1384,7 @@ namespace IceInternal
         public static Property[] IcePatch2ClientProps =
         {
              new Property(@"^IcePatch2Client\.ChunkSize$", false, null),
+             new Property(@"^IcePatch2Client\.ChunkSync$", false, null),
              new Property(@"^IcePatch2Client\.Directory$", false, null),
              new Property(@"^IcePatch2Client\.Proxy$", false, null),
              new Property(@"^IcePatch2Client\.Remove$", false, null),
@@ -1160,6 +1469,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Locator\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.Hedge$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.CollocationOptimized$", false, null),
@@ -1172,6 +1483,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Router\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.Hedge$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.CollocationOptimized$", false, null),
@@ -1185,7 +1498,17 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^Glacier2\.Client\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^Glacier2\.Client\.ReplyCache\.Size$", false, null),
+             new Property(@"^Glacier2\.Client\.ReplyCache\.TTL$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
              new Property(@"^Glacier2\.Client\.ForwardContext$", false, null),
@@ -1207,6 +1530,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.PermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.Hedge$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1218,6 +1543,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.Hedge$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1235,6 +1562,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.Hedge$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -1247,6 +1576,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.Hedge$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.CollocationOptimized$", false, null),
@@ -1260,7 +1591,17 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.DispatchPriorities$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.DispatchOperationPriorities$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.DispatchWeights$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.DispatchQueueTimeMax$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit\.Latency$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit\.Max$", false, null),
+             new Property(@"^Glacier2\.Server\.ConcurrencyLimit\.Min$", false, null),
+             new Property(@"^Glacier2\.Server\.ReplyCache\.Size$", false, null),
+             new Property(@"^Glacier2\.Server\.ReplyCache\.TTL$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
              new Property(@"^Glacier2\.Server\.ForwardContext$", false, null),
@@ -1272,6 +1613,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.SessionManager\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SessionManager\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.SessionManager\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.Hedge$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SessionManager\.CollocationOptimized$", false, null),
@@ -1282,6 +1625,8 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLSessionManager\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.LocatorCacheTimeout$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.ConnectionPoolSize$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.Hedge$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.CollocationOptimized$", false, null),
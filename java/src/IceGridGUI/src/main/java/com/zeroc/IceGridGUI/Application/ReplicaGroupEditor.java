@@ -207,7 +207,8 @@ class ReplicaGroupEditor extends Editor
         _loadSample.setEditable(true);
         JTextField loadSampleTextField = (JTextField)_loadSample.getEditor().getEditorComponent();
         loadSampleTextField.getDocument().addDocumentListener(_updateListener);
-        _loadSample.setToolTipText("Use the load average or CPU usage over the last 1, 5 or 15 minutes?");
+        _loadSample.setToolTipText(
+            "Use the load average or CPU usage over the last 1, 5 or 15 minutes, or the replica latency?");
 
         _proxyOptions.getDocument().addDocumentListener(_updateListener);
         _proxyOptions.setToolTipText("The proxy options used for proxies created by IceGrid for the replica group");
@@ -478,7 +479,7 @@ class ReplicaGroupEditor extends Editor
     private JTextField _nReplicas = new JTextField(20);
 
     private JLabel _loadSampleLabel;
-    private JComboBox _loadSample = new JComboBox(new String[] {"1", "5", "15"});
+    private JComboBox _loadSample = new JComboBox(new String[] {"1", "5", "15", "latency"});
 
     private ArrayMapField _objects;
     private java.util.LinkedList<ObjectDescriptor> _objectList;
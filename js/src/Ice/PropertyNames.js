@@ -39,6 +39,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Locator\.PreferSecure/", false, null),
     new Property("/^Ice\.Admin\.Locator\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Admin\.Locator\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.Hedge/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Locator/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Router/", false, null),
     new Property("/^Ice\.Admin\.Locator\.CollocationOptimized/", false, null),
@@ -51,6 +53,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Router\.PreferSecure/", false, null),
     new Property("/^Ice\.Admin\.Router\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Admin\.Router\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Router\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Admin\.Router\.Hedge/", false, null),
     new Property("/^Ice\.Admin\.Router\.Locator/", false, null),
     new Property("/^Ice\.Admin\.Router\.Router/", false, null),
     new Property("/^Ice\.Admin\.Router\.CollocationOptimized/", false, null),
@@ -64,7 +68,17 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.DispatchPriorities/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.DispatchOperationPriorities/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.DispatchWeights/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.DispatchQueueTimeMax/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit\.Latency/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit\.Max/", false, null),
+    new Property("/^Ice\.Admin\.ConcurrencyLimit\.Min/", false, null),
+    new Property("/^Ice\.Admin\.ReplyCache\.Size/", false, null),
+    new Property("/^Ice\.Admin\.ReplyCache\.TTL/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
     new Property("/^Ice\.Admin\.Facets/", false, null),
@@ -74,16 +88,24 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Logger\.Properties/", false, null),
     new Property("/^Ice\.Admin\.ServerId/", false, null),
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
+    new Property("/^Ice\.LocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
+    new Property("/^Ice\.CircuitBreaker\.Backoff/", false, null),
+    new Property("/^Ice\.CircuitBreaker\.ErrorRate/", false, null),
+    new Property("/^Ice\.CircuitBreaker\.Failures/", false, null),
+    new Property("/^Ice\.CircuitBreaker\.MaxBackoff/", false, null),
     new Property("/^Ice\.ClassGraphDepthMax/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
     new Property("/^Ice\.Config/", false, null),
+    new Property("/^Ice\.ConnectStaggerDelay/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
+    new Property("/^Ice\.Default\.ConnectionPoolSize/", false, null),
+    new Property("/^Ice\.Default\.Hedge/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Host/", false, null),
@@ -92,6 +114,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Locator\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Locator\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.Locator\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Default\.Locator\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.Locator\.Locator/", false, null),
     new Property("/^Ice\.Default\.Locator\.Router/", false, null),
     new Property("/^Ice\.Default\.Locator\.CollocationOptimized/", false, null),
@@ -107,6 +130,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Router\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Router\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.Router\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Default\.Router\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.Router\.Locator/", false, null),
     new Property("/^Ice\.Default\.Router\.Router/", false, null),
     new Property("/^Ice\.Default\.Router\.CollocationOptimized/", false, null),
@@ -119,6 +143,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.FactoryAssemblies/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
+    new Property("/^Ice\.Hedge\.Budget/", false, null),
+    new Property("/^Ice\.Hedge\.MinDelay/", false, null),
+    new Property("/^Ice\.Hedge\.Operations/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
@@ -143,6 +170,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.PrintProcessId/", false, null),
     new Property("/^Ice\.PrintStackTraces/", false, null),
     new Property("/^Ice\.ProgramName/", false, null),
+    new Property("/^Ice\.ReplyCache\.Operations/", false, null),
     new Property("/^Ice\.RetryIntervals/", false, null),
     new Property("/^Ice\.ServerIdleTime/", false, null),
     new Property("/^Ice\.SOCKSProxyHost/", false, null),
@@ -157,6 +185,10 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.DispatchPriorities/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.DispatchOperationPriorities/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.DispatchWeights/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.DispatchQueueTimeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
@@ -164,7 +196,15 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.DispatchPriorities/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.DispatchOperationPriorities/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.DispatchWeights/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.DispatchQueueTimeMax/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
+    new Property("/^Ice\.DispatchPriorities/", false, null),
+    new Property("/^Ice\.DispatchOperationPriorities/", false, null),
+    new Property("/^Ice\.DispatchWeights/", false, null),
+    new Property("/^Ice\.DispatchQueueTimeMax/", false, null),
     new Property("/^Ice\.ToStringMode/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Logger/", false, null),
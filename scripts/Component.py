@@ -116,7 +116,7 @@ class Ice(Component):
                 # Don't test Glacier2/IceStorm/IceGrid services with multilib platforms. We only
                 # build services for the native platform.
                 #
-                if parent in ["Glacier2", "IceStorm", "IceGrid"]:
+                if parent in ["Glacier2", "IceStorm", "IceGrid", "IcePatch2"]:
                     return False
         elif isinstance(platform, Linux):
             #
@@ -129,7 +129,7 @@ class Ice(Component):
 
         # No C++11 tests for IceStorm, IceGrid, etc
         if isinstance(mapping, CppMapping) and current.config.cpp11:
-            if parent in ["IceStorm", "IceBridge"]:
+            if parent in ["IceStorm", "IceBridge", "IcePatch2"]:
                 return False
             elif parent in ["IceGrid"] and testId not in ["IceGrid/simple"]:
                 return False
@@ -167,11 +167,11 @@ class Ice(Component):
         parent = re.match(r'^([\w]*).*', testcase.getTestSuite().getId()).group(1)
         if isinstance(testcase, ClientServerTestCase) and parent in ["Ice", "IceBox"]:
             return self.coreOptions
-        elif parent in ["IceGrid", "Glacier2", "IceStorm", "IceDiscovery", "IceBridge"]:
+        elif parent in ["IceGrid", "Glacier2", "IceStorm", "IceDiscovery", "IceBridge", "IcePatch2"]:
             return self.serviceOptions
 
     def getRunOrder(self):
-        return ["Slice", "IceUtil", "Ice", "IceSSL", "IceBox", "Glacier2", "IceGrid", "IceStorm"]
+        return ["Slice", "IceUtil", "Ice", "IceSSL", "IceBox", "Glacier2", "IceGrid", "IceStorm", "IcePatch2"]
 
     def isCross(self, testId):
         return testId in [